@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/rate-control/aarf-wifi-manager.h"
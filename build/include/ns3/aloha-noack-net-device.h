@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/aloha-noack-net-device.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/stats/model/basic-data-calculators.h"
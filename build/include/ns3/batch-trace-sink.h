@@ -0,0 +1 @@
+#include "/root/repo/src/stats/model/batch-trace-sink.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/rate-control/cara-wifi-manager.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/dsr/helper/dsr-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/fd-net-device/helper/emu-fd-net-device-helper.h"
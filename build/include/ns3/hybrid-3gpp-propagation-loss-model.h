@@ -0,0 +1 @@
+#include "/root/repo/src/buildings/model/hybrid-3gpp-propagation-loss-model.h"
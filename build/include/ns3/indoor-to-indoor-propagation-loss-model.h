@@ -0,0 +1 @@
+#include "/root/repo/src/buildings/model/indoor-to-indoor-propagation-loss-model.h"
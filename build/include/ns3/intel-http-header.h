@@ -0,0 +1 @@
+#include "/root/repo/src/psc/model/intel-http-header.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/psc/helper/intel-http-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/network/utils/ipv6-address.h"
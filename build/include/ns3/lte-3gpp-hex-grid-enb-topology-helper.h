@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/lte-3gpp-hex-grid-enb-topology-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/lte-nist-error-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/lte-sidelink-helper.h"
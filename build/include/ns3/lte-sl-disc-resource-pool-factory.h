@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/lte-sl-disc-resource-pool-factory.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/lte-sl-resource-pool-factory.h"
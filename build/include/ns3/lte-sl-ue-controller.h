@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/lte-sl-ue-controller.h"
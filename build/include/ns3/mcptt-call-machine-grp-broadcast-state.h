@@ -0,0 +1 @@
+#include "/root/repo/src/psc/model/mcptt-call-machine-grp-broadcast-state.h"
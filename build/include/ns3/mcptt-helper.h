@@ -0,0 +1 @@
+#include "/root/repo/src/psc/helper/mcptt-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/psc/model/mcptt-on-network-floor-towards-participant-state.h"
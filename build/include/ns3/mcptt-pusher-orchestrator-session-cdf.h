@@ -0,0 +1 @@
+#include "/root/repo/src/psc/model/mcptt-pusher-orchestrator-session-cdf.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/psc/model/mcptt-sdp-fmtp-header.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/psc/model/mcptt-server-call.h"
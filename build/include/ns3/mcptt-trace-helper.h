@@ -0,0 +1 @@
+#include "/root/repo/src/psc/helper/mcptt-trace-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/mesh/helper/mesh-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/mesh/model/mesh-wifi-interface-mac.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/olsr/model/olsr-routing-protocol.h"
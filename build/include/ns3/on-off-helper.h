@@ -0,0 +1 @@
+#include "/root/repo/src/applications/helper/on-off-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/buildings/model/outdoor-to-indoor-propagation-loss-model.h"
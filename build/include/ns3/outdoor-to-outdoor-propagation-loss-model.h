@@ -0,0 +1 @@
+#include "/root/repo/src/buildings/model/outdoor-to-outdoor-propagation-loss-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/network/utils/output-stream-wrapper.h"
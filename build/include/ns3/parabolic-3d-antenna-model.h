@@ -0,0 +1 @@
+#include "/root/repo/src/antenna/model/parabolic-3d-antenna-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/point-to-point-epc-helper.h"
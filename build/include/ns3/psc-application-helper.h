@@ -0,0 +1 @@
+#include "/root/repo/src/psc/helper/psc-application-helper.h"
@@ -0,0 +1,86 @@
+#ifdef NS3_MODULE_COMPILATION 
+    error "Do not include ns3 module aggregator headers from other modules these are meant only for end user scripts." 
+#endif 
+#ifndef NS3_MODULE_PSC
+    // Module headers: 
+    #include <ns3/ims-helper.h>
+    #include <ns3/intel-http-helper.h>
+    #include <ns3/mcptt-call-helper.h>
+    #include <ns3/mcptt-helper.h>
+    #include <ns3/mcptt-msg-stats.h>
+    #include <ns3/mcptt-server-helper.h>
+    #include <ns3/mcptt-state-machine-stats.h>
+    #include <ns3/mcptt-trace-helper.h>
+    #include <ns3/psc-application-helper.h>
+    #include <ns3/psc-scenario-trace-helper.h>
+    #include <ns3/uav-mobility-energy-model-helper.h>
+    #include <ns3/udp-group-echo-helper.h>
+    #include <ns3/intel-http-client.h>
+    #include <ns3/intel-http-header.h>
+    #include <ns3/intel-http-server.h>
+    #include <ns3/mcptt-call.h>
+    #include <ns3/mcptt-call-machine.h>
+    #include <ns3/mcptt-call-machine-grp-basic.h>
+    #include <ns3/mcptt-call-machine-grp-basic-state.h>
+    #include <ns3/mcptt-call-machine-grp-broadcast.h>
+    #include <ns3/mcptt-call-machine-grp-broadcast-state.h>
+    #include <ns3/mcptt-call-machine-private.h>
+    #include <ns3/mcptt-call-machine-private-state.h>
+    #include <ns3/mcptt-call-msg.h>
+    #include <ns3/mcptt-call-msg-field.h>
+    #include <ns3/mcptt-call-type-machine.h>
+    #include <ns3/mcptt-call-type-machine-grp-basic.h>
+    #include <ns3/mcptt-call-type-machine-private.h>
+    #include <ns3/mcptt-call-type-machine-private-state.h>
+    #include <ns3/mcptt-channel.h>
+    #include <ns3/mcptt-counter.h>
+    #include <ns3/mcptt-emerg-alert-machine.h>
+    #include <ns3/mcptt-emerg-alert-machine-basic.h>
+    #include <ns3/mcptt-entity-id.h>
+    #include <ns3/mcptt-floor-msg.h>
+    #include <ns3/mcptt-floor-msg-field.h>
+    #include <ns3/mcptt-floor-msg-sink.h>
+    #include <ns3/mcptt-floor-participant.h>
+    #include <ns3/mcptt-floor-queue.h>
+    #include <ns3/mcptt-media-msg.h>
+    #include <ns3/mcptt-media-sink.h>
+    #include <ns3/mcptt-media-src.h>
+    #include <ns3/mcptt-msg.h>
+    #include <ns3/mcptt-off-network-floor-participant.h>
+    #include <ns3/mcptt-off-network-floor-participant-state.h>
+    #include <ns3/mcptt-on-network-call-machine-client.h>
+    #include <ns3/mcptt-on-network-call-machine-client-state.h>
+    #include <ns3/mcptt-on-network-floor-arbitrator.h>
+    #include <ns3/mcptt-on-network-floor-arbitrator-state.h>
+    #include <ns3/mcptt-on-network-floor-dual-control.h>
+    #include <ns3/mcptt-on-network-floor-dual-control-state.h>
+    #include <ns3/mcptt-on-network-floor-participant.h>
+    #include <ns3/mcptt-on-network-floor-participant-state.h>
+    #include <ns3/mcptt-on-network-floor-towards-participant.h>
+    #include <ns3/mcptt-on-network-floor-towards-participant-state.h>
+    #include <ns3/mcptt-ptt-app.h>
+    #include <ns3/mcptt-pusher.h>
+    #include <ns3/mcptt-pusher-orchestrator.h>
+    #include <ns3/mcptt-pusher-orchestrator-contention.h>
+    #include <ns3/mcptt-pusher-orchestrator-interface.h>
+    #include <ns3/mcptt-pusher-orchestrator-session-cdf.h>
+    #include <ns3/mcptt-pusher-orchestrator-spurt-cdf.h>
+    #include <ns3/mcptt-queued-user-info.h>
+    #include <ns3/mcptt-rtp-header.h>
+    #include <ns3/mcptt-sdp-fmtp-header.h>
+    #include <ns3/mcptt-server-app.h>
+    #include <ns3/mcptt-server-call.h>
+    #include <ns3/mcptt-server-call-machine.h>
+    #include <ns3/mcptt-server-call-machine-group-prearranged.h>
+    #include <ns3/mcptt-server-call-machine-group-prearranged-state.h>
+    #include <ns3/mcptt-timer.h>
+    #include <ns3/psc-application.h>
+    #include <ns3/psc-application-client.h>
+    #include <ns3/psc-application-configuration.h>
+    #include <ns3/psc-application-server.h>
+    #include <ns3/psc-scenario-definition.h>
+    #include <ns3/psc-video-streaming.h>
+    #include <ns3/psc-video-streaming-distributions.h>
+    #include <ns3/uav-mobility-energy-model.h>
+    #include <ns3/udp-group-echo-server.h>
+#endif 
\ No newline at end of file
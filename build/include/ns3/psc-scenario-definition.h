@@ -0,0 +1 @@
+#include "/root/repo/src/psc/model/psc-scenario-definition.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/psc/model/psc-video-streaming.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/internet-apps/model/radvd-interface.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/mobility/model/random-walk-2d-mobility-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/rr-sl-ff-mac-scheduler.h"
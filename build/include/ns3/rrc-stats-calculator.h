@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/rrc-stats-calculator.h"
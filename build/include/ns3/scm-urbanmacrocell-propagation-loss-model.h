@@ -0,0 +1 @@
+#include "/root/repo/src/buildings/model/scm-urbanmacrocell-propagation-loss-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/sidelink-rsrp-calculator.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/sip/model/sip-header.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/helper/spectrum-wifi-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/psc/helper/uav-mobility-energy-model-helper.h"
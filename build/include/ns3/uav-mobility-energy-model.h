@@ -0,0 +1 @@
+#include "/root/repo/src/psc/model/uav-mobility-energy-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/psc/helper/udp-group-echo-helper.h"
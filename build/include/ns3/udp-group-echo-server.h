@@ -0,0 +1 @@
+#include "/root/repo/src/psc/model/udp-group-echo-server.h"
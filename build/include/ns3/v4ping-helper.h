@@ -0,0 +1 @@
+#include "/root/repo/src/internet-apps/helper/v4ping-helper.h"
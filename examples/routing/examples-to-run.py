@@ -10,6 +10,7 @@ cpp_examples = [
     ("dynamic-global-routing", "True", "True"),
     ("global-injection-slash32", "True", "True"),
     ("global-routing-slash32", "True", "True"),
+    ("global-routing-grid-benchmark --rows=4 --cols=4 --changes=2", "True", "False"),
     ("mixed-global-routing", "True", "True"),
     ("simple-alternate-routing", "True", "True"),
     ("simple-global-routing", "True", "True"),
@@ -0,0 +1,147 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the time spent by the global route manager to
+// compute the routes of a point-to-point grid, and to recompute them after
+// two kinds of changes on an interface of the grid: a change of its metric,
+// and the interface going down or up.  The incremental recomputation
+// (Ipv4GlobalRoutingHelper::RecomputeRoutingTables) is compared with a full
+// recomputation of every routing table.
+//
+// A metric change only leads to the recomputation of the routers whose
+// shortest-path trees may use the link, while an interface going down or up
+// changes the addresses advertised by its router, hence the routes of every
+// router of the grid.  The number of recomputed routers is logged by the
+// GlobalRouteManagerImpl component, at the INFO level.
+//
+// Usage example:
+//   ./ns3 run "global-routing-grid-benchmark --rows=30 --cols=30"
+
+#include "ns3/core-module.h"
+#include "ns3/global-route-manager.h"
+#include "ns3/internet-module.h"
+#include "ns3/point-to-point-grid.h"
+#include "ns3/point-to-point-module.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("GlobalRoutingGridBenchmark");
+
+/**
+ * Run a function and return its wall-clock duration.
+ * \param f the function to run
+ * \return the duration in milliseconds
+ */
+template <typename F>
+double
+Measure(F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/**
+ * Recompute the routes incrementally and fully, and accumulate the durations.
+ * \param incremental the total duration of the incremental recomputations
+ * \param full the total duration of the full recomputations
+ */
+static void
+Recompute(double& incremental, double& full)
+{
+    incremental += Measure([]() { Ipv4GlobalRoutingHelper::RecomputeRoutingTables(); });
+    full += Measure([]() {
+        GlobalRouteManager::DeleteGlobalRoutes();
+        GlobalRouteManager::BuildGlobalRoutingDatabase();
+        GlobalRouteManager::InitializeRoutes();
+    });
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t rows = 10;
+    uint32_t cols = 10;
+    uint32_t changes = 4;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("rows", "Number of rows of the grid", rows);
+    cmd.AddValue("cols", "Number of columns of the grid", cols);
+    cmd.AddValue("changes", "Number of changes of each kind to recompute routes for", changes);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(rows < 2 || cols < 2, "The grid needs at least two rows and two columns");
+
+    PointToPointHelper p2p;
+    p2p.SetDeviceAttribute("DataRate", StringValue("10Mbps"));
+    p2p.SetChannelAttribute("Delay", StringValue("1ms"));
+
+    InternetStackHelper stack;
+    PointToPointGridHelper grid(rows, cols, p2p);
+    grid.InstallStack(stack);
+    grid.AssignIpv4Addresses(Ipv4AddressHelper("10.0.0.0", "255.255.255.252"),
+                             Ipv4AddressHelper("10.128.0.0", "255.255.255.252"));
+
+    std::cout << "Grid of " << rows << "x" << cols << " nodes" << std::endl;
+    double populate = Measure([]() { Ipv4GlobalRoutingHelper::PopulateRoutingTables(); });
+    std::cout << "PopulateRoutingTables: " << populate << " ms" << std::endl;
+    if (changes == 0)
+    {
+        Simulator::Destroy();
+        return 0;
+    }
+
+    double incremental = 0;
+    double full = 0;
+    for (uint32_t c = 0; c < changes; c++)
+    {
+        // Raise or restore the metric of the first interface of a node
+        Ptr<Ipv4> ipv4 = grid.GetNode(c % rows, c % cols)->GetObject<Ipv4>();
+        ipv4->SetMetric(1, ipv4->GetMetric(1) == 1 ? 10 : 1);
+        Recompute(incremental, full);
+    }
+    std::cout << "Metric change, incremental recomputation: " << incremental / changes
+              << " ms/change" << std::endl;
+    std::cout << "Metric change, full recomputation: " << full / changes << " ms/change"
+              << std::endl;
+
+    incremental = 0;
+    full = 0;
+    for (uint32_t c = 0; c < changes; c++)
+    {
+        // Toggle the first interface of a node
+        Ptr<Ipv4> ipv4 = grid.GetNode(c % rows, c % cols)->GetObject<Ipv4>();
+        if (ipv4->IsUp(1))
+        {
+            ipv4->SetDown(1);
+        }
+        else
+        {
+            ipv4->SetUp(1);
+        }
+        Recompute(incremental, full);
+    }
+    std::cout << "Interface down/up, incremental recomputation: " << incremental / changes
+              << " ms/change" << std::endl;
+    std::cout << "Interface down/up, full recomputation: " << full / changes << " ms/change"
+              << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
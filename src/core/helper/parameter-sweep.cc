@@ -0,0 +1,320 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "parameter-sweep.h"
+
+#include "ns3/abort.h"
+#include "ns3/command-line.h"
+#include "ns3/log.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/system-path.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+/**
+ * \file
+ * \ingroup core-helpers
+ * ns3::ParameterSweep implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ParameterSweep");
+
+/**
+ * \ingroup core-helpers
+ * \return the functions run at the end of each replication
+ */
+static std::vector<ParameterSweep::ExitHook>&
+GetExitHooks()
+{
+    static std::vector<ParameterSweep::ExitHook> hooks;
+    return hooks;
+}
+
+ParameterSweep::ParameterSweep()
+    : m_firstRun(RngSeedManager::GetRun()),
+      m_runs(1),
+      m_jobs(0),
+      m_outputDirectory("sweep")
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+ParameterSweep::AddConfiguration(const std::string& name, const std::vector<std::string>& args)
+{
+    NS_LOG_FUNCTION(this << name);
+    NS_ABORT_MSG_IF(name.empty() || name.find('/') != std::string::npos,
+                    "Invalid configuration name \"" << name << "\"");
+    for (const auto& configuration : m_configurations)
+    {
+        NS_ABORT_MSG_IF(configuration.name == name, "Duplicate configuration " << name);
+    }
+    m_configurations.push_back({name, args});
+}
+
+void
+ParameterSweep::AddConfigurations(const std::string& filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+    std::ifstream is(filename);
+    NS_ABORT_MSG_IF(!is.is_open(), "Can't open file " << filename);
+    std::string line;
+    while (std::getline(is, line))
+    {
+        std::istringstream iss(line);
+        std::string name;
+        if (!(iss >> name) || name[0] == '#')
+        {
+            continue;
+        }
+        std::vector<std::string> args;
+        std::string arg;
+        while (iss >> arg)
+        {
+            args.push_back(arg);
+        }
+        AddConfiguration(name, args);
+    }
+}
+
+void
+ParameterSweep::SetCommonArguments(const std::vector<std::string>& args)
+{
+    m_commonArgs = args;
+}
+
+void
+ParameterSweep::SetRuns(uint64_t first, uint32_t count)
+{
+    NS_LOG_FUNCTION(this << first << count);
+    m_firstRun = first;
+    m_runs = count;
+}
+
+void
+ParameterSweep::SetJobs(uint32_t jobs)
+{
+    m_jobs = jobs;
+}
+
+void
+ParameterSweep::SetOutputDirectory(const std::string& directory)
+{
+    m_outputDirectory = directory;
+}
+
+void
+ParameterSweep::SetProgressCallback(ProgressCallback callback)
+{
+    m_progress = callback;
+}
+
+std::size_t
+ParameterSweep::GetReplications() const
+{
+    return m_configurations.size() * m_runs;
+}
+
+uint32_t
+ParameterSweep::Run(const std::string& program, MainFunction main) const
+{
+    NS_LOG_FUNCTION(this << program);
+    uint32_t jobs = m_jobs > 0 ? m_jobs : std::max(1U, std::thread::hardware_concurrency());
+    std::size_t replications = GetReplications();
+    SystemPath::MakeDirectories(m_outputDirectory);
+
+    std::map<pid_t, std::string> running; // name of the replications by process ID
+    std::size_t completed = 0;
+    uint32_t failed = 0;
+    // wait for the end of a replication
+    auto wait = [&]() {
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        auto it = running.find(pid);
+        if (it == running.end())
+        {
+            // not a replication
+            return;
+        }
+        completed++;
+        int exitStatus;
+        if (WIFEXITED(status))
+        {
+            exitStatus = WEXITSTATUS(status);
+            NS_LOG_INFO("[" << completed << "/" << replications << "] " << it->second
+                            << ": exit status " << exitStatus);
+        }
+        else
+        {
+            exitStatus = 128 + WTERMSIG(status);
+            NS_LOG_INFO("[" << completed << "/" << replications << "] " << it->second
+                            << ": killed by signal " << WTERMSIG(status));
+        }
+        failed += exitStatus != 0;
+        if (!m_progress.IsNull())
+        {
+            m_progress(completed, it->second, exitStatus);
+        }
+        running.erase(it);
+    };
+
+    for (const auto& configuration : m_configurations)
+    {
+        for (uint64_t run = m_firstRun; run < m_firstRun + m_runs; run++)
+        {
+            while (running.size() >= jobs)
+            {
+                wait();
+            }
+            std::string name = configuration.name + "-run" + std::to_string(run);
+            std::string directory = SystemPath::Append(m_outputDirectory, name);
+            SystemPath::MakeDirectories(directory);
+            NS_LOG_INFO("Start replication " << name);
+
+            // flush the buffers, so that the child process does not write them again
+            std::cout.flush();
+            std::cerr.flush();
+            std::fflush(nullptr);
+            pid_t pid = fork();
+            NS_ABORT_MSG_IF(pid < 0, "Can't fork the replication " << name);
+            if (pid == 0)
+            {
+                RunReplication(program, main, configuration, run, directory);
+            }
+            running[pid] = name;
+        }
+    }
+    while (!running.empty())
+    {
+        wait();
+    }
+    return failed;
+}
+
+void
+ParameterSweep::RunReplication(const std::string& program,
+                               MainFunction main,
+                               const Configuration& configuration,
+                               uint64_t run,
+                               const std::string& directory) const
+{
+    if (chdir(directory.c_str()) != 0 || !std::freopen("stdout.txt", "w", stdout) ||
+        !std::freopen("stderr.txt", "w", stderr))
+    {
+        std::_Exit(127);
+    }
+    RngSeedManager::SetRun(run);
+
+    std::vector<std::string> args{program};
+    args.insert(args.end(), m_commonArgs.begin(), m_commonArgs.end());
+    args.insert(args.end(), configuration.args.begin(), configuration.args.end());
+    std::vector<char*> argv;
+    for (auto& arg : args)
+    {
+        argv.push_back(arg.data());
+    }
+    argv.push_back(nullptr);
+
+    int status = main(static_cast<int>(args.size()), argv.data());
+    // release the simulation state and flush the output of the replication,
+    // but do not run the destructors of the static objects, which belong to
+    // the sweep process
+    Simulator::Destroy();
+    for (auto hook : GetExitHooks())
+    {
+        hook();
+    }
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+    std::_Exit(status);
+}
+
+int
+ParameterSweep::Main(int argc, char* argv[], MainFunction main)
+{
+    std::vector<std::string> sweepArgs{argv[0]};
+    std::vector<std::string> commonArgs;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg.rfind("--sweep", 0) == 0)
+        {
+            sweepArgs.push_back(arg);
+        }
+        else
+        {
+            commonArgs.push_back(arg);
+        }
+    }
+    if (sweepArgs.size() == 1)
+    {
+        return main(argc, argv);
+    }
+
+    std::string file;
+    uint32_t jobs = 0;
+    uint64_t firstRun = RngSeedManager::GetRun();
+    uint32_t runs = 1;
+    std::string output = "sweep";
+
+    CommandLine cmd;
+    cmd.Usage("Run the replications of a parameter sweep in parallel. The arguments which "
+              "are not sweep arguments are passed to all the replications.");
+    cmd.AddValue("sweepFile", "File listing the configurations, one per line", file);
+    cmd.AddValue("sweepJobs", "Number of parallel replications, 0 for one per processor", jobs);
+    cmd.AddValue("sweepFirstRun", "First RNG run number of each configuration", firstRun);
+    cmd.AddValue("sweepRuns", "Number of RNG runs of each configuration", runs);
+    cmd.AddValue("sweepOutput", "Directory of the output directories", output);
+    cmd.Parse(sweepArgs);
+    NS_ABORT_MSG_IF(file.empty(), "No configuration file, use --sweepFile");
+
+    ParameterSweep sweep;
+    sweep.AddConfigurations(file);
+    sweep.SetCommonArguments(commonArgs);
+    sweep.SetRuns(firstRun, runs);
+    sweep.SetJobs(jobs);
+    sweep.SetOutputDirectory(output);
+    uint32_t failed = sweep.Run(argv[0], main);
+    if (failed > 0)
+    {
+        std::cerr << failed << " of " << sweep.GetReplications() << " replications failed"
+                  << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+void
+ParameterSweep::AddExitHook(ExitHook hook)
+{
+    NS_LOG_FUNCTION_NOARGS();
+    GetExitHooks().push_back(hook);
+}
+
+} // namespace ns3
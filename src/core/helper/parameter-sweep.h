@@ -0,0 +1,236 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PARAMETER_SWEEP_H
+#define PARAMETER_SWEEP_H
+
+#include "ns3/callback.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup core-helpers
+ * ns3::ParameterSweep declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup core-helpers
+ *
+ * \brief Run the replications of a parameter sweep in parallel
+ *
+ * A sweep is a list of configurations, each one being a list of command
+ * line arguments, which are run for a number of RNG run numbers.  Each
+ * replication, i.e., each pair of configuration and run number, calls the
+ * main function of a simulation program in a child process forked from the
+ * sweep process, with:
+ *
+ * - the arguments of the configuration, appended to the common arguments;
+ * - its own RNG run number, set with RngSeedManager::SetRun;
+ * - its own output directory, \c <outputDirectory>/<configuration>-run<run>,
+ *   which is the working directory of the child process, so that the output
+ *   files written with relative names do not collide; the standard output
+ *   and error of the replication are written in the files \c stdout.txt and
+ *   \c stderr.txt of that directory.
+ *
+ * Since every replication has its own process, the simulator, the node and
+ * channel lists and any other static state are isolated, while the program
+ * startup (loading the libraries, registering the TypeIds, parsing the
+ * default attribute values) is paid only once by the sweep process.  The
+ * sweep process must not run a simulation before the replications, because
+ * the child processes would inherit its state.
+ *
+ * The simplest use is through Main, wrapping the main function of an
+ * existing program:
+ *
+ * \code
+ *   static int
+ *   RunSimulation(int argc, char* argv[])
+ *   {
+ *       CommandLine cmd(__FILE__);
+ *       ...
+ *   }
+ *
+ *   int
+ *   main(int argc, char* argv[])
+ *   {
+ *       return ParameterSweep::Main(argc, argv, &RunSimulation);
+ *   }
+ * \endcode
+ *
+ * Without sweep arguments, the program runs once as before.  With
+ * \c --sweepFile=configs.txt, each non-empty line of the file not starting
+ * with \c # is a configuration: its name followed by its arguments, e.g.,
+ *
+ * \code
+ *   config1-rb2 --period=sf40 --rbSize=2
+ *   config1-rb4 --period=sf40 --rbSize=4
+ * \endcode
+ *
+ * The other sweep arguments are \c --sweepJobs (number of parallel
+ * replications), \c --sweepRuns and \c --sweepFirstRun (RNG run numbers of
+ * each configuration) and \c --sweepOutput (output directory).  All the
+ * arguments which are not sweep arguments are common to all the
+ * configurations.
+ *
+ * The replications leave without running the destructors of the static
+ * objects and the functions registered with std::atexit, which belong to the
+ * sweep process.  After the main function returns, a replication destroys
+ * the simulator, which disposes the nodes and the channels and runs the
+ * functions scheduled with Simulator::ScheduleDestroy, then runs the exit
+ * hooks added with AddExitHook, e.g., to flush the buffers of static
+ * objects, and flushes the C and C++ standard streams.  The buffers of other
+ * objects which the replication did not destroy, e.g., an std::ofstream
+ * allocated with new and never deleted, are lost.
+ *
+ * The end of each replication is logged, at the INFO level of the
+ * ParameterSweep log component, and reported to the progress callback.
+ *
+ * This class is only available on POSIX systems.
+ */
+class ParameterSweep
+{
+  public:
+    /// Main function of a simulation program, run by each replication
+    typedef int (*MainFunction)(int argc, char* argv[]);
+
+    /// Function run at the end of each replication, before it exits
+    typedef void (*ExitHook)();
+
+    /**
+     * Callback invoked at the end of each replication, with the number of
+     * replications completed, the name of the replication and its exit
+     * status, or 128 plus the signal number if it was killed.
+     */
+    typedef Callback<void, std::size_t, const std::string&, int> ProgressCallback;
+
+    ParameterSweep();
+
+    /**
+     * Add a configuration.
+     * \param name the name of the configuration, used to name its output directories
+     * \param args the command line arguments of the configuration
+     */
+    void AddConfiguration(const std::string& name, const std::vector<std::string>& args);
+
+    /**
+     * Add the configurations listed in a file, one per line.
+     * \param filename the name of the file
+     */
+    void AddConfigurations(const std::string& filename);
+
+    /**
+     * Set the command line arguments common to all the configurations.
+     * \param args the arguments
+     */
+    void SetCommonArguments(const std::vector<std::string>& args);
+
+    /**
+     * Set the RNG run numbers of each configuration.
+     * \param first the first run number
+     * \param count the number of runs
+     */
+    void SetRuns(uint64_t first, uint32_t count);
+
+    /**
+     * Set the number of replications run in parallel.
+     * \param jobs the number of replications, or 0 for the number of
+     *        processors of the host
+     */
+    void SetJobs(uint32_t jobs);
+
+    /**
+     * Set the directory of the output directories of the replications.
+     * \param directory the directory, which is created if needed
+     */
+    void SetOutputDirectory(const std::string& directory);
+
+    /**
+     * Set the callback invoked at the end of each replication.
+     * \param callback the callback
+     */
+    void SetProgressCallback(ProgressCallback callback);
+
+    /**
+     * \return the number of replications of the sweep
+     */
+    std::size_t GetReplications() const;
+
+    /**
+     * Run all the replications, and wait for their end.
+     * \param program the name of the program, i.e., the first argument of the replications
+     * \param main the main function run by each replication
+     * \return the number of replications which failed, i.e., which did not
+     *         return 0 or which were killed
+     */
+    uint32_t Run(const std::string& program, MainFunction main) const;
+
+    /**
+     * Run a program once, or the sweep described by the sweep arguments.
+     * \param argc the number of command line arguments
+     * \param argv the command line arguments
+     * \param main the main function of the program
+     * \return the value returned by main when there is no sweep, otherwise
+     *         0 if all the replications succeeded and 1 if not
+     */
+    static int Main(int argc, char* argv[], MainFunction main);
+
+    /**
+     * Add a function run at the end of each replication.  The modules which
+     * keep output buffers in static objects add a hook to flush them, since
+     * the replications do not run the destructors of the static objects.
+     * \param hook the function
+     */
+    static void AddExitHook(ExitHook hook);
+
+  private:
+    /// Configuration of the sweep
+    struct Configuration
+    {
+        std::string name;              //!< name of the configuration
+        std::vector<std::string> args; //!< command line arguments
+    };
+
+    /**
+     * Run a replication in the current (child) process, and exit.
+     * \param program the name of the program
+     * \param main the main function
+     * \param configuration the configuration
+     * \param run the RNG run number
+     * \param directory the output directory of the replication
+     */
+    [[noreturn]] void RunReplication(const std::string& program,
+                                     MainFunction main,
+                                     const Configuration& configuration,
+                                     uint64_t run,
+                                     const std::string& directory) const;
+
+    std::vector<Configuration> m_configurations; //!< configurations
+    std::vector<std::string> m_commonArgs;       //!< arguments common to all configurations
+    uint64_t m_firstRun;                         //!< first RNG run number
+    uint32_t m_runs;                             //!< number of runs of each configuration
+    uint32_t m_jobs;                             //!< number of parallel replications
+    std::string m_outputDirectory;               //!< directory of the output directories
+    ProgressCallback m_progress;                 //!< callback at the end of each replication
+};
+
+} // namespace ns3
+
+#endif /* PARAMETER_SWEEP_H */
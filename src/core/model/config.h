@@ -22,6 +22,7 @@
 #include "ptr.h"
 
 #include <string>
+#include <utility>
 #include <vector>
 
 /**
@@ -183,6 +184,41 @@ bool ConnectFailSafe(std::string path, const CallbackBase& cb);
  */
 void Disconnect(std::string path, const CallbackBase& cb);
 
+/**
+ * \ingroup config
+ * A trace source name and the callback to connect to it.
+ */
+typedef std::pair<std::string, CallbackBase> TraceSink;
+
+/**
+ * \ingroup config
+ * \param [in] path A path to match the objects holding the trace sources,
+ *             without the trace source names.
+ * \param [in] sinks The trace source names and the callbacks to connect
+ *             to them.
+ *
+ * This function behaves like calling Config::Connect with
+ * \c path + "/" + \c name for each trace sink, but resolves \pname{path}
+ * only once.  If any of the trace sources has no match, this method will
+ * throw a fatal error.  Use ConnectBulkFailSafe if the absence of
+ * matching trace sources should not be fatal.
+ */
+void ConnectBulk(std::string path, const std::vector<TraceSink>& sinks);
+/**
+ * \ingroup config
+ * \param [in] path A path to match the objects holding the trace sources,
+ *             without the trace source names.
+ * \param [in] sinks The trace source names and the callbacks to connect
+ *             to them.
+ *
+ * This function behaves like calling Config::ConnectFailSafe with
+ * \c path + "/" + \c name for each trace sink, but resolves \pname{path}
+ * only once.
+ * \returns The number of trace sinks which could be connected to
+ *          at least one trace source.
+ */
+std::size_t ConnectBulkFailSafe(std::string path, const std::vector<TraceSink>& sinks);
+
 /**
  * \ingroup config
  * \brief hold a set of objects which match a specific search string.
@@ -27,6 +27,10 @@
 
 #include "ns3/core-config.h"
 
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 /**
  * \file
  * \ingroup object
@@ -81,107 +85,181 @@ ObjectBase::NotifyConstructionCompleted()
     NS_LOG_FUNCTION(this);
 }
 
-void
-ObjectBase::ConstructSelf(const AttributeConstructionList& attributes)
+/** ObjectBase anonymous namespace. */
+namespace
 {
-    // loop over the inheritance tree back to the Object base class.
-    NS_LOG_FUNCTION(this << &attributes);
-    TypeId tid = GetInstanceTypeId();
+
+/** One attribute to initialize in ObjectBase::ConstructSelf. */
+struct ConstructionStep
+{
+    Ptr<const AttributeAccessor> accessor; //!< The attribute accessor.
+    Ptr<const AttributeChecker> checker;   //!< The attribute checker.
+    /** The value from NS_ATTRIBUTE_DEFAULT, or else the initial value. */
+    Ptr<const AttributeValue> defaultValue;
+    bool fromEnv;        //!< Whether \c defaultValue comes from NS_ATTRIBUTE_DEFAULT.
+    bool construct;      //!< Whether the attribute is settable at construction.
+    TypeId tid;          //!< The TypeId declaring the attribute.
+    std::string name;    //!< The attribute name.
+};
+
+/**
+ * The flattened list of attributes to initialize for a TypeId, including
+ * the attributes of its parents.
+ */
+struct ConstructionPlan
+{
+    uint64_t generation{0}; //!< TypeId::GetAttributeGeneration() when built.
+    /** The NS_ATTRIBUTE_DEFAULT dictionary the plan was built with. */
+    std::shared_ptr<EnvironmentVariable::Dictionary> env;
+    /**
+     * The attributes to initialize.  Shared, so that a construction in
+     * progress keeps its steps if the plan is rebuilt meanwhile.
+     */
+    std::shared_ptr<const std::vector<ConstructionStep>> steps;
+};
+
+/**
+ * Get the construction plan of a TypeId, building it if it does not exist
+ * yet or if the attributes or NS_ATTRIBUTE_DEFAULT changed since it was built.
+ *
+ * \param [in] tid The TypeId.
+ * \returns The construction plan.
+ */
+const ConstructionPlan&
+GetConstructionPlan(TypeId tid)
+{
+    static std::unordered_map<uint16_t, ConstructionPlan> plans;
+    uint64_t generation = TypeId::GetAttributeGeneration();
+    auto env = EnvironmentVariable::GetDictionary("NS_ATTRIBUTE_DEFAULT");
+    ConstructionPlan& plan = plans[tid.GetUid()];
+    if (plan.generation == generation && plan.env == env)
+    {
+        return plan;
+    }
+
+    NS_LOG_DEBUG("building construction plan for tid=" << tid.GetName());
+    plan.generation = generation;
+    plan.env = env;
+    auto steps = std::make_shared<std::vector<ConstructionStep>>();
     do // Do this tid and all parents
     {
-        // loop over all attributes in object type
-        NS_LOG_DEBUG("construct tid=" << tid.GetName() << ", params=" << tid.GetAttributeN());
-        for (uint32_t i = 0; i < tid.GetAttributeN(); i++)
+        for (std::size_t i = 0; i < tid.GetAttributeN(); i++)
         {
             TypeId::AttributeInformation info = tid.GetAttribute(i);
-            NS_LOG_DEBUG("try to construct \"" << tid.GetName() << "::" << info.name << "\"");
-            // is this attribute stored in this AttributeConstructionList instance ?
-            Ptr<const AttributeValue> value = attributes.Find(info.checker);
-            std::string where = "argument";
-
-            // See if this attribute should not be set here in the
-            // constructor.
-            if (!(info.flags & TypeId::ATTR_CONSTRUCT))
+            ConstructionStep step;
+            step.accessor = info.accessor;
+            step.checker = info.checker;
+            step.defaultValue = info.initialValue;
+            step.fromEnv = false;
+            step.construct = (info.flags & TypeId::ATTR_CONSTRUCT);
+            step.tid = tid;
+            step.name = info.name;
+            auto [found, val] = env->Get(tid.GetAttributeFullName(i));
+            if (found)
             {
-                // Handle this attribute if it should not be
-                // set here.
-                if (!value)
-                {
-                    // Skip this attribute if it's not in the
-                    // AttributeConstructionList.
-                    NS_LOG_DEBUG("skipping, not settable at construction");
-                    continue;
-                }
-                else
-                {
-                    // This is an error because this attribute is not
-                    // settable in its constructor but is present in
-                    // the AttributeConstructionList.
-                    NS_FATAL_ERROR("Attribute name="
-                                   << info.name << " tid=" << tid.GetName()
-                                   << ": initial value cannot be set using attributes");
-                }
+                step.defaultValue = Create<StringValue>(val);
+                step.fromEnv = true;
             }
+            steps->push_back(step);
+        }
+        tid = tid.GetParent();
+    } while (tid != ObjectBase::GetTypeId());
+    plan.steps = steps;
+    return plan;
+}
+
+} // unnamed namespace
 
+void
+ObjectBase::ConstructSelf(const AttributeConstructionList& attributes)
+{
+    // loop over the flattened attributes of the inheritance tree back to the
+    // Object base class.
+    NS_LOG_FUNCTION(this << &attributes);
+    auto steps = GetConstructionPlan(GetInstanceTypeId()).steps;
+    for (const auto& step : *steps)
+    {
+        NS_LOG_DEBUG("try to construct \"" << step.tid.GetName() << "::" << step.name << "\"");
+        // is this attribute stored in this AttributeConstructionList instance ?
+        Ptr<const AttributeValue> value = attributes.Find(step.checker);
+        const char* where = "argument";
+
+        // See if this attribute should not be set here in the
+        // constructor.
+        if (!step.construct)
+        {
+            // Handle this attribute if it should not be
+            // set here.
             if (!value)
             {
-                NS_LOG_DEBUG("trying to set from environment variable NS_ATTRIBUTE_DEFAULT");
-                auto [found, val] =
-                    EnvironmentVariable::Get("NS_ATTRIBUTE_DEFAULT", tid.GetAttributeFullName(i));
-                if (found)
-                {
-                    NS_LOG_DEBUG("found in environment: " << val);
-                    value = Create<StringValue>(val);
-                    where = "env var";
-                }
+                // Skip this attribute if it's not in the
+                // AttributeConstructionList.
+                NS_LOG_DEBUG("skipping, not settable at construction");
+                continue;
             }
-
-            bool initial{false};
-            if (!value)
+            else
             {
-                // This is guaranteed to exist
-                NS_LOG_DEBUG("falling back to initial value from tid");
-                value = info.initialValue;
-                where = "initial value";
-                initial = true;
+                // This is an error because this attribute is not
+                // settable in its constructor but is present in
+                // the AttributeConstructionList.
+                NS_FATAL_ERROR("Attribute name="
+                               << step.name << " tid=" << step.tid.GetName()
+                               << ": initial value cannot be set using attributes");
             }
+        }
 
-            // We have a matching attribute value, if only from the initialValue
-            if (DoSet(info.accessor, info.checker, *value) || initial)
+        bool initial{false};
+        if (!value)
+        {
+            // This is guaranteed to exist; the environment variable
+            // NS_ATTRIBUTE_DEFAULT was looked up when building the plan
+            value = step.defaultValue;
+            if (step.fromEnv)
             {
-                // Setting from initial value may fail, e.g. setting
-                // ObjectVectorValue from ""
-                // That's ok, so we still report success since construction is complete
-                NS_LOG_DEBUG("construct \"" << tid.GetName() << "::" << info.name << "\" from "
-                                            << where);
+                NS_LOG_DEBUG("found in environment: " << value->SerializeToString(step.checker));
+                where = "env var";
             }
             else
             {
-                /*
-                  One would think this is an error...
-
-                  but there are cases where `attributes.Find(info.checker)`
-                  returns a non-null value which still fails the `DoSet()` call.
-                  For example, `value` is sometimes a real `PointerValue`
-                  containing 0 as the pointed-to address.  Since value
-                  is not null (it just contains null) the initial
-                  value is not used, the DoSet fails, and we end up
-                  here.
-
-                  If we were adventurous we might try to fix this deep
-                  below DoSet, but there be dragons.
-                */
-                /*
-                NS_ASSERT_MSG(false,
-                              "Failed to set attribute '" << info.name << "' from '"
-                                                          << value->SerializeToString(info.checker)
-                                                          << "'");
-                */
+                NS_LOG_DEBUG("falling back to initial value from tid");
+                where = "initial value";
+                initial = true;
             }
+        }
 
-        } // for i attributes
-        tid = tid.GetParent();
-    } while (tid != ObjectBase::GetTypeId());
+        // We have a matching attribute value, if only from the initialValue
+        if (DoSet(step.accessor, step.checker, *value) || initial)
+        {
+            // Setting from initial value may fail, e.g. setting
+            // ObjectVectorValue from ""
+            // That's ok, so we still report success since construction is complete
+            NS_LOG_DEBUG("construct \"" << step.tid.GetName() << "::" << step.name << "\" from "
+                                        << where);
+        }
+        else
+        {
+            /*
+              One would think this is an error...
+
+              but there are cases where `attributes.Find(info.checker)`
+              returns a non-null value which still fails the `DoSet()` call.
+              For example, `value` is sometimes a real `PointerValue`
+              containing 0 as the pointed-to address.  Since value
+              is not null (it just contains null) the initial
+              value is not used, the DoSet fails, and we end up
+              here.
+
+              If we were adventurous we might try to fix this deep
+              below DoSet, but there be dragons.
+            */
+            /*
+            NS_ASSERT_MSG(false,
+                          "Failed to set attribute '" << step.name << "' from '"
+                                                      << value->SerializeToString(step.checker)
+                                                      << "'");
+            */
+        }
+    } // for each step
     NotifyConstructionCompleted();
 }
 
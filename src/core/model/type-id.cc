@@ -182,6 +182,11 @@ class IidManager : public Singleton<IidManager>
      * \returns The type id.
      */
     uint16_t GetRegistered(uint16_t i) const;
+    /**
+     * Get the number of changes made to the attributes of all the type ids.
+     * \returns The attribute generation counter.
+     */
+    uint64_t GetAttributeGeneration() const;
     /**
      * Record a new attribute in a type id.
      * \param [in] uid The id.
@@ -339,6 +344,9 @@ class IidManager : public Singleton<IidManager>
     /** The by-name index. */
     namemap_t m_namemap;
 
+    /** Number of changes to the attributes or to the parents of the type ids. */
+    uint64_t m_attributeGeneration{0};
+
     /** Type of the by-hash index. */
     typedef std::map<TypeId::hash_t, uint16_t> hashmap_t;
     /** The by-hash index. */
@@ -468,6 +476,7 @@ IidManager::SetParent(uint16_t uid, uint16_t parent)
     NS_ASSERT(parent <= m_information.size());
     IidInformation* information = LookupInformation(uid);
     information->parent = parent;
+    m_attributeGeneration++;
 }
 
 void
@@ -685,6 +694,7 @@ IidManager::AddAttribute(uint16_t uid,
     info.supportLevel = supportLevel;
     info.supportMsg = supportMsg;
     information->attributes.push_back(info);
+    m_attributeGeneration++;
     NS_LOG_LOGIC(IIDL << information->attributes.size() - 1);
 }
 
@@ -697,6 +707,13 @@ IidManager::SetAttributeInitialValue(uint16_t uid,
     IidInformation* information = LookupInformation(uid);
     NS_ASSERT(i < information->attributes.size());
     information->attributes[i].initialValue = initialValue;
+    m_attributeGeneration++;
+}
+
+uint64_t
+IidManager::GetAttributeGeneration() const
+{
+    return m_attributeGeneration;
 }
 
 std::size_t
@@ -881,6 +898,12 @@ TypeId::GetRegisteredN()
     return IidManager::Get()->GetRegisteredN();
 }
 
+uint64_t
+TypeId::GetAttributeGeneration()
+{
+    return IidManager::Get()->GetAttributeGeneration();
+}
+
 TypeId
 TypeId::GetRegistered(uint16_t i)
 {
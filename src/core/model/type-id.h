@@ -164,6 +164,18 @@ class TypeId
      * \returns The number of TypeId instances registered.
      */
     static uint16_t GetRegisteredN();
+
+    /**
+     * Get a counter of the changes made to the attributes of the registered
+     * TypeIds: new attributes, new initial values (e.g., through
+     * Config::SetDefault) or new parents.
+     *
+     * Callers caching information derived from the attributes can compare
+     * this counter with its value when the cache was built to detect staleness.
+     *
+     * \returns The attribute generation counter.
+     */
+    static uint64_t GetAttributeGeneration();
     /**
      * Get a TypeId by index.
      *
@@ -864,6 +864,104 @@ SearchAttributesOfParentObjectsTestCase::DoRun()
     NS_TEST_ASSERT_MSG_EQ(iv.Get(), 42, "Object Attribute \"X\" not settable in derived class");
 }
 
+/**
+ * \ingroup config-tests
+ * Test for the ability to connect several trace sources at once.
+ */
+class ConnectBulkConfigTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    ConnectBulkConfigTestCase();
+
+    /** Destructor. */
+    ~ConnectBulkConfigTestCase() override
+    {
+    }
+
+    /**
+     * Trace callback with context path.
+     * \param path The context path.
+     * \param old The old value.
+     * \param newValue The new value.
+     */
+    void TraceWithPath(std::string path, int16_t old [[maybe_unused]], int16_t newValue)
+    {
+        m_newValue = newValue;
+        m_path = path;
+    }
+
+    /**
+     * Trace callback with context path, counting the trace notifications.
+     * \param path The context path.
+     * \param old The old value.
+     * \param newValue The new value.
+     */
+    void CountWithPath(std::string path [[maybe_unused]],
+                       int16_t old [[maybe_unused]],
+                       int16_t newValue [[maybe_unused]])
+    {
+        m_count++;
+    }
+
+  private:
+    void DoRun() override;
+
+    int16_t m_newValue; //!< Flag to detect tracing result.
+    std::string m_path; //!< The context path.
+    uint32_t m_count;   //!< Number of notifications of the counting callback.
+};
+
+ConnectBulkConfigTestCase::ConnectBulkConfigTestCase()
+    : TestCase("Check ability to connect several trace sources of the same objects at once")
+{
+}
+
+void
+ConnectBulkConfigTestCase::DoRun()
+{
+    Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject>();
+    Config::RegisterRootNamespaceObject(root);
+    Ptr<ConfigTestObject> a = CreateObject<ConfigTestObject>();
+    root->SetNodeA(a);
+    std::vector<Ptr<ConfigTestObject>> nodes;
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        nodes.push_back(CreateObject<ConfigTestObject>());
+        a->AddNodeA(nodes.back());
+    }
+
+    std::size_t connected = Config::ConnectBulkFailSafe(
+        "/NodeA/NodesA/[0-1]|3",
+        {{"Source", MakeCallback(&ConnectBulkConfigTestCase::TraceWithPath, this)},
+         {"Source", MakeCallback(&ConnectBulkConfigTestCase::CountWithPath, this)},
+         {"NoSuchSource", MakeCallback(&ConnectBulkConfigTestCase::CountWithPath, this)}});
+    NS_TEST_ASSERT_MSG_EQ(connected, 2, "Unexpected number of connected trace sinks");
+
+    for (uint32_t i = 0; i < nodes.size(); i++)
+    {
+        m_newValue = 0;
+        m_path = "";
+        m_count = 0;
+        // different from the default value of the attribute, so that the trace fires
+        int16_t value = -2 - static_cast<int16_t>(i);
+        nodes[i]->SetAttribute("Source", IntegerValue(value));
+        if (i == 2)
+        {
+            NS_TEST_ASSERT_MSG_EQ(m_newValue, 0, "Trace " << i << " fired unexpectedly");
+            NS_TEST_ASSERT_MSG_EQ(m_count, 0, "Trace " << i << " fired unexpectedly");
+            continue;
+        }
+        std::ostringstream path;
+        path << "/NodeA/NodesA/" << i << "/Source";
+        NS_TEST_ASSERT_MSG_EQ(m_newValue, value, "Trace " << i << " did not fire as expected");
+        NS_TEST_ASSERT_MSG_EQ(m_path, path.str(), "Trace " << i << " has an unexpected context");
+        NS_TEST_ASSERT_MSG_EQ(m_count, 1, "Trace " << i << " did not fire as expected");
+    }
+
+    Config::UnregisterRootNamespaceObject(root);
+}
+
 /**
  * \ingroup config-tests
  * The Test Suite that glues all of the Test Cases together.
@@ -882,6 +980,7 @@ ConfigTestSuite::ConfigTestSuite()
     AddTestCase(new UnderRootNamespaceConfigTestCase);
     AddTestCase(new ObjectVectorConfigTestCase);
     AddTestCase(new SearchAttributesOfParentObjectsTestCase);
+    AddTestCase(new ConnectBulkConfigTestCase);
 }
 
 /**
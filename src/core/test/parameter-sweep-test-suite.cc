@@ -0,0 +1,236 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/parameter-sweep.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/system-path.h"
+#include "ns3/test.h"
+
+#include <fstream>
+
+/**
+ * \file
+ * \ingroup core-tests
+ * ParameterSweep test suite.
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * Main function of the replications: it runs a simulation, writes its end time,
+ * its RNG run number and its arguments in result.txt, and fails if one of its
+ * arguments is --fail.
+ * \param argc the number of arguments
+ * \param argv the arguments
+ * \return 1 if one of the arguments is --fail, 0 otherwise
+ */
+static int
+SweepTestMain(int argc, char* argv[])
+{
+    Simulator::Schedule(Seconds(1), []() {});
+    Simulator::Run();
+    std::ofstream os("result.txt");
+    os << Simulator::Now().GetSeconds() << " " << RngSeedManager::GetRun();
+    int status = 0;
+    for (int i = 0; i < argc; i++)
+    {
+        os << " " << argv[i];
+        status = std::string(argv[i]) == "--fail" ? 1 : status;
+    }
+    Simulator::Destroy();
+    return status;
+}
+
+/// Output stream of a replication, flushed by SweepTestExitHook
+static std::ofstream* g_exitHookStream = nullptr;
+
+/**
+ * Exit hook of the replications, flushing g_exitHookStream.
+ */
+static void
+SweepTestExitHook()
+{
+    if (g_exitHookStream)
+    {
+        g_exitHookStream->flush();
+    }
+}
+
+/**
+ * Main function of the replications which neither destroy the simulator nor
+ * flush their output: it writes in hook.txt through g_exitHookStream, and in
+ * destroy.txt through a stream deleted when the simulator is destroyed.
+ * \param argc the number of arguments
+ * \param argv the arguments
+ * \return 0
+ */
+static int
+SweepTestExitMain(int argc, char* argv[])
+{
+    ParameterSweep::AddExitHook(&SweepTestExitHook);
+    g_exitHookStream = new std::ofstream("hook.txt");
+    *g_exitHookStream << "hook";
+    auto destroyStream = new std::ofstream("destroy.txt");
+    *destroyStream << "destroy";
+    Simulator::ScheduleDestroy([destroyStream]() { delete destroyStream; });
+    return 0;
+}
+
+/**
+ * \ingroup core-tests
+ * Check that each replication of a sweep runs with its arguments, RNG run
+ * number and output directory, and that the failures are counted.
+ */
+class ParameterSweepTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    ParameterSweepTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Progress callback of the sweep.
+     * \param completed the number of replications completed
+     * \param name the name of the replication
+     * \param status the exit status of the replication
+     */
+    void Progress(std::size_t completed, const std::string& name, int status);
+
+    std::size_t m_completed; //!< number of replications reported
+    uint32_t m_failed;       //!< number of failed replications reported
+};
+
+ParameterSweepTestCase::ParameterSweepTestCase()
+    : TestCase("ParameterSweep"),
+      m_completed(0),
+      m_failed(0)
+{
+}
+
+void
+ParameterSweepTestCase::Progress(std::size_t completed, const std::string& name, int status)
+{
+    m_completed = completed;
+    m_failed += status != 0;
+}
+
+void
+ParameterSweepTestCase::DoRun()
+{
+    std::string output = CreateTempDirFilename("sweep");
+    ParameterSweep sweep;
+    sweep.AddConfiguration("a", {"--x=1"});
+    sweep.AddConfiguration("b", {"--x=2", "--fail"});
+    sweep.SetCommonArguments({"--common"});
+    sweep.SetRuns(5, 2);
+    sweep.SetJobs(2);
+    sweep.SetOutputDirectory(output);
+    NS_TEST_ASSERT_MSG_EQ(sweep.GetReplications(), 4, "Wrong number of replications");
+
+    sweep.SetProgressCallback(MakeCallback(&ParameterSweepTestCase::Progress, this));
+    uint32_t failed = sweep.Run("program", &SweepTestMain);
+    NS_TEST_ASSERT_MSG_EQ(failed, 2, "Wrong number of failed replications");
+    NS_TEST_ASSERT_MSG_EQ(m_completed, 4, "Wrong number of completed replications reported");
+    NS_TEST_ASSERT_MSG_EQ(m_failed, 2, "Wrong number of failed replications reported");
+
+    for (std::string name : {"a", "b"})
+    {
+        for (uint64_t run : {5, 6})
+        {
+            std::string directory = name + "-run" + std::to_string(run);
+            std::string path = SystemPath::Append(output, directory);
+            std::ifstream is(SystemPath::Append(path, "result.txt"));
+            NS_TEST_ASSERT_MSG_EQ(is.is_open(), true, "No result for " << directory);
+            std::string result;
+            std::getline(is, result);
+            std::string expected = "1 " + std::to_string(run) + " program --common " +
+                                   (name == "a" ? "--x=1" : "--x=2 --fail");
+            NS_TEST_ASSERT_MSG_EQ(result, expected, "Wrong result for " << directory);
+        }
+    }
+}
+
+/**
+ * \ingroup core-tests
+ * Check that the output of a replication is flushed by the exit hooks and by
+ * the destruction of the simulator, even if the replication does neither.
+ */
+class ParameterSweepExitTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    ParameterSweepExitTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+ParameterSweepExitTestCase::ParameterSweepExitTestCase()
+    : TestCase("ParameterSweep exit of the replications")
+{
+}
+
+void
+ParameterSweepExitTestCase::DoRun()
+{
+    std::string output = CreateTempDirFilename("sweep-exit");
+    ParameterSweep sweep;
+    sweep.AddConfiguration("a", {});
+    sweep.SetOutputDirectory(output);
+    uint32_t failed = sweep.Run("program", &SweepTestExitMain);
+    NS_TEST_ASSERT_MSG_EQ(failed, 0, "The replication failed");
+
+    std::string directory = "a-run" + std::to_string(RngSeedManager::GetRun());
+    std::string path = SystemPath::Append(output, directory);
+    for (std::string name : {"hook", "destroy"})
+    {
+        std::ifstream is(SystemPath::Append(path, name + ".txt"));
+        std::string result;
+        std::getline(is, result);
+        NS_TEST_ASSERT_MSG_EQ(result, name, "Output not flushed in " << name << ".txt");
+    }
+}
+
+/**
+ * \ingroup core-tests
+ * ParameterSweep test suite.
+ */
+class ParameterSweepTestSuite : public TestSuite
+{
+  public:
+    ParameterSweepTestSuite()
+        : TestSuite("parameter-sweep")
+    {
+        AddTestCase(new ParameterSweepTestCase());
+        AddTestCase(new ParameterSweepExitTestCase());
+    }
+};
+
+/**
+ * \ingroup core-tests
+ * ParameterSweepTestSuite instance variable.
+ */
+static ParameterSweepTestSuite g_parameterSweepTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
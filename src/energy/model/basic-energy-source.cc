@@ -25,6 +25,8 @@
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -63,7 +65,9 @@ BasicEnergySource::GetTypeId()
                           MakeDoubleAccessor(&BasicEnergySource::m_highBatteryTh),
                           MakeDoubleChecker<double>())
             .AddAttribute("PeriodicEnergyUpdateInterval",
-                          "Time between two consecutive periodic energy updates.",
+                          "Time between two consecutive periodic energy updates. If zero, "
+                          "there is no periodic update: the energy is only updated when the "
+                          "current drawn changes, and when a battery threshold is crossed.",
                           TimeValue(Seconds(1.0)),
                           MakeTimeAccessor(&BasicEnergySource::SetEnergyUpdateInterval,
                                            &BasicEnergySource::GetEnergyUpdateInterval),
@@ -80,6 +84,7 @@ BasicEnergySource::BasicEnergySource()
     NS_LOG_FUNCTION(this);
     m_lastUpdateTime = Seconds(0.0);
     m_depleted = false;
+    m_totalCurrentA = 0;
 }
 
 BasicEnergySource::~BasicEnergySource()
@@ -135,6 +140,14 @@ double
 BasicEnergySource::GetRemainingEnergy()
 {
     NS_LOG_FUNCTION(this);
+    if (m_energyUpdateInterval.IsZero())
+    {
+        // the current has not changed since the last update, and no threshold
+        // was crossed, otherwise the source would have been updated
+        CalculateRemainingEnergy();
+        m_lastUpdateTime = Simulator::Now();
+        return m_remainingEnergyJ;
+    }
     // update energy source to get the latest remaining energy.
     UpdateEnergySource();
     return m_remainingEnergyJ;
@@ -144,9 +157,7 @@ double
 BasicEnergySource::GetEnergyFraction()
 {
     NS_LOG_FUNCTION(this);
-    // update energy source to get the latest remaining energy.
-    UpdateEnergySource();
-    return m_remainingEnergyJ / m_initialEnergyJ;
+    return GetRemainingEnergy() / m_initialEnergyJ;
 }
 
 void
@@ -175,7 +186,17 @@ BasicEnergySource::UpdateEnergySource()
         NotifyEnergyChanged();
     }
 
-    if (m_energyUpdateEvent.IsExpired())
+    if (m_energyUpdateInterval.IsZero())
+    {
+        // the device energy models may change their current after requesting
+        // the update: read it once all the changes at this time are done
+        if (!m_totalCurrentUpdateEvent.IsRunning())
+        {
+            m_totalCurrentUpdateEvent =
+                Simulator::ScheduleNow(&BasicEnergySource::UpdateTotalCurrent, this);
+        }
+    }
+    else if (m_energyUpdateEvent.IsExpired())
     {
         m_energyUpdateEvent = Simulator::Schedule(m_energyUpdateInterval,
                                                   &BasicEnergySource::UpdateEnergySource,
@@ -183,6 +204,36 @@ BasicEnergySource::UpdateEnergySource()
     }
 }
 
+void
+BasicEnergySource::UpdateTotalCurrent()
+{
+    NS_LOG_FUNCTION(this);
+    m_totalCurrentA = CalculateTotalCurrent();
+    m_energyUpdateEvent.Cancel();
+
+    // the remaining energy varies linearly until the next change of the current
+    double powerW = m_totalCurrentA * m_supplyVoltageV;
+    double energyToThresholdJ;
+    if (m_depleted)
+    {
+        // the power is negative when the harvesters recharge the source
+        powerW = -powerW;
+        energyToThresholdJ = m_highBatteryTh * m_initialEnergyJ - m_remainingEnergyJ;
+    }
+    else
+    {
+        energyToThresholdJ = m_remainingEnergyJ - m_lowBatteryTh * m_initialEnergyJ;
+    }
+    if (powerW > 0)
+    {
+        // one more time step, so that the threshold is crossed at the update
+        Time delay = Seconds(std::max(energyToThresholdJ, 0.0) / powerW) + TimeStep(1);
+        NS_LOG_DEBUG("BasicEnergySource:Battery threshold crossed in " << delay.As(Time::S));
+        m_energyUpdateEvent =
+            Simulator::Schedule(delay, &BasicEnergySource::UpdateEnergySource, this);
+    }
+}
+
 /*
  * Private functions start here.
  */
@@ -221,9 +272,18 @@ void
 BasicEnergySource::CalculateRemainingEnergy()
 {
     NS_LOG_FUNCTION(this);
-    double totalCurrentA = CalculateTotalCurrent();
     Time duration = Simulator::Now() - m_lastUpdateTime;
     NS_ASSERT(duration.IsPositive());
+    if (m_energyUpdateInterval.IsZero())
+    {
+        // the current drawn since the last update is constant
+        double energyToDecreaseJ = m_totalCurrentA * m_supplyVoltageV * duration.GetSeconds();
+        // the threshold crossing may be detected one time step late
+        m_remainingEnergyJ = std::max<double>(m_remainingEnergyJ - energyToDecreaseJ, 0);
+        NS_LOG_DEBUG("BasicEnergySource:Remaining energy = " << m_remainingEnergyJ);
+        return;
+    }
+    double totalCurrentA = CalculateTotalCurrent();
     // energy = current * voltage * time
     double energyToDecreaseJ = (totalCurrentA * m_supplyVoltageV * duration).GetSeconds();
     NS_ASSERT(m_remainingEnergyJ >= energyToDecreaseJ);
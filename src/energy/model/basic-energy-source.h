@@ -34,6 +34,16 @@ namespace ns3
  * BasicEnergySource decreases/increases remaining energy stored in itself in
  * linearly.
  *
+ * By default, the remaining energy is updated periodically, every
+ * PeriodicEnergyUpdateInterval, in addition to the updates requested by the
+ * device energy models when their current changes. If this interval is
+ * zero, there is no periodic update: the total current being constant
+ * between two updates, the remaining energy is integrated exactly over each
+ * interval with the current drawn since the previous update, and a single
+ * event is scheduled at the time the remaining energy is predicted to cross
+ * the low (or, when depleted, the high) battery threshold. This event is
+ * rescheduled after each update, once all the changes of the current at that
+ * time are done.
  */
 class BasicEnergySource : public EnergySource
 {
@@ -139,6 +149,13 @@ class BasicEnergySource : public EnergySource
      */
     void CalculateRemainingEnergy();
 
+    /**
+     * Reads the total current drawn from the energy source, when the periodic
+     * updates are disabled, and schedules the update at the time the
+     * remaining energy crosses the next battery threshold with this current.
+     */
+    void UpdateTotalCurrent();
+
   private:
     double m_initialEnergyJ; //!< initial energy, in Joules
     double m_supplyVoltageV; //!< supply voltage, in Volts
@@ -153,6 +170,9 @@ class BasicEnergySource : public EnergySource
     EventId m_energyUpdateEvent;            //!< energy update event
     Time m_lastUpdateTime;                  //!< last update time
     Time m_energyUpdateInterval;            //!< energy update interval
+    /// total current drawn since the last update, when the periodic updates are disabled
+    double m_totalCurrentA;
+    EventId m_totalCurrentUpdateEvent; //!< event reading the total current after an update
 };
 
 } // namespace ns3
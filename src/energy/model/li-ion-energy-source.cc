@@ -25,6 +25,7 @@
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace ns3
@@ -100,7 +101,9 @@ LiIonEnergySource::GetTypeId()
                           MakeDoubleAccessor(&LiIonEnergySource::m_minVoltTh),
                           MakeDoubleChecker<double>())
             .AddAttribute("PeriodicEnergyUpdateInterval",
-                          "Time between two consecutive periodic energy updates.",
+                          "Time between two consecutive periodic energy updates. If zero, "
+                          "there is no periodic update: the energy is only updated when the "
+                          "current drawn changes, and when the battery is depleted.",
                           TimeValue(Seconds(1.0)),
                           MakeTimeAccessor(&LiIonEnergySource::SetEnergyUpdateInterval,
                                            &LiIonEnergySource::GetEnergyUpdateInterval),
@@ -114,7 +117,8 @@ LiIonEnergySource::GetTypeId()
 
 LiIonEnergySource::LiIonEnergySource()
     : m_drainedCapacity(0.0),
-      m_lastUpdateTime(Seconds(0.0))
+      m_lastUpdateTime(Seconds(0.0)),
+      m_totalCurrentA(0.0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -174,6 +178,14 @@ double
 LiIonEnergySource::GetRemainingEnergy()
 {
     NS_LOG_FUNCTION(this);
+    if (m_energyUpdateInterval.IsZero())
+    {
+        // the current has not changed since the last update, and the battery
+        // is not depleted, otherwise the source would have been updated
+        CalculateRemainingEnergy();
+        m_lastUpdateTime = Simulator::Now();
+        return m_remainingEnergyJ;
+    }
     // update energy source to get the latest remaining energy.
     UpdateEnergySource();
     return m_remainingEnergyJ;
@@ -183,9 +195,7 @@ double
 LiIonEnergySource::GetEnergyFraction()
 {
     NS_LOG_FUNCTION(this);
-    // update energy source to get the latest remaining energy.
-    UpdateEnergySource();
-    return m_remainingEnergyJ / m_initialEnergyJ;
+    return GetRemainingEnergy() / m_initialEnergyJ;
 }
 
 void
@@ -228,6 +238,19 @@ LiIonEnergySource::UpdateEnergySource()
 
     m_lastUpdateTime = Simulator::Now();
 
+    if (m_energyUpdateInterval.IsZero())
+    {
+        // the device energy models may change their current after requesting
+        // the update: read it once all the changes at this time are done, and
+        // check the cell voltage with this current
+        if (!m_totalCurrentUpdateEvent.IsRunning())
+        {
+            m_totalCurrentUpdateEvent =
+                Simulator::ScheduleNow(&LiIonEnergySource::UpdateTotalCurrent, this);
+        }
+        return;
+    }
+
     if (m_remainingEnergyJ <= m_lowBatteryTh * m_initialEnergyJ)
     {
         HandleEnergyDrainedEvent();
@@ -238,9 +261,58 @@ LiIonEnergySource::UpdateEnergySource()
         Simulator::Schedule(m_energyUpdateInterval, &LiIonEnergySource::UpdateEnergySource, this);
 }
 
+void
+LiIonEnergySource::UpdateTotalCurrent()
+{
+    NS_LOG_FUNCTION(this);
+    m_totalCurrentA = CalculateTotalCurrent();
+    m_supplyVoltageV = GetVoltage(m_totalCurrentA);
+    m_energyUpdateEvent.Cancel();
+    if (IsDepleted())
+    {
+        HandleEnergyDrainedEvent();
+        return;
+    }
+    if (m_totalCurrentA <= 0)
+    {
+        return;
+    }
+
+    // The battery is depleted when the energy drained reaches the energy above
+    // the low battery threshold, or when the cell voltage, which decreases with
+    // the drained capacity, reaches the threshold voltage. Both conditions are
+    // monotonic in time before the cell is fully drained, so that the time of
+    // the depletion is found by bisection.
+    double energyToThresholdJ = m_remainingEnergyJ - m_lowBatteryTh * m_initialEnergyJ;
+    auto isDepleted = [this, energyToThresholdJ](double seconds) {
+        double capacity = m_drainedCapacity + m_totalCurrentA * seconds / 3600;
+        return GetDrainedEnergy(m_totalCurrentA, m_drainedCapacity, capacity) >=
+                   energyToThresholdJ ||
+               GetVoltage(m_totalCurrentA, capacity) <= m_minVoltTh;
+    };
+    double low = 0;
+    double high = (m_qRated - m_drainedCapacity) * 3600 / m_totalCurrentA;
+    while (high - low > TimeStep(1).GetSeconds() && low < (low + high) / 2)
+    {
+        double middle = (low + high) / 2;
+        (isDepleted(middle) ? high : low) = middle;
+    }
+    // one more time step, so that the battery is depleted at the update
+    Time delay = Seconds(high) + TimeStep(1);
+    NS_LOG_DEBUG("LiIonEnergySource:Battery depleted in " << delay.As(Time::S));
+    m_energyUpdateEvent = Simulator::Schedule(delay, &LiIonEnergySource::UpdateEnergySource, this);
+}
+
 /*
  * Private functions start here.
  */
+bool
+LiIonEnergySource::IsDepleted() const
+{
+    return m_remainingEnergyJ <= m_lowBatteryTh * m_initialEnergyJ ||
+           m_supplyVoltageV <= m_minVoltTh || m_drainedCapacity >= m_qRated;
+}
+
 void
 LiIonEnergySource::DoInitialize()
 {
@@ -267,9 +339,28 @@ void
 LiIonEnergySource::CalculateRemainingEnergy()
 {
     NS_LOG_FUNCTION(this);
-    double totalCurrentA = CalculateTotalCurrent();
     Time duration = Simulator::Now() - m_lastUpdateTime;
     NS_ASSERT(duration.GetSeconds() >= 0);
+    if (m_energyUpdateInterval.IsZero())
+    {
+        // the current drawn since the last update is constant
+        double drainedCapacity = m_drainedCapacity + (m_totalCurrentA * duration).GetHours();
+        if (drainedCapacity >= m_qRated)
+        {
+            m_remainingEnergyJ = 0;
+        }
+        else
+        {
+            double energyToDecreaseJ =
+                GetDrainedEnergy(m_totalCurrentA, m_drainedCapacity, drainedCapacity);
+            m_remainingEnergyJ = std::max<double>(m_remainingEnergyJ - energyToDecreaseJ, 0);
+        }
+        m_drainedCapacity = drainedCapacity;
+        m_supplyVoltageV = GetVoltage(m_totalCurrentA);
+        NS_LOG_DEBUG("LiIonEnergySource:Remaining energy = " << m_remainingEnergyJ);
+        return;
+    }
+    double totalCurrentA = CalculateTotalCurrent();
     // energy = current * voltage * time
     double energyToDecreaseJ = totalCurrentA * m_supplyVoltageV * duration.GetSeconds();
 
@@ -292,9 +383,14 @@ double
 LiIonEnergySource::GetVoltage(double i) const
 {
     NS_LOG_FUNCTION(this << i);
-
     // integral of i in dt, drained capacity in Ah
-    double it = m_drainedCapacity;
+    return GetVoltage(i, m_drainedCapacity);
+}
+
+double
+LiIonEnergySource::GetVoltage(double i, double it) const
+{
+    NS_LOG_FUNCTION(this << i << it);
 
     // empirical factors
     double A = m_eFull - m_eExp;
@@ -317,4 +413,23 @@ LiIonEnergySource::GetVoltage(double i) const
     return V;
 }
 
+double
+LiIonEnergySource::GetDrainedEnergy(double i, double it0, double it1) const
+{
+    NS_LOG_FUNCTION(this << i << it0 << it1);
+
+    // same factors as GetVoltage
+    double A = m_eFull - m_eExp;
+    double B = 3 / m_qExp;
+    double K = std::abs((m_eFull - m_eNom + A * (std::exp(-B * m_qNom) - 1)) * (m_qRated - m_qNom) /
+                        m_qNom);
+    double E0 = m_eFull + K + m_internalResistance * m_typCurrent - A;
+
+    // energy = integral of V * i in dt = integral of V in d(it), in Wh
+    double energyWh = (E0 - m_internalResistance * i) * (it1 - it0) +
+                      K * m_qRated * std::log((m_qRated - it1) / (m_qRated - it0)) +
+                      A / B * (std::exp(-B * it0) - std::exp(-B * it1));
+    return energyWh * 3600;
+}
+
 } // namespace ns3
@@ -48,6 +48,15 @@ namespace ns3
  * If the actual voltage of the cell goes below the minimum threshold voltage, the
  * cell is considered depleted and the energy drained event fired up.
  *
+ * By default, the remaining energy is updated periodically, every
+ * PeriodicEnergyUpdateInterval, with the cell voltage of the previous update.
+ * If this interval is zero, there is no periodic update: the total current
+ * being constant between two updates, the energy drained is the integral of
+ * the cell voltage over the drained capacity, computed in closed form, and a
+ * single event is scheduled at the time the remaining energy is predicted to
+ * cross the low battery threshold, or the cell voltage the threshold voltage.
+ * This event is rescheduled after each update.
+ *
  *
  * The model requires several parameters to approximates the discharge curves:
  * - InitialCellVoltage, maximum voltage of the fully charged cell
@@ -174,6 +183,12 @@ class LiIonEnergySource : public EnergySource
      */
     void HandleEnergyDrainedEvent();
 
+    /**
+     * \return true if the remaining energy is below the low battery threshold,
+     *         or the cell voltage below the threshold voltage
+     */
+    bool IsDepleted() const;
+
     /**
      * Calculates remaining energy. This function uses the total current from all
      * device models to calculate the amount of energy to decrease. The energy to
@@ -194,6 +209,34 @@ class LiIonEnergySource : public EnergySource
      */
     double GetVoltage(double current) const;
 
+    /**
+     * Get the cell voltage in function of the discharge current and of the
+     * capacity drained from the cell.
+     *
+     * \param current the discharge current, in A
+     * \param drainedCapacity the capacity drained from the cell, in Ah
+     * \return the cell voltage
+     */
+    double GetVoltage(double current, double drainedCapacity) const;
+
+    /**
+     * Get the energy drained from the cell by a constant discharge current,
+     * i.e., the integral of the cell voltage between two drained capacities.
+     *
+     * \param current the discharge current, in A
+     * \param startCapacity the capacity drained at the start, in Ah
+     * \param endCapacity the capacity drained at the end, in Ah
+     * \return the energy drained, in Joules
+     */
+    double GetDrainedEnergy(double current, double startCapacity, double endCapacity) const;
+
+    /**
+     * Reads the total current drawn from the energy source, when the periodic
+     * updates are disabled, and schedules the update at the time the battery
+     * is predicted to be depleted with this current.
+     */
+    void UpdateTotalCurrent();
+
   private:
     double m_initialEnergyJ;                //!< initial energy, in Joules
     TracedValue<double> m_remainingEnergyJ; //!< remaining energy, in Joules
@@ -212,6 +255,9 @@ class LiIonEnergySource : public EnergySource
     double m_qExp;               //!< capacity value at the end of the exponential zone, in Ah
     double m_typCurrent;         //!< typical discharge current used to fit the curves
     double m_minVoltTh;          //!< minimum threshold voltage to consider the battery depleted
+    /// total current drawn since the last update, when the periodic updates are disabled
+    double m_totalCurrentA;
+    EventId m_totalCurrentUpdateEvent; //!< event reading the total current after an update
 };
 
 } // namespace ns3
@@ -80,6 +80,55 @@ LiIonEnergyTestCase::DoRun()
     NS_TEST_ASSERT_MSG_EQ_TOL(es->GetSupplyVoltage(), 3.6, 1.0e-3, "Incorrect consumed energy!");
 }
 
+/**
+ * \ingroup energy-tests
+ *
+ * \brief LiIon battery Test, with the periodic energy updates disabled
+ */
+class LiIonEnergyEventTestCase : public TestCase
+{
+  public:
+    LiIonEnergyEventTestCase();
+
+    void DoRun() override;
+};
+
+LiIonEnergyEventTestCase::LiIonEnergyEventTestCase()
+    : TestCase("Li-Ion energy source test case without periodic updates")
+{
+}
+
+void
+LiIonEnergyEventTestCase::DoRun()
+{
+    Ptr<Node> node = CreateObject<Node>();
+
+    Ptr<SimpleDeviceEnergyModel> sem = CreateObject<SimpleDeviceEnergyModel>();
+    Ptr<LiIonEnergySource> es = CreateObject<LiIonEnergySource>();
+    es->SetEnergyUpdateInterval(Seconds(0));
+
+    es->SetNode(node);
+    sem->SetEnergySource(es);
+    es->AppendDeviceEnergyModel(sem);
+    node->AggregateObject(es);
+
+    // discharge at 2.33 A for 1701 seconds, with an intermediate query of the
+    // remaining energy which must not change the result
+    sem->SetCurrentA(2.33);
+    Simulator::Schedule(Seconds(600), &LiIonEnergySource::GetRemainingEnergy, es);
+    Simulator::Stop(Seconds(1701));
+    Simulator::Run();
+
+    double remainingEnergy = es->GetRemainingEnergy();
+    double voltage = es->GetSupplyVoltage();
+    Simulator::Destroy();
+
+    // same voltage as with the periodic updates, and the energy drained
+    // integrated with the voltage of the discharge curve
+    NS_TEST_ASSERT_MSG_EQ_TOL(voltage, 3.6, 1.0e-3, "Incorrect cell voltage!");
+    NS_TEST_ASSERT_MSG_EQ_TOL(remainingEnergy, 16923.214, 1.0e-3, "Incorrect consumed energy!");
+}
+
 /**
  * \ingroup energy-tests
  *
@@ -95,6 +144,7 @@ LiIonEnergySourceTestSuite::LiIonEnergySourceTestSuite()
     : TestSuite("li-ion-energy-source", UNIT)
 {
     AddTestCase(new LiIonEnergyTestCase, TestCase::QUICK);
+    AddTestCase(new LiIonEnergyEventTestCase, TestCase::QUICK);
 }
 
 /// create an instance of the test suite
@@ -19,10 +19,14 @@
 
 #include "flow-monitor.h"
 
+#include "ns3/abort.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
@@ -80,7 +84,24 @@ FlowMonitor::GetTypeId()
                 ("The minimum inter-arrival time that is considered a flow interruption."),
                 TimeValue(Seconds(0.5)),
                 MakeTimeAccessor(&FlowMonitor::m_flowInterruptionsMinTime),
-                MakeTimeChecker());
+                MakeTimeChecker())
+            .AddAttribute("MaxHistogramBins",
+                          ("The maximum number of bins of each histogram; values falling "
+                           "beyond the last bin are counted in it.  Zero means unbounded."),
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&FlowMonitor::m_maxHistogramBins),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("SnapshotInterval",
+                          ("The interval between two snapshots of the flow statistics written "
+                           "to SnapshotFileName.  Zero disables the snapshots."),
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&FlowMonitor::m_snapshotInterval),
+                          MakeTimeChecker())
+            .AddAttribute("SnapshotFileName",
+                          ("The name of the CSV file the periodic snapshots are written to."),
+                          StringValue("flowmon-snapshots.csv"),
+                          MakeStringAccessor(&FlowMonitor::m_snapshotFileName),
+                          MakeStringChecker());
     return tid;
 }
 
@@ -91,7 +112,8 @@ FlowMonitor::GetInstanceTypeId() const
 }
 
 FlowMonitor::FlowMonitor()
-    : m_enabled(false)
+    : m_lossWheelBase(0),
+      m_enabled(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -111,6 +133,11 @@ FlowMonitor::DoDispose()
         m_flowProbes[i]->Dispose();
         m_flowProbes[i] = nullptr;
     }
+    if (m_snapshotFile.is_open())
+    {
+        m_snapshotFile.close();
+    }
+    m_lossWheel.clear();
     Object::DoDispose();
 }
 
@@ -118,6 +145,10 @@ inline FlowMonitor::FlowStats&
 FlowMonitor::GetStatsForFlow(FlowId flowId)
 {
     NS_LOG_FUNCTION(this);
+    if (m_snapshotFile.is_open())
+    {
+        m_updatedFlows.insert(flowId);
+    }
     auto iter = m_flowStats.find(flowId);
     if (iter == m_flowStats.end())
     {
@@ -156,10 +187,17 @@ FlowMonitor::ReportFirstTx(Ptr<FlowProbe> probe,
         return;
     }
     Time now = Simulator::Now();
-    TrackedPacket& tracked = m_trackedPackets[std::make_pair(flowId, packetId)];
+    auto key = std::make_pair(flowId, packetId);
+    auto inserted = m_trackedPackets.insert(std::make_pair(key, TrackedPacket()));
+    TrackedPacket& tracked = inserted.first->second;
+    if (inserted.second)
+    {
+        tracked.lossWheelSlot = -1;
+    }
     tracked.firstSeenTime = now;
     tracked.lastSeenTime = tracked.firstSeenTime;
     tracked.timesForwarded = 0;
+    AddToLossWheel(key, tracked);
     NS_LOG_DEBUG("ReportFirstTx: adding tracked packet (flowId=" << flowId << ", packetId="
                                                                  << packetId << ").");
 
@@ -198,6 +236,7 @@ FlowMonitor::ReportForwarding(Ptr<FlowProbe> probe,
 
     tracked->second.timesForwarded++;
     tracked->second.lastSeenTime = Simulator::Now();
+    AddToLossWheel(key, tracked->second);
 
     Time delay = (Simulator::Now() - tracked->second.firstSeenTime);
     probe->AddPacketStats(flowId, packetSize, delay);
@@ -229,25 +268,25 @@ FlowMonitor::ReportLastRx(Ptr<FlowProbe> probe,
 
     FlowStats& stats = GetStatsForFlow(flowId);
     stats.delaySum += delay;
-    stats.delayHistogram.AddValue(delay.GetSeconds());
+    AddHistogramValue(stats.delayHistogram, m_delayBinWidth, delay.GetSeconds());
     if (stats.rxPackets > 0)
     {
         Time jitter = stats.lastDelay - delay;
         if (jitter > Seconds(0))
         {
             stats.jitterSum += jitter;
-            stats.jitterHistogram.AddValue(jitter.GetSeconds());
+            AddHistogramValue(stats.jitterHistogram, m_jitterBinWidth, jitter.GetSeconds());
         }
         else
         {
             stats.jitterSum -= jitter;
-            stats.jitterHistogram.AddValue(-jitter.GetSeconds());
+            AddHistogramValue(stats.jitterHistogram, m_jitterBinWidth, -jitter.GetSeconds());
         }
     }
     stats.lastDelay = delay;
 
     stats.rxBytes += packetSize;
-    stats.packetSizeHistogram.AddValue((double)packetSize);
+    AddHistogramValue(stats.packetSizeHistogram, m_packetSizeBinWidth, (double)packetSize);
     stats.rxPackets++;
     if (stats.rxPackets == 1)
     {
@@ -259,7 +298,9 @@ FlowMonitor::ReportLastRx(Ptr<FlowProbe> probe,
         Time interArrivalTime = now - stats.timeLastRxPacket;
         if (interArrivalTime > m_flowInterruptionsMinTime)
         {
-            stats.flowInterruptionsHistogram.AddValue(interArrivalTime.GetSeconds());
+            AddHistogramValue(stats.flowInterruptionsHistogram,
+                              m_flowInterruptionsBinWidth,
+                              interArrivalTime.GetSeconds());
         }
     }
     stats.timeLastRxPacket = now;
@@ -322,23 +363,105 @@ FlowMonitor::CheckForLostPackets(Time maxDelay)
     NS_LOG_FUNCTION(this << maxDelay.As(Time::S));
     Time now = Simulator::Now();
 
-    for (auto iter = m_trackedPackets.begin(); iter != m_trackedPackets.end();)
+    //
+    // Walk the loss wheel from the oldest slot.  The packets of a slot were
+    // last seen no earlier than the start of the slot, and no earlier than the
+    // packets of the previous slots, so the walk stops at the first slot which
+    // still holds a packet that is not lost.
+    //
+    while (!m_lossWheel.empty())
     {
-        if (now - iter->second.lastSeenTime >= maxDelay)
+        if (now - PERIODIC_CHECK_INTERVAL * m_lossWheelBase < maxDelay)
         {
-            // packet is considered lost, add it to the loss statistics
-            auto flow = m_flowStats.find(iter->first.first);
-            NS_ASSERT(flow != m_flowStats.end());
-            flow->second.lostPackets++;
-
-            // we won't track it anymore
-            m_trackedPackets.erase(iter++);
+            break;
         }
-        else
+        auto& slot = m_lossWheel.front();
+        std::size_t kept = 0;
+        for (const auto& key : slot)
         {
-            iter++;
+            auto iter = m_trackedPackets.find(key);
+            if (iter == m_trackedPackets.end() || iter->second.lossWheelSlot != m_lossWheelBase)
+            {
+                // packet received, dropped, or seen again since then
+                continue;
+            }
+            if (now - iter->second.lastSeenTime >= maxDelay)
+            {
+                // packet is considered lost, add it to the loss statistics
+                FlowStats& stats = GetStatsForFlow(key.first);
+                stats.lostPackets++;
+
+                // we won't track it anymore
+                m_trackedPackets.erase(iter);
+            }
+            else
+            {
+                slot[kept++] = key;
+            }
         }
+        if (kept > 0)
+        {
+            slot.resize(kept);
+            break;
+        }
+        m_lossWheel.pop_front();
+        m_lossWheelBase++;
+    }
+}
+
+void
+FlowMonitor::AddToLossWheel(const std::pair<FlowId, FlowPacketId>& key, TrackedPacket& tracked)
+{
+    int64_t slot = tracked.lastSeenTime.GetTimeStep() / PERIODIC_CHECK_INTERVAL.GetTimeStep();
+    if (slot == tracked.lossWheelSlot)
+    {
+        return;
+    }
+    if (m_lossWheel.empty())
+    {
+        m_lossWheelBase = slot;
     }
+    while (slot < m_lossWheelBase)
+    {
+        m_lossWheel.emplace_front();
+        m_lossWheelBase--;
+    }
+    if (static_cast<std::size_t>(slot - m_lossWheelBase) >= m_lossWheel.size())
+    {
+        m_lossWheel.resize(slot - m_lossWheelBase + 1);
+    }
+    m_lossWheel[slot - m_lossWheelBase].push_back(key);
+    tracked.lossWheelSlot = slot;
+}
+
+void
+FlowMonitor::AddHistogramValue(Histogram& histogram, double binWidth, double value) const
+{
+    if (m_maxHistogramBins > 0)
+    {
+        // the middle of the last bin, to be immune to rounding errors
+        value = std::min(value, (m_maxHistogramBins - 0.5) * binWidth);
+    }
+    histogram.AddValue(value);
+}
+
+void
+FlowMonitor::PeriodicSnapshot()
+{
+    NS_LOG_FUNCTION(this);
+    CheckForLostPackets();
+    Time now = Simulator::Now();
+    for (const auto flowId : m_updatedFlows)
+    {
+        const FlowStats& stats = m_flowStats[flowId];
+        m_snapshotFile << now.GetSeconds() << "," << flowId << "," << stats.txPackets << ","
+                       << stats.rxPackets << "," << stats.lostPackets << "," << stats.txBytes << ","
+                       << stats.rxBytes << "," << stats.delaySum.GetNanoSeconds() << ","
+                       << stats.jitterSum.GetNanoSeconds() << "," << stats.timesForwarded << "\n";
+    }
+    m_updatedFlows.clear();
+    m_snapshotFile.flush();
+    Simulator::Schedule(m_snapshotInterval, &FlowMonitor::PeriodicSnapshot, this);
 }
 
 void
@@ -359,6 +482,15 @@ FlowMonitor::NotifyConstructionCompleted()
 {
     Object::NotifyConstructionCompleted();
     Simulator::Schedule(PERIODIC_CHECK_INTERVAL, &FlowMonitor::PeriodicCheckForLostPackets, this);
+    if (m_snapshotInterval.IsStrictlyPositive())
+    {
+        m_snapshotFile.open(m_snapshotFileName, std::ios::out | std::ios::trunc);
+        NS_ABORT_MSG_IF(!m_snapshotFile.is_open(),
+                        "FlowMonitor: cannot open snapshot file " << m_snapshotFileName);
+        m_snapshotFile << "time,flowId,txPackets,rxPackets,lostPackets,txBytes,rxBytes,"
+                       << "delaySumNs,jitterSumNs,timesForwarded\n";
+        Simulator::Schedule(m_snapshotInterval, &FlowMonitor::PeriodicSnapshot, this);
+    }
 }
 
 void
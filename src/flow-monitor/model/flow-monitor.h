@@ -29,7 +29,10 @@
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 
+#include <deque>
+#include <fstream>
 #include <map>
+#include <set>
 #include <vector>
 
 namespace ns3
@@ -288,6 +291,7 @@ class FlowMonitor : public Object
         Time firstSeenTime;      //!< absolute time when the packet was first seen by a probe
         Time lastSeenTime;       //!< absolute time when the packet was last seen by a probe
         uint32_t timesForwarded; //!< number of times the packet was reportedly forwarded
+        int64_t lossWheelSlot;   //!< slot of the loss wheel holding the packet, or -1
     };
 
     /// FlowId --> FlowStats
@@ -296,6 +300,12 @@ class FlowMonitor : public Object
     /// (FlowId,PacketId) --> TrackedPacket
     typedef std::map<std::pair<FlowId, FlowPacketId>, TrackedPacket> TrackedPacketMap;
     TrackedPacketMap m_trackedPackets; //!< Tracked packets
+
+    /// Timing wheel of the tracked packets: slot i holds the packets last seen
+    /// during the i-th PERIODIC_CHECK_INTERVAL after the one of slot 0.  Packets
+    /// which have been seen again since are lazily dropped from their old slot.
+    std::deque<std::vector<std::pair<FlowId, FlowPacketId>>> m_lossWheel;
+    int64_t m_lossWheelBase; //!< index of the time interval covered by the first slot
     Time m_maxPerHopDelay;             //!< Minimum per-hop delay
     FlowProbeContainer m_flowProbes;   //!< all the FlowProbes
 
@@ -310,6 +320,11 @@ class FlowMonitor : public Object
     double m_packetSizeBinWidth;        //!< packet size bin width (for histograms)
     double m_flowInterruptionsBinWidth; //!< Flow interruptions bin width (for histograms)
     Time m_flowInterruptionsMinTime;    //!< Flow interruptions minimum time
+    uint32_t m_maxHistogramBins;        //!< Max number of bins per histogram (0: unbounded)
+    Time m_snapshotInterval;            //!< Interval between snapshots (0: disabled)
+    std::string m_snapshotFileName;     //!< Name of the snapshot file
+    std::ofstream m_snapshotFile;       //!< Snapshot output stream
+    std::set<FlowId> m_updatedFlows;    //!< Flows updated since the last snapshot
 
     /// Get the stats for a given flow
     /// \param flowId the Flow identification
@@ -318,6 +333,23 @@ class FlowMonitor : public Object
 
     /// Periodic function to check for lost packets and prune statistics
     void PeriodicCheckForLostPackets();
+
+    /// Put a tracked packet in the slot of the loss wheel matching the time
+    /// it was last seen, if it is not already there
+    /// \param key the (FlowId,PacketId) pair of the packet
+    /// \param tracked the tracked packet data
+    void AddToLossWheel(const std::pair<FlowId, FlowPacketId>& key, TrackedPacket& tracked);
+
+    /// Add a value to a histogram, accumulating the values beyond the last
+    /// allowed bin (see the MaxHistogramBins attribute) into that bin
+    /// \param histogram the histogram
+    /// \param binWidth the bin width of the histogram
+    /// \param value the value to add
+    void AddHistogramValue(Histogram& histogram, double binWidth, double value) const;
+
+    /// Periodic function writing the statistics of the flows updated since
+    /// the previous snapshot to the snapshot file, one CSV line per flow
+    void PeriodicSnapshot();
 };
 
 } // namespace ns3
@@ -0,0 +1,399 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/abort.h"
+#include "ns3/double.h"
+#include "ns3/error-model.h"
+#include "ns3/flow-monitor-helper.h"
+#include "ns3/flow-monitor.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/node-container.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/socket.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/udp-socket-factory.h"
+#include "ns3/uinteger.h"
+
+#include <fstream>
+#include <list>
+#include <sstream>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup flow-monitor-test
+ * FlowMonitor test suite.
+ */
+
+/**
+ * \ingroup flow-monitor
+ * \defgroup flow-monitor-test FlowMonitor module tests
+ */
+
+using namespace ns3;
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief Base class of the FlowMonitor tests: a UDP flow between two nodes
+ * linked by a SimpleChannel with a 2 ms delay, monitored by a FlowMonitor.
+ */
+class FlowMonitorTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param name the name of the test case
+     */
+    FlowMonitorTestCase(std::string name);
+
+  protected:
+    /// UDP payload size of the packets sent
+    static constexpr uint32_t PAYLOAD_SIZE = 1000;
+    /// Size of the packets seen by the FlowMonitor, with the IPv4 and UDP headers
+    static constexpr uint32_t PACKET_SIZE = PAYLOAD_SIZE + 28;
+
+    /**
+     * Create the two nodes and the sockets, and install the FlowMonitor.
+     * \param helper the FlowMonitor helper, with the monitor attributes already set
+     */
+    void Setup(FlowMonitorHelper& helper);
+
+    /**
+     * Schedule the transmission of a packet from the first node to the second one.
+     * \param time the time of the transmission
+     * \param lost whether the packet is dropped by the receiving device
+     */
+    void SendPacket(Time time, bool lost = false);
+
+    /**
+     * \return the statistics of the flow
+     */
+    FlowMonitor::FlowStats GetFlowStats() const;
+
+    Ptr<FlowMonitor> m_monitor; //!< the FlowMonitor
+
+  private:
+    /**
+     * Send a packet.
+     * \param lost whether the packet is dropped by the receiving device
+     */
+    void DoSendPacket(bool lost);
+
+    Ptr<Socket> m_txSocket;            //!< socket of the first node
+    Ptr<Socket> m_rxSocket;            //!< socket of the second node
+    Ptr<ListErrorModel> m_errorModel;  //!< error model of the receiving device
+    std::list<uint64_t> m_lostPackets; //!< UIDs of the packets to drop
+};
+
+FlowMonitorTestCase::FlowMonitorTestCase(std::string name)
+    : TestCase(name)
+{
+}
+
+void
+FlowMonitorTestCase::Setup(FlowMonitorHelper& helper)
+{
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    SimpleNetDeviceHelper devHelper;
+    devHelper.SetChannelAttribute("Delay", TimeValue(MilliSeconds(2)));
+    NetDeviceContainer devices = devHelper.Install(nodes);
+    m_errorModel = CreateObject<ListErrorModel>();
+    devices.Get(1)->GetObject<SimpleNetDevice>()->SetReceiveErrorModel(m_errorModel);
+
+    InternetStackHelper internet;
+    internet.Install(nodes);
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfaces = ipv4.Assign(devices);
+
+    m_rxSocket = Socket::CreateSocket(nodes.Get(1), UdpSocketFactory::GetTypeId());
+    m_rxSocket->Bind(InetSocketAddress(Ipv4Address::GetAny(), 9));
+    m_txSocket = Socket::CreateSocket(nodes.Get(0), UdpSocketFactory::GetTypeId());
+    m_txSocket->Bind();
+    m_txSocket->Connect(InetSocketAddress(interfaces.GetAddress(1), 9));
+
+    m_monitor = helper.InstallAll();
+}
+
+void
+FlowMonitorTestCase::SendPacket(Time time, bool lost)
+{
+    Simulator::Schedule(time, &FlowMonitorTestCase::DoSendPacket, this, lost);
+}
+
+void
+FlowMonitorTestCase::DoSendPacket(bool lost)
+{
+    Ptr<Packet> packet = Create<Packet>(PAYLOAD_SIZE);
+    if (lost)
+    {
+        m_lostPackets.push_back(packet->GetUid());
+        m_errorModel->SetList(m_lostPackets);
+    }
+    m_txSocket->Send(packet);
+}
+
+FlowMonitor::FlowStats
+FlowMonitorTestCase::GetFlowStats() const
+{
+    const FlowMonitor::FlowStatsContainer& stats = m_monitor->GetFlowStats();
+    NS_ABORT_MSG_IF(stats.size() != 1, "Expected a single flow, got " << stats.size());
+    return stats.begin()->second;
+}
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief Check that a packet which is not received is declared lost by the
+ * periodic checks once MaxPerHopDelay has elapsed since it was sent, and not
+ * before.
+ */
+class FlowMonitorLossTestCase : public FlowMonitorTestCase
+{
+  public:
+    FlowMonitorLossTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the statistics of the flow.
+     * \param rxPackets the expected number of received packets
+     * \param lostPackets the expected number of lost packets
+     */
+    void CheckStats(uint32_t rxPackets, uint32_t lostPackets);
+};
+
+FlowMonitorLossTestCase::FlowMonitorLossTestCase()
+    : FlowMonitorTestCase("Lost packets declared after MaxPerHopDelay")
+{
+}
+
+void
+FlowMonitorLossTestCase::CheckStats(uint32_t rxPackets, uint32_t lostPackets)
+{
+    FlowMonitor::FlowStats stats = GetFlowStats();
+    NS_TEST_ASSERT_MSG_EQ(stats.txPackets, 3, "Wrong number of transmitted packets");
+    NS_TEST_ASSERT_MSG_EQ(stats.rxPackets,
+                          rxPackets,
+                          "Wrong number of received packets at " << Simulator::Now().As(Time::S));
+    NS_TEST_ASSERT_MSG_EQ(stats.lostPackets,
+                          lostPackets,
+                          "Wrong number of lost packets at " << Simulator::Now().As(Time::S));
+}
+
+void
+FlowMonitorLossTestCase::DoRun()
+{
+    FlowMonitorHelper helper;
+    helper.SetMonitorAttribute("MaxPerHopDelay", TimeValue(Seconds(3)));
+    Setup(helper);
+
+    // the packet sent at 1.5 s is lost after 4.5 s, found by the check at 5 s,
+    // and the one sent at 2.5 s after 5.5 s, found by the check at 6 s
+    SendPacket(Seconds(1));
+    SendPacket(Seconds(1.5), true);
+    SendPacket(Seconds(2.5), true);
+    Simulator::Schedule(Seconds(4.9), &FlowMonitorLossTestCase::CheckStats, this, 1, 0);
+    Simulator::Schedule(Seconds(5.1), &FlowMonitorLossTestCase::CheckStats, this, 1, 1);
+    Simulator::Schedule(Seconds(5.9), &FlowMonitorLossTestCase::CheckStats, this, 1, 1);
+    Simulator::Schedule(Seconds(6.1), &FlowMonitorLossTestCase::CheckStats, this, 1, 2);
+    Simulator::Stop(Seconds(10));
+    Simulator::Run();
+
+    CheckStats(1, 2);
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief Check that MaxHistogramBins caps the number of bins of the histograms,
+ * the values beyond the last bin being counted in it.
+ */
+class FlowMonitorHistogramBinsTestCase : public FlowMonitorTestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param maxBins the maximum number of bins, 0 for unbounded histograms
+     */
+    FlowMonitorHistogramBinsTestCase(uint32_t maxBins);
+
+  private:
+    void DoRun() override;
+
+    uint32_t m_maxBins; //!< the maximum number of bins
+};
+
+FlowMonitorHistogramBinsTestCase::FlowMonitorHistogramBinsTestCase(uint32_t maxBins)
+    : FlowMonitorTestCase("Histograms with at most " + std::to_string(maxBins) + " bins"),
+      m_maxBins(maxBins)
+{
+}
+
+void
+FlowMonitorHistogramBinsTestCase::DoRun()
+{
+    const uint32_t n = 10;
+    FlowMonitorHelper helper;
+    helper.SetMonitorAttribute("MaxHistogramBins", UintegerValue(m_maxBins));
+    helper.SetMonitorAttribute("DelayBinWidth", DoubleValue(0.0001));
+    Setup(helper);
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        SendPacket(Seconds(1 + 0.1 * i));
+    }
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+
+    // the delays are above 2 ms, in the bins of index 20 and above of 0.1 ms,
+    // and the packets of 1028 bytes in the bin of index 51 of 20 bytes
+    FlowMonitor::FlowStats stats = GetFlowStats();
+    NS_TEST_ASSERT_MSG_EQ(stats.rxPackets, n, "Wrong number of received packets");
+    uint32_t delayBins = stats.delayHistogram.GetNBins();
+    uint32_t sizeBins = stats.packetSizeHistogram.GetNBins();
+    if (m_maxBins > 0)
+    {
+        NS_TEST_ASSERT_MSG_EQ(delayBins, m_maxBins, "Wrong number of delay bins");
+        NS_TEST_ASSERT_MSG_EQ(stats.delayHistogram.GetBinCount(m_maxBins - 1),
+                              n,
+                              "The delays must be counted in the last bin");
+        NS_TEST_ASSERT_MSG_EQ(sizeBins, m_maxBins, "Wrong number of packet size bins");
+        NS_TEST_ASSERT_MSG_EQ(stats.packetSizeHistogram.GetBinCount(m_maxBins - 1),
+                              n,
+                              "The packet sizes must be counted in the last bin");
+    }
+    else
+    {
+        NS_TEST_ASSERT_MSG_GT(delayBins, 20, "Wrong number of delay bins");
+        NS_TEST_ASSERT_MSG_EQ(sizeBins, PACKET_SIZE / 20 + 1, "Wrong number of packet size bins");
+        NS_TEST_ASSERT_MSG_EQ(stats.packetSizeHistogram.GetBinCount(sizeBins - 1),
+                              n,
+                              "Wrong packet size bin count");
+    }
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief Check the rows and columns of the CSV snapshots of the flow statistics
+ */
+class FlowMonitorSnapshotTestCase : public FlowMonitorTestCase
+{
+  public:
+    FlowMonitorSnapshotTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+FlowMonitorSnapshotTestCase::FlowMonitorSnapshotTestCase()
+    : FlowMonitorTestCase("Snapshots of the flow statistics")
+{
+}
+
+void
+FlowMonitorSnapshotTestCase::DoRun()
+{
+    std::string filename = CreateTempDirFilename("flowmon-snapshots.csv");
+    FlowMonitorHelper helper;
+    helper.SetMonitorAttribute("SnapshotInterval", TimeValue(Seconds(1)));
+    helper.SetMonitorAttribute("SnapshotFileName", StringValue(filename));
+    Setup(helper);
+
+    // one row at 1 s and one at 2 s; the flow is not updated during the
+    // interval of the snapshot at 3 s, which has no row
+    SendPacket(Seconds(0.5));
+    SendPacket(Seconds(1.5));
+    SendPacket(Seconds(1.6));
+    Simulator::Stop(Seconds(3.5));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    std::ifstream is(filename);
+    NS_TEST_ASSERT_MSG_EQ(is.is_open(), true, "Cannot open " << filename);
+    std::string line;
+    std::getline(is, line);
+    NS_TEST_ASSERT_MSG_EQ(line,
+                          "time,flowId,txPackets,rxPackets,lostPackets,txBytes,rxBytes,"
+                          "delaySumNs,jitterSumNs,timesForwarded",
+                          "Wrong header");
+
+    std::vector<std::vector<std::string>> rows;
+    while (std::getline(is, line))
+    {
+        std::vector<std::string> columns;
+        std::istringstream iss(line);
+        std::string column;
+        while (std::getline(iss, column, ','))
+        {
+            columns.push_back(column);
+        }
+        NS_TEST_ASSERT_MSG_EQ(columns.size(), 10, "Wrong number of columns in " << line);
+        rows.push_back(columns);
+    }
+    NS_TEST_ASSERT_MSG_EQ(rows.size(), 2, "Wrong number of rows");
+
+    // time, flowId, txPackets, rxPackets, lostPackets, txBytes and rxBytes
+    const std::vector<std::vector<uint64_t>> expected = {
+        {1, 1, 1, 1, 0, PACKET_SIZE, PACKET_SIZE},
+        {2, 1, 3, 3, 0, 3 * PACKET_SIZE, 3 * PACKET_SIZE},
+    };
+    for (std::size_t i = 0; i < rows.size(); i++)
+    {
+        for (std::size_t j = 0; j < expected[i].size(); j++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(std::stoull(rows[i][j]),
+                                  expected[i][j],
+                                  "Wrong column " << j << " in row " << i);
+        }
+        // 2 ms per packet, and the ARP resolution for the first one
+        NS_TEST_ASSERT_MSG_GT(std::stoll(rows[i][7]), 0, "Wrong delay sum in row " << i);
+        NS_TEST_ASSERT_MSG_EQ(rows[i][9], "0", "Wrong number of forwards in row " << i);
+    }
+}
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief FlowMonitor TestSuite
+ */
+class FlowMonitorTestSuite : public TestSuite
+{
+  public:
+    FlowMonitorTestSuite();
+};
+
+FlowMonitorTestSuite::FlowMonitorTestSuite()
+    : TestSuite("flow-monitor", UNIT)
+{
+    AddTestCase(new FlowMonitorLossTestCase, TestCase::QUICK);
+    AddTestCase(new FlowMonitorHistogramBinsTestCase(0), TestCase::QUICK);
+    AddTestCase(new FlowMonitorHistogramBinsTestCase(4), TestCase::QUICK);
+    AddTestCase(new FlowMonitorSnapshotTestCase, TestCase::QUICK);
+}
+
+static FlowMonitorTestSuite g_flowMonitorTestSuite; //!< Static variable for test initialization
@@ -87,6 +87,10 @@ class Ipv4GlobalRoutingHelper : public Ipv4RoutingHelper
      * Users must first call PopulateRoutingTables() and then may subsequently
      * call RecomputeRoutingTables() at any later time in the simulation.
      *
+     * The recomputation is incremental: only the nodes whose part of the
+     * topology has changed since the previous computation get their routes
+     * removed and recomputed.
+     *
      */
     static void RecomputeRoutingTables();
 };
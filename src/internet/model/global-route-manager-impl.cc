@@ -37,6 +37,7 @@
 #include <algorithm>
 #include <iostream>
 #include <queue>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -469,9 +470,27 @@ GlobalRouteManagerLSDB::Insert(Ipv4Address addr, GlobalRoutingLSA* lsa)
     {
         m_extdatabase.push_back(lsa);
     }
-    else
+    else if (m_database.insert(LSDBPair_t(addr, lsa)).second)
     {
-        m_database.insert(LSDBPair_t(addr, lsa));
+        //
+        // Index the transit network link records, so that GetLSAByLinkData
+        // does not have to walk the whole database.  When several LSAs share
+        // the same link data, keep the one with the lowest link state ID, i.e.,
+        // the first one a walk of the database would find.
+        //
+        for (uint32_t j = 0; j < lsa->GetNLinkRecords(); j++)
+        {
+            GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
+            if (lr->GetLinkType() != GlobalRoutingLinkRecord::TransitNetwork)
+            {
+                continue;
+            }
+            auto result = m_linkDataIndex.insert(LSDBPair_t(lr->GetLinkData(), lsa));
+            if (!result.second && addr < result.first->second->GetLinkStateId())
+            {
+                result.first->second = lsa;
+            }
+        }
     }
 }
 
@@ -496,12 +515,10 @@ GlobalRouteManagerLSDB::GetLSA(Ipv4Address addr) const
     //
     // Look up an LSA by its address.
     //
-    for (auto i = m_database.begin(); i != m_database.end(); i++)
+    auto i = m_database.find(addr);
+    if (i != m_database.end())
     {
-        if (i->first == addr)
-        {
-            return i->second;
-        }
+        return i->second;
     }
     return nullptr;
 }
@@ -511,23 +528,151 @@ GlobalRouteManagerLSDB::GetLSAByLinkData(Ipv4Address addr) const
 {
     NS_LOG_FUNCTION(this << addr);
     //
-    // Look up an LSA by its address.
+    // Look up an LSA by the link data of one of its transit network links.
     //
+    auto i = m_linkDataIndex.find(addr);
+    if (i != m_linkDataIndex.end())
+    {
+        return i->second;
+    }
+    return nullptr;
+}
+
+/**
+ * \brief Check whether a link record is a point-to-point or transit network
+ * link, i.e., a link whose metric is used to build the shortest-path tree.
+ *
+ * \param lr the link record
+ * \returns true if the link record links to a router or a transit network
+ */
+static bool
+IsTransitLinkRecord(const GlobalRoutingLinkRecord* lr)
+{
+    return lr->GetLinkType() == GlobalRoutingLinkRecord::PointToPoint ||
+           lr->GetLinkType() == GlobalRoutingLinkRecord::TransitNetwork;
+}
+
+/**
+ * \brief Check whether two Link State Advertisements carry the same
+ * information as far as the SPF calculation is concerned.
+ *
+ * \param a the first LSA
+ * \param b the second LSA
+ * \param metrics whether the metrics of the link records are compared
+ * \returns true if the two LSAs are equivalent
+ */
+static bool
+IsSameLSA(const GlobalRoutingLSA* a, const GlobalRoutingLSA* b, bool metrics)
+{
+    if (a->GetLSType() != b->GetLSType() || a->GetLinkStateId() != b->GetLinkStateId() ||
+        a->GetAdvertisingRouter() != b->GetAdvertisingRouter() ||
+        a->GetNetworkLSANetworkMask() != b->GetNetworkLSANetworkMask() ||
+        a->GetNLinkRecords() != b->GetNLinkRecords() ||
+        a->GetNAttachedRouters() != b->GetNAttachedRouters())
+    {
+        return false;
+    }
+    for (uint32_t j = 0; j < a->GetNLinkRecords(); j++)
+    {
+        GlobalRoutingLinkRecord* la = a->GetLinkRecord(j);
+        GlobalRoutingLinkRecord* lb = b->GetLinkRecord(j);
+        if (la->GetLinkType() != lb->GetLinkType() || la->GetLinkId() != lb->GetLinkId() ||
+            la->GetLinkData() != lb->GetLinkData())
+        {
+            return false;
+        }
+        if (metrics && la->GetMetric() != lb->GetMetric())
+        {
+            return false;
+        }
+    }
+    for (uint32_t j = 0; j < a->GetNAttachedRouters(); j++)
+    {
+        if (a->GetAttachedRouter(j) != b->GetAttachedRouter(j))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * \brief Add the link data of the transit network link records of a Link
+ * State Advertisement to a set.
+ *
+ * \param lsa the LSA
+ * \param linkData the set
+ */
+static void
+InsertTransitLinkData(const GlobalRoutingLSA* lsa, std::set<Ipv4Address>& linkData)
+{
+    for (uint32_t j = 0; j < lsa->GetNLinkRecords(); j++)
+    {
+        GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
+        if (lr->GetLinkType() == GlobalRoutingLinkRecord::TransitNetwork)
+        {
+            linkData.insert(lr->GetLinkData());
+        }
+    }
+}
+
+void
+GlobalRouteManagerLSDB::GetChanges(const GlobalRouteManagerLSDB& other,
+                                   std::set<Ipv4Address>& modified,
+                                   std::set<Ipv4Address>& modifiedLinkData,
+                                   std::vector<MetricChange>& metrics) const
+{
+    NS_LOG_FUNCTION(this << &other);
     for (auto i = m_database.begin(); i != m_database.end(); i++)
     {
-        GlobalRoutingLSA* temp = i->second;
-        // Iterate among temp's Link Records
-        for (uint32_t j = 0; j < temp->GetNLinkRecords(); j++)
+        auto j = other.m_database.find(i->first);
+        if (j == other.m_database.end() || !IsSameLSA(i->second, j->second, false))
+        {
+            modified.insert(i->first);
+            InsertTransitLinkData(i->second, modifiedLinkData);
+            if (j != other.m_database.end())
+            {
+                InsertTransitLinkData(j->second, modifiedLinkData);
+            }
+            continue;
+        }
+        for (uint32_t k = 0; k < i->second->GetNLinkRecords(); k++)
         {
-            GlobalRoutingLinkRecord* lr = temp->GetLinkRecord(j);
-            if (lr->GetLinkType() == GlobalRoutingLinkRecord::TransitNetwork &&
-                lr->GetLinkData() == addr)
+            // the metrics of the stub network link records are not used
+            GlobalRoutingLinkRecord* lr = i->second->GetLinkRecord(k);
+            uint16_t metric = j->second->GetLinkRecord(k)->GetMetric();
+            if (IsTransitLinkRecord(lr) && lr->GetMetric() != metric)
             {
-                return temp;
+                metrics.push_back({i->first, k, metric});
             }
         }
     }
-    return nullptr;
+    for (auto j = other.m_database.begin(); j != other.m_database.end(); j++)
+    {
+        if (m_database.find(j->first) == m_database.end())
+        {
+            modified.insert(j->first);
+            InsertTransitLinkData(j->second, modifiedLinkData);
+        }
+    }
+}
+
+bool
+GlobalRouteManagerLSDB::HasSameExtLSAs(const GlobalRouteManagerLSDB& other) const
+{
+    NS_LOG_FUNCTION(this << &other);
+    if (m_extdatabase.size() != other.m_extdatabase.size())
+    {
+        return false;
+    }
+    for (uint32_t j = 0; j < m_extdatabase.size(); j++)
+    {
+        if (!IsSameLSA(m_extdatabase[j], other.m_extdatabase[j], true))
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 // ---------------------------------------------------------------------------
@@ -537,7 +682,8 @@ GlobalRouteManagerLSDB::GetLSAByLinkData(Ipv4Address addr) const
 // ---------------------------------------------------------------------------
 
 GlobalRouteManagerImpl::GlobalRouteManagerImpl()
-    : m_spfroot(nullptr)
+    : m_spfroot(nullptr),
+      m_dependencies(nullptr)
 {
     NS_LOG_FUNCTION(this);
     m_lsdb = new GlobalRouteManagerLSDB();
@@ -589,6 +735,7 @@ GlobalRouteManagerImpl::DeleteGlobalRoutes()
         }
         NS_LOG_LOGIC("Deleted " << j << " global routes from node " << node->GetId());
     }
+    m_spfDependencies.clear();
     if (m_lsdb)
     {
         NS_LOG_LOGIC("Deleting LSDB, creating new one");
@@ -655,6 +802,112 @@ GlobalRouteManagerImpl::BuildGlobalRoutingDatabase()
     }
 }
 
+//
+// Rebuild the LSDB and only recompute the routes of the routers whose SPF
+// calculation may give another result.  SPFCalculate is deterministic, and it
+// only installs routes on the root node: if none of the LSDB lookups it made
+// the last time returns something else, it runs exactly the same way again.
+// The lookups are the LSAs of the vertices of the tree (the LSAs of the other
+// vertices are never read), the link data of the transit networks, and the
+// metrics of the link records examined by SPFNext: a record which was skipped
+// because it led to a vertex already in the tree is skipped whatever its
+// metric, and a record which was skipped because it led to a candidate with a
+// lower distance is skipped as long as its metric stays high enough.
+//
+void
+GlobalRouteManagerImpl::RecomputeRoutes()
+{
+    NS_LOG_FUNCTION(this);
+    GlobalRouteManagerLSDB* oldLsdb = m_lsdb;
+    m_lsdb = new GlobalRouteManagerLSDB();
+    BuildGlobalRoutingDatabase();
+
+    bool recomputeAll = !oldLsdb->HasSameExtLSAs(*m_lsdb);
+    std::set<Ipv4Address> modified;
+    std::set<Ipv4Address> modifiedLinkData;
+    std::vector<GlobalRouteManagerLSDB::MetricChange> metrics;
+    if (!recomputeAll)
+    {
+        oldLsdb->GetChanges(*m_lsdb, modified, modifiedLinkData, metrics);
+    }
+    delete oldLsdb;
+    NS_LOG_LOGIC(modified.size() << " LSAs modified, " << metrics.size() << " metrics changed");
+
+    uint32_t nRecomputed = 0;
+    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    {
+        Ptr<Node> node = *i;
+        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        if (!rtr)
+        {
+            continue;
+        }
+        Ipv4Address routerId = rtr->GetRouterId();
+        auto dependencies = m_spfDependencies.find(routerId);
+        if (dependencies != m_spfDependencies.end())
+        {
+            if (!recomputeAll &&
+                !IsAffected(dependencies->second, modified, modifiedLinkData, metrics))
+            {
+                continue;
+            }
+            m_spfDependencies.erase(dependencies);
+        }
+        Ptr<Ipv4GlobalRouting> gr = rtr->GetRoutingProtocol();
+        uint32_t nRoutes = gr->GetNRoutes();
+        NS_LOG_LOGIC("Deleting " << nRoutes << " routes from node " << node->GetId());
+        for (uint32_t j = 0; j < nRoutes; j++)
+        {
+            gr->RemoveRoute(0);
+        }
+        // Ignore nodes that are not assigned to our systemId (distributed sim)
+        if (node->GetSystemId() == Simulator::GetSystemId() && rtr->GetNumLSAs())
+        {
+            SPFCalculate(routerId);
+            nRecomputed++;
+        }
+    }
+    NS_LOG_INFO("Recomputed SPF for " << nRecomputed << " routers");
+}
+
+bool
+GlobalRouteManagerImpl::IsAffected(
+    const SPFDependencies& dependencies,
+    const std::set<Ipv4Address>& modified,
+    const std::set<Ipv4Address>& modifiedLinkData,
+    const std::vector<GlobalRouteManagerLSDB::MetricChange>& metrics)
+{
+    for (const auto& id : modified)
+    {
+        if (std::binary_search(dependencies.lsas.begin(), dependencies.lsas.end(), id))
+        {
+            return true;
+        }
+    }
+    for (const auto& linkData : modifiedLinkData)
+    {
+        if (std::binary_search(dependencies.linkData.begin(),
+                               dependencies.linkData.end(),
+                               linkData))
+        {
+            return true;
+        }
+    }
+    for (const auto& change : metrics)
+    {
+        uint64_t key = (static_cast<uint64_t>(change.linkStateId.Get()) << 32) | change.record;
+        auto record = std::lower_bound(dependencies.records.begin(),
+                                       dependencies.records.end(),
+                                       std::make_pair(key, uint32_t(0)));
+        if (record != dependencies.records.end() && record->first == key &&
+            change.metric < record->second)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 //
 // For each node that is a global router (which is determined by the presence
 // of an aggregated GlobalRouter interface), run the Dijkstra SPF calculation
@@ -811,6 +1064,7 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
         if (v->GetVertexType() == SPFVertex::VertexNetwork)
         {
             w_lsa = m_lsdb->GetLSAByLinkData(v->GetLSA()->GetAttachedRouter(i));
+            m_dependencies->linkData.push_back(v->GetLSA()->GetAttachedRouter(i));
             if (!w_lsa)
             {
                 continue;
@@ -850,6 +1104,16 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
 
         NS_LOG_LOGIC("Considering w_lsa " << w_lsa->GetLinkStateId());
 
+        //
+        // Record the link record for RecomputeRoutes: unless it is skipped
+        // below, any change of its metric may change the candidate list.
+        //
+        if (v->GetVertexType() == SPFVertex::VertexRouter)
+        {
+            uint64_t key = (static_cast<uint64_t>(v->GetLSA()->GetLinkStateId().Get()) << 32) | i;
+            m_dependencies->records.emplace_back(key, SPF_INFINITY);
+        }
+
         // Is there already vertex w in candidate list?
         if (w_lsa->GetStatus() == GlobalRoutingLSA::LSA_SPF_NOT_EXPLORED)
         {
@@ -900,8 +1164,14 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
             if (cw->GetDistanceFromRoot() < distance)
             {
                 //
-                // This is not a shorter path, so don't do anything.
+                // This is not a shorter path, so don't do anything.  Neither
+                // would any metric leading to a distance higher than cw's.
                 //
+                if (v->GetVertexType() == SPFVertex::VertexRouter)
+                {
+                    m_dependencies->records.back().second =
+                        cw->GetDistanceFromRoot() - v->GetDistanceFromRoot() + 1;
+                }
                 continue;
             }
             else if (cw->GetDistanceFromRoot() == distance)
@@ -1292,6 +1562,7 @@ GlobalRouteManagerImpl::CheckForStubNode(Ipv4Address root)
             // The link record LinkID is the router ID of the peer.
             // The Link Data is the local IP interface address
             GlobalRoutingLSA* w_lsa = m_lsdb->GetLSA(transitLink->GetLinkId());
+            m_dependencies->lsas.push_back(w_lsa->GetLinkStateId());
             uint32_t nLinkRecords = w_lsa->GetNLinkRecords();
             for (uint32_t j = 0; j < nLinkRecords; ++j)
             {
@@ -1339,6 +1610,13 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     //
     m_lsdb->Initialize();
     //
+    // Record the LSDB lookups of this calculation, which tell RecomputeRoutes
+    // whether a change of the LSDB may change its result.
+    //
+    m_dependencies = &m_spfDependencies[root];
+    *m_dependencies = SPFDependencies();
+    m_dependencies->lsas.push_back(root);
+    //
     // The candidate queue is a priority queue of SPFVertex objects, with the top
     // of the queue being the closest vertex in terms of distance from the root
     // of the tree.  Initially, this queue is empty.
@@ -1371,6 +1649,7 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     {
         NS_LOG_LOGIC("SPFCalculate truncated for stub node " << root);
         delete m_spfroot;
+        SortDependencies();
         return;
     }
 
@@ -1414,6 +1693,7 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
         NS_LOG_LOGIC(candidate);
         v = candidate.Pop();
         NS_LOG_LOGIC("Popped vertex " << v->GetVertexId());
+        m_dependencies->lsas.push_back(v->GetLSA()->GetLinkStateId());
         //
         // Update the status field of the vertex to indicate that it is in the SPF
         // tree.
@@ -1492,6 +1772,21 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     //
     delete m_spfroot;
     m_spfroot = nullptr;
+    SortDependencies();
+}
+
+void
+GlobalRouteManagerImpl::SortDependencies()
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<Ipv4Address>& lsas = m_dependencies->lsas;
+    std::sort(lsas.begin(), lsas.end());
+    lsas.erase(std::unique(lsas.begin(), lsas.end()), lsas.end());
+    std::vector<Ipv4Address>& linkData = m_dependencies->linkData;
+    std::sort(linkData.begin(), linkData.end());
+    linkData.erase(std::unique(linkData.begin(), linkData.end()), linkData.end());
+    std::sort(m_dependencies->records.begin(), m_dependencies->records.end());
+    m_dependencies = nullptr;
 }
 
 void
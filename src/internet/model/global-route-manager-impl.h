@@ -30,6 +30,7 @@
 #include <list>
 #include <map>
 #include <queue>
+#include <set>
 #include <stdint.h>
 #include <vector>
 
@@ -672,6 +673,47 @@ class GlobalRouteManagerLSDB
      */
     uint32_t GetNumExtLSAs() const;
 
+    /// Change of the metric of a point-to-point or transit network link record
+    struct MetricChange
+    {
+        Ipv4Address linkStateId; //!< link state ID of the Router-LSA
+        uint32_t record;         //!< index of the link record in the LSA
+        uint16_t metric;         //!< new metric of the link record
+    };
+
+    /**
+     * @brief Find the changes between this database and a newer one.
+     *
+     * An LSA which is added or removed, or whose content changes in any way
+     * other than the metrics of its link records, is modified.  The link data
+     * of the transit network link records of a modified LSA, before and after
+     * the change, are modified too, since GetLSAByLinkData may return another
+     * LSA for them.  The metric changes of the point-to-point and transit
+     * network link records of the LSAs which are not modified are listed
+     * separately; the metrics of the stub network link records are not used by
+     * the SPF calculation.
+     *
+     * External LSAs are not considered; see HasSameExtLSAs.
+     *
+     * @param other the newer database
+     * @param modified the link state IDs of the modified LSAs
+     * @param modifiedLinkData the modified link data
+     * @param metrics the metric changes
+     */
+    void GetChanges(const GlobalRouteManagerLSDB& other,
+                    std::set<Ipv4Address>& modified,
+                    std::set<Ipv4Address>& modifiedLinkData,
+                    std::vector<MetricChange>& metrics) const;
+
+    /**
+     * @brief Check whether another database holds the same External Link
+     * State Advertisements, in the same order.
+     *
+     * @param other the database to compare with
+     * @returns true if the External LSAs of both databases are identical
+     */
+    bool HasSameExtLSAs(const GlobalRouteManagerLSDB& other) const;
+
   private:
     typedef std::map<Ipv4Address, GlobalRoutingLSA*>
         LSDBMap_t; //!< container of IPv4 addresses / Link State Advertisements
@@ -679,6 +721,7 @@ class GlobalRouteManagerLSDB
         LSDBPair_t; //!< pair of IPv4 addresses / Link State Advertisements
 
     LSDBMap_t m_database; //!< database of IPv4 addresses / Link State Advertisements
+    LSDBMap_t m_linkDataIndex; //!< Router-LSAs indexed by the link data of their transit links
     std::vector<GlobalRoutingLSA*>
         m_extdatabase; //!< database of External Link State Advertisements
 };
@@ -725,6 +768,24 @@ class GlobalRouteManagerImpl
      */
     virtual void InitializeRoutes();
 
+    /**
+     * @brief Rebuild the routing database and recompute the routes of the
+     * routers affected by the changes since the last computation.
+     *
+     * A fresh LSDB is gathered and compared with the current one.  Each SPF
+     * calculation records the LSDB lookups it depends on: the LSAs of the
+     * vertices of its tree, the link data looked up for the transit networks,
+     * and, for each link record it examined, the metrics for which the
+     * record leaves the candidate list untouched.  A router whose last
+     * calculation depends on none of the changes would run exactly the same
+     * calculation again, so it keeps its routes; the other routers have their
+     * global routes deleted and their SPF tree recomputed.  Any change in the
+     * External LSAs triggers a full recomputation.  The resulting routing
+     * tables are the same as with DeleteGlobalRoutes (),
+     * BuildGlobalRoutingDatabase () and InitializeRoutes ().
+     */
+    virtual void RecomputeRoutes();
+
     /**
      * @brief Debugging routine; allow client code to supply a pre-built LSDB
      * @param lsdb the pre-built LSDB
@@ -738,8 +799,42 @@ class GlobalRouteManagerImpl
     void DebugSPFCalculate(Ipv4Address root);
 
   private:
+    /// LSDB lookups made by the SPF calculation of a root, see RecomputeRoutes
+    struct SPFDependencies
+    {
+        std::vector<Ipv4Address> lsas;     //!< sorted link state IDs of the LSAs of the tree
+        std::vector<Ipv4Address> linkData; //!< sorted link data of the transit networks
+        /**
+         * Link records examined from the LSAs of the tree, sorted by key (link
+         * state ID of the LSA in the high 32 bits, index of the record in the
+         * low 32 bits), with the lowest metric for which the record leaves the
+         * candidate list untouched (SPF_INFINITY if there is none).  The
+         * records which lead to a vertex already in the tree are not listed,
+         * since they are skipped whatever their metric.
+         */
+        std::vector<std::pair<uint64_t, uint32_t>> records;
+    };
+
     SPFVertex* m_spfroot;           //!< the root node
     GlobalRouteManagerLSDB* m_lsdb; //!< the Link State DataBase (LSDB) of the Global Route Manager
+    std::map<Ipv4Address, SPFDependencies>
+        m_spfDependencies;           //!< dependencies of the last SPF calculation of each root
+    SPFDependencies* m_dependencies; //!< dependencies of the running SPF calculation
+
+    /**
+     * \brief Check whether the last SPF calculation of a root depends on
+     * changes of the LSDB.
+     *
+     * \param dependencies the dependencies of the calculation
+     * \param modified the link state IDs of the modified LSAs
+     * \param modifiedLinkData the modified link data
+     * \param metrics the metric changes
+     * \returns true if the calculation may give another result
+     */
+    static bool IsAffected(const SPFDependencies& dependencies,
+                           const std::set<Ipv4Address>& modified,
+                           const std::set<Ipv4Address>& modifiedLinkData,
+                           const std::vector<GlobalRouteManagerLSDB::MetricChange>& metrics);
 
     /**
      * \brief Test if a node is a stub, from an OSPF sense.
@@ -761,6 +856,12 @@ class GlobalRouteManagerImpl
      */
     void SPFCalculate(Ipv4Address root);
 
+    /**
+     * \brief Sort the dependencies of the SPF calculation which just ended,
+     * and stop recording them.
+     */
+    void SortDependencies();
+
     /**
      * \brief Process Stub nodes
      *
@@ -70,6 +70,12 @@ class GlobalRouteManager
      * per-node forwarding tables
      */
     static void InitializeRoutes();
+
+    /**
+     * @brief Rebuild the routing database and recompute the routes of the
+     * nodes affected by the changes since the last computation
+     */
+    static void RecomputeRoutes();
 };
 
 } // namespace ns3
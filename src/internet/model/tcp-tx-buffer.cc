@@ -81,6 +81,11 @@ TcpTxBuffer::~TcpTxBuffer()
         m_size -= item->m_packet->GetSize();
         delete item;
     }
+
+    for (auto item : m_freeItems)
+    {
+        delete item;
+    }
 }
 
 SequenceNumber32
@@ -187,7 +192,7 @@ TcpTxBuffer::Add(Ptr<Packet> p)
     {
         if (p->GetSize() > 0)
         {
-            auto item = new TcpTxItem();
+            auto item = AllocateItem();
             item->m_packet = p->Copy();
             m_appList.insert(m_appList.end(), item);
             m_size += p->GetSize();
@@ -290,12 +295,12 @@ TcpTxBuffer::GetNewSegment(uint32_t numBytes)
     TcpTxItem* item = GetPacketFromList(m_appList, startOfAppList, numBytes, startOfAppList);
     item->m_startSeq = startOfAppList;
 
-    // Move item from AppList to SentList (should be the first, not too complex)
-    auto it = std::find(m_appList.begin(), m_appList.end(), item);
-    NS_ASSERT(it != m_appList.end());
+    // Move item from AppList to SentList. The requested data starts at the
+    // beginning of the AppList, hence the item is always the first one
+    NS_ASSERT(m_appList.front() == item);
 
-    m_appList.erase(it);
-    m_sentList.insert(m_sentList.end(), item);
+    m_appList.pop_front();
+    m_sentList.push_back(item);
     m_sentSize += item->m_packet->GetSize();
 
     return item;
@@ -467,7 +472,7 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                 NS_LOG_INFO("we are at " << beginOfCurrentPacket << " searching for " << seq
                                          << " and now we recurse because packet ends at "
                                          << beginOfCurrentPacket + currentPacket->GetSize());
-                auto firstPart = new TcpTxItem();
+                auto firstPart = AllocateItem();
                 SplitItems(firstPart, currentItem, seq - beginOfCurrentPacket);
 
                 // insert firstPart before currentItem
@@ -520,7 +525,7 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                     list.erase(it);
 
                     MergeItems(previous, currentItem);
-                    delete currentItem;
+                    ReleaseItem(currentItem);
                     if (listEdited)
                     {
                         *listEdited = true;
@@ -533,7 +538,7 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
             {
                 // the end is inside the current packet, but it isn't exactly
                 // the packet end. Just fragment, fix the list, and return.
-                auto firstPart = new TcpTxItem();
+                auto firstPart = AllocateItem();
                 SplitItems(firstPart, currentItem, numBytes);
 
                 // insert firstPart before currentItem
@@ -568,7 +573,7 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
             MergeItems(currentItem, next);
             list.erase(it);
 
-            delete next;
+            ReleaseItem(next);
 
             if (listEdited)
             {
@@ -624,6 +629,26 @@ TcpTxBuffer::MergeItems(TcpTxItem* t1, TcpTxItem* t2) const
     NS_LOG_INFO("Situation after the merge: " << *t1);
 }
 
+TcpTxItem*
+TcpTxBuffer::AllocateItem() const
+{
+    if (m_freeItems.empty())
+    {
+        return new TcpTxItem();
+    }
+    TcpTxItem* item = m_freeItems.back();
+    m_freeItems.pop_back();
+    return item;
+}
+
+void
+TcpTxBuffer::ReleaseItem(TcpTxItem* item) const
+{
+    // Reset the item (and drop the reference to its packet) before keeping it
+    *item = TcpTxItem();
+    m_freeItems.push_back(item);
+}
+
 void
 TcpTxBuffer::RemoveFromCounts(TcpTxItem* item, uint32_t size)
 {
@@ -658,6 +683,11 @@ TcpTxBuffer::IsRetransmittedDataAcked(const SequenceNumber32& ack) const
         {
             return true;
         }
+        if (item->m_startSeq >= ack)
+        {
+            // The sent list is sorted by sequence number: no other item can end at ack
+            break;
+        }
     }
     return false;
 }
@@ -717,7 +747,7 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
                 beforeDelCb(item);
             }
 
-            delete item;
+            ReleaseItem(item);
         }
         else if (offset > 0)
         { // Part of the packet is behind the seqnum. Fragment
@@ -788,7 +818,7 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
 
     for (auto option_it = list.begin(); option_it != list.end(); ++option_it)
     {
-        auto item_it = m_sentList.begin();
+        auto item_it = m_sentList.cbegin();
         SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
 
         if (m_firstByteSeq + m_sentSize < (*option_it).first)
@@ -797,7 +827,15 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
             return bytesSacked;
         }
 
-        while (item_it != m_sentList.end())
+        if (m_highestSack.first != m_sentList.cend() && m_highestSack.second <= (*option_it).first)
+        {
+            // The items before the highest sacked one end before the beginning of
+            // this block, hence none of them can be mapped over it: skip them
+            item_it = m_highestSack.first;
+            beginOfCurrentPacket = m_highestSack.second;
+        }
+
+        while (item_it != m_sentList.cend())
         {
             uint32_t pktSize = (*item_it)->m_packet->GetSize();
 
@@ -28,6 +28,8 @@
 #include "ns3/sequence-number.h"
 #include "ns3/traced-value.h"
 
+#include <vector>
+
 namespace ns3
 {
 class Packet;
@@ -578,6 +580,23 @@ class TcpTxBuffer : public Object
      */
     void MergeItems(TcpTxItem* t1, TcpTxItem* t2) const;
 
+    /**
+     * \brief Get a new item, reusing a previously released one when possible
+     *
+     * Items are split and merged on almost every transmission; recycling them
+     * avoids a heap allocation for each of these operations.
+     *
+     * \return an item with all the fields set to their default value
+     */
+    TcpTxItem* AllocateItem() const;
+
+    /**
+     * \brief Release an item that is no longer part of any list
+     *
+     * \param item the item to release
+     */
+    void ReleaseItem(TcpTxItem* item) const;
+
     /**
      * \brief Split one TcpTxItem
      *
@@ -622,6 +641,8 @@ class TcpTxBuffer : public Object
     bool m_renoSack{false};     //!< Indicates if AddRenoSack was called
     bool m_sackEnabled{true};   //!< Indicates if SACK is enabled on this connection
 
+    mutable std::vector<TcpTxItem*> m_freeItems; //!< Released items, ready to be reused
+
     static Callback<void, TcpTxItem*> m_nullCb; //!< Null callback for an item
 };
 
@@ -16,6 +16,7 @@
 #include "ns3/boolean.h"
 #include "ns3/bridge-helper.h"
 #include "ns3/config.h"
+#include "ns3/global-route-manager.h"
 #include "ns3/inet-socket-address.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
@@ -41,6 +42,8 @@
 #include "ns3/udp-socket-factory.h"
 #include "ns3/uinteger.h"
 
+#include <sstream>
+#include <string>
 #include <vector>
 
 using namespace ns3;
@@ -1311,6 +1314,205 @@ Ipv4GlobalRoutingSlash32TestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv4 GlobalRouting incremental recomputation test
+ *
+ * A ring of four routers n0-n1-n2-n3-n0 is built, with unit metrics.  The
+ * metric of the n0-n1 link is first raised on n0's side: only the routers
+ * whose shortest-path trees may use that link from n0 to n1, i.e., n0 and n3,
+ * must be recomputed.  The n0-n1 link then goes down on n0's side.  After
+ * each change, the incremental recomputation must yield the same routing
+ * tables as a full recomputation.
+ *
+ * Whether a router is recomputed is checked with a host route added by hand
+ * before the recomputation: it is only removed from the routers whose global
+ * routes are deleted.
+ */
+class Ipv4GlobalRoutingIncrementalTestCase : public TestCase
+{
+  public:
+    Ipv4GlobalRoutingIncrementalTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Add the marker host route to each node.
+     */
+    void AddMarkers();
+
+    /**
+     * \brief Remove the marker host route from the nodes which still have it.
+     * \return for each node, whether it still had the marker route.
+     */
+    std::vector<bool> RemoveMarkers();
+
+    /**
+     * \brief Dump the global routing table of each node.
+     * \return one string per node, describing its routes.
+     */
+    std::vector<std::string> GetRoutingTables() const;
+
+    /**
+     * \brief Check the tables given by an incremental recomputation against a
+     * full recomputation.
+     * \param incremental the tables given by the incremental recomputation.
+     * \param step the name of the change.
+     */
+    void CheckFullRecomputation(const std::vector<std::string>& incremental,
+                                const std::string& step);
+
+    NodeContainer m_nodes; //!< Nodes used in the test.
+    Ipv4Address m_marker;  //!< Destination of the marker host route.
+};
+
+Ipv4GlobalRoutingIncrementalTestCase::Ipv4GlobalRoutingIncrementalTestCase()
+    : TestCase("Incremental recomputation of the global routes"),
+      m_marker("192.168.0.1")
+{
+}
+
+void
+Ipv4GlobalRoutingIncrementalTestCase::AddMarkers()
+{
+    for (uint32_t i = 0; i < m_nodes.GetN(); i++)
+    {
+        Ptr<Ipv4> ipv4 = m_nodes.Get(i)->GetObject<Ipv4>();
+        Ptr<Ipv4GlobalRouting> routing =
+            ipv4->GetRoutingProtocol()->GetObject<Ipv4GlobalRouting>();
+        routing->AddHostRouteTo(m_marker, 1);
+    }
+}
+
+std::vector<bool>
+Ipv4GlobalRoutingIncrementalTestCase::RemoveMarkers()
+{
+    std::vector<bool> found;
+    for (uint32_t i = 0; i < m_nodes.GetN(); i++)
+    {
+        Ptr<Ipv4> ipv4 = m_nodes.Get(i)->GetObject<Ipv4>();
+        Ptr<Ipv4GlobalRouting> routing =
+            ipv4->GetRoutingProtocol()->GetObject<Ipv4GlobalRouting>();
+        found.push_back(false);
+        for (uint32_t j = 0; j < routing->GetNRoutes(); j++)
+        {
+            if (routing->GetRoute(j)->GetDest() == m_marker)
+            {
+                routing->RemoveRoute(j);
+                found.back() = true;
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+std::vector<std::string>
+Ipv4GlobalRoutingIncrementalTestCase::GetRoutingTables() const
+{
+    std::vector<std::string> tables;
+    for (uint32_t i = 0; i < m_nodes.GetN(); i++)
+    {
+        Ptr<Ipv4RoutingProtocol> proto = m_nodes.Get(i)->GetObject<Ipv4>()->GetRoutingProtocol();
+        Ptr<Ipv4GlobalRouting> routing = proto->GetObject<Ipv4GlobalRouting>();
+        std::ostringstream oss;
+        for (uint32_t j = 0; j < routing->GetNRoutes(); j++)
+        {
+            oss << *routing->GetRoute(j) << "\n";
+        }
+        tables.push_back(oss.str());
+    }
+    return tables;
+}
+
+void
+Ipv4GlobalRoutingIncrementalTestCase::CheckFullRecomputation(
+    const std::vector<std::string>& incremental,
+    const std::string& step)
+{
+    GlobalRouteManager::DeleteGlobalRoutes();
+    GlobalRouteManager::BuildGlobalRoutingDatabase();
+    GlobalRouteManager::InitializeRoutes();
+    std::vector<std::string> full = GetRoutingTables();
+    for (uint32_t i = 0; i < m_nodes.GetN(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(incremental[i],
+                              full[i],
+                              "Incremental and full recomputation differ on node "
+                                  << i << " after " << step);
+    }
+}
+
+void
+Ipv4GlobalRoutingIncrementalTestCase::DoRun()
+{
+    m_nodes.Create(4);
+
+    InternetStackHelper internet;
+    Ipv4GlobalRoutingHelper ipv4RoutingHelper;
+    internet.SetRoutingHelper(ipv4RoutingHelper);
+    internet.Install(m_nodes);
+
+    // ring n0-n1-n2-n3-n0: interface 1 of n0 is on the n0-n1 link
+    std::vector<std::pair<uint32_t, uint32_t>> links = {{0, 1}, {1, 2}, {2, 3}, {3, 0}};
+    SimpleNetDeviceHelper simpleHelper;
+    simpleHelper.SetNetDevicePointToPointMode(true);
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.252");
+    for (const auto& link : links)
+    {
+        NetDeviceContainer net =
+            simpleHelper.Install(NodeContainer(m_nodes.Get(link.first), m_nodes.Get(link.second)),
+                                 CreateObject<SimpleChannel>());
+        ipv4.Assign(net);
+        ipv4.NewNetwork();
+    }
+
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+    std::vector<std::string> before = GetRoutingTables();
+    Ptr<Ipv4> ipv40 = m_nodes.Get(0)->GetObject<Ipv4>();
+
+    // raise the metric of the n0-n1 link on n0's side: n1 and n2 reach n0
+    // without going from n0 to n1, and they never reach n1 through n0
+    ipv40->SetMetric(1, 5);
+    AddMarkers();
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    std::vector<bool> kept = RemoveMarkers();
+    std::vector<std::string> incremental = GetRoutingTables();
+    NS_TEST_ASSERT_MSG_EQ(kept[0], false, "Routes of n0 have not been recomputed");
+    NS_TEST_ASSERT_MSG_EQ(kept[1], true, "Routes of n1 should not be recomputed");
+    NS_TEST_ASSERT_MSG_EQ(kept[2], true, "Routes of n2 should not be recomputed");
+    NS_TEST_ASSERT_MSG_EQ(kept[3], false, "Routes of n3 have not been recomputed");
+    NS_TEST_ASSERT_MSG_NE(before[3], incremental[3], "n3 should not reach n1 through n0");
+    CheckFullRecomputation(incremental, "the metric change");
+
+    // bring down the n0-n1 link on n0's side: the addresses of the link are no
+    // longer advertised by n0, so every router is recomputed
+    ipv40->SetDown(1);
+    AddMarkers();
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    kept = RemoveMarkers();
+    incremental = GetRoutingTables();
+    for (uint32_t i = 0; i < m_nodes.GetN(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(kept[i], false, "Routes of n" << i << " have not been recomputed");
+    }
+    CheckFullRecomputation(incremental, "the link going down");
+
+    // a recomputation without any change keeps every route
+    AddMarkers();
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    kept = RemoveMarkers();
+    for (uint32_t i = 0; i < m_nodes.GetN(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(kept[i], true, "Routes of n" << i << " should not be recomputed");
+    }
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup internet-test
  *
@@ -1333,6 +1535,7 @@ Ipv4GlobalRoutingTestSuite::Ipv4GlobalRoutingTestSuite()
     AddTestCase(new TwoBridgeTest, TestCase::QUICK);
     AddTestCase(new Ipv4DynamicGlobalRoutingTestCase, TestCase::QUICK);
     AddTestCase(new Ipv4GlobalRoutingSlash32TestCase, TestCase::QUICK);
+    AddTestCase(new Ipv4GlobalRoutingIncrementalTestCase, TestCase::QUICK);
 }
 
 static Ipv4GlobalRoutingTestSuite
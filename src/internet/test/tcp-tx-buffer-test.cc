@@ -20,6 +20,7 @@
 #include "ns3/tcp-tx-buffer.h"
 #include "ns3/test.h"
 
+#include <chrono>
 #include <limits>
 
 using namespace ns3;
@@ -430,6 +431,122 @@ TcpTxBufferTestCase::DoTeardown()
 {
 }
 
+/**
+ * \ingroup internet-tests
+ * \ingroup tests
+ *
+ * \brief Bulk transfer through a TcpTxBuffer
+ *
+ * Emulates a long-lived bulk flow that keeps a full window in flight, with a
+ * segment lost periodically and recovered through SACK. The throughput of the
+ * buffer operations is logged (NS_LOG="TcpTxBufferTestSuite=info").
+ */
+class TcpTxBufferBulkTestCase : public TestCase
+{
+  public:
+    /** \brief Constructor */
+    TcpTxBufferBulkTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Callback to provide a value of receiver window
+     * \returns the receiver window size
+     */
+    uint32_t GetRWnd() const;
+};
+
+TcpTxBufferBulkTestCase::TcpTxBufferBulkTestCase()
+    : TestCase("TcpTxBuffer bulk transfer with SACK recovery")
+{
+}
+
+uint32_t
+TcpTxBufferBulkTestCase::GetRWnd() const
+{
+    // Assume unlimited receiver window
+    return std::numeric_limits<uint32_t>::max();
+}
+
+void
+TcpTxBufferBulkTestCase::DoRun()
+{
+    const uint32_t segmentSize = 1000;
+    const uint32_t window = 100;         // Segments in flight
+    const uint32_t numSegments = 100000; // Segments to transfer
+    const uint32_t lossInterval = 20;    // One window every lossInterval has a lost head
+
+    Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer>();
+    txBuf->SetRWndCallback(MakeCallback(&TcpTxBufferBulkTestCase::GetRWnd, this));
+    txBuf->SetMaxBufferSize(2 * window * segmentSize);
+    txBuf->SetSegmentSize(segmentSize);
+    txBuf->SetDupAckThresh(3);
+    const SequenceNumber32 head(1);
+    txBuf->SetHeadSequence(head);
+
+    SequenceNumber32 nextTx = head;
+    uint32_t added = 0;
+    uint32_t rounds = 0;
+    uint32_t recoveries = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    while (txBuf->HeadSequence() < head + numSegments * segmentSize)
+    {
+        while (added < numSegments && txBuf->Available() >= segmentSize)
+        {
+            txBuf->Add(Create<Packet>(segmentSize));
+            ++added;
+        }
+
+        // Fill the window with new data
+        while (nextTx < txBuf->HeadSequence() + window * segmentSize &&
+               txBuf->SizeFromSequence(nextTx) > 0)
+        {
+            TcpTxItem* item = txBuf->CopyFromSequence(segmentSize, nextTx);
+            NS_TEST_ASSERT_MSG_NE(item, nullptr, "No data returned for new segment " << nextTx);
+            nextTx += item->GetSeqSize();
+        }
+
+        SequenceNumber32 una = txBuf->HeadSequence();
+        auto inFlight = static_cast<uint32_t>(nextTx - una) / segmentSize;
+        if (++rounds % lossInterval == 0 && inFlight > 4)
+        {
+            // The head is lost: every following segment triggers a dupack
+            // carrying an ever-growing SACK block
+            for (uint32_t i = 1; i < inFlight; ++i)
+            {
+                TcpOptionSack::SackList list;
+                list.emplace_back(una + segmentSize, una + (i + 1) * segmentSize);
+                txBuf->Update(list);
+            }
+            NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(una), true, "The head should be lost");
+            NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(),
+                                  (inFlight - 1) * segmentSize,
+                                  "Wrong number of sacked bytes");
+
+            // Retransmit the head, then the cumulative ACK covers the whole window
+            TcpTxItem* item = txBuf->CopyFromSequence(segmentSize, una);
+            NS_TEST_ASSERT_MSG_EQ(item->IsRetrans(), true, "The head should be retransmitted");
+            txBuf->DiscardUpTo(nextTx);
+            NS_TEST_ASSERT_MSG_EQ(txBuf->BytesInFlight(), 0, "Nothing should be in flight");
+            ++recoveries;
+        }
+        else
+        {
+            txBuf->DiscardUpTo(una + segmentSize);
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Size(), 0, "The buffer should be empty");
+    NS_TEST_ASSERT_MSG_GT(recoveries, 0, "No loss recovery was exercised");
+    NS_LOG_INFO("Transferred " << numSegments << " segments (" << recoveries << " recoveries) in "
+                               << elapsed.count() << " s: "
+                               << numSegments * segmentSize * 8 / elapsed.count() / 1e6
+                               << " Mbit/s");
+}
+
 /**
  * \ingroup internet-test
  *
@@ -442,6 +559,7 @@ class TcpTxBufferTestSuite : public TestSuite
         : TestSuite("tcp-tx-buffer", UNIT)
     {
         AddTestCase(new TcpTxBufferTestCase, TestCase::QUICK);
+        AddTestCase(new TcpTxBufferBulkTestCase, TestCase::EXTENSIVE);
     }
 };
 
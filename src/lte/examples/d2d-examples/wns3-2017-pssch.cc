@@ -42,6 +42,10 @@
 #include "ns3/network-module.h"
 #include "ns3/point-to-point-module.h"
 
+#ifndef __WIN32__
+#include "ns3/parameter-sweep.h"
+#endif
+
 #include <cfloat>
 #include <sstream>
 
@@ -56,14 +60,26 @@ Parameters include:
 - rbSize: allocation size in resource block (RB)
 - simTime: Simulation time in seconds
 - SlRxOutputFilename: Name of the file where the Sidelink RxPhy results will be saved
+
+Several configurations can be run in parallel with the ParameterSweep arguments (except on
+Windows), e.g.,
+  ./ns3 run "wns3-2017-pssch --simTime=10 --sweepFile=configs.txt --sweepJobs=8"
+where each line of configs.txt is a configuration name followed by its arguments, e.g.,
+  Config1-rb2 --period=sf40 --pscchLength=8 --mcs=10 --ktrp=2 --rbSize=2
 */
 
 NS_LOG_COMPONENT_DEFINE("wns3-2017-pssch");
 
 using namespace ns3;
 
-int
-main(int argc, char* argv[])
+/**
+ * Run a simulation.
+ * \param argc the number of command line arguments
+ * \param argv the command line arguments
+ * \return the exit status
+ */
+static int
+RunSimulation(int argc, char* argv[])
 {
     uint32_t mcs = 10;        // Modulation and Coding Scheme
     uint32_t rbSize = 2;      // PSSCH subchannel allocation size in RBs
@@ -263,3 +279,14 @@ main(int argc, char* argv[])
 
     return 0;
 }
+
+int
+main(int argc, char* argv[])
+{
+#ifndef __WIN32__
+    return ParameterSweep::Main(argc, argv, &RunSimulation);
+#else
+    // ParameterSweep is not available on Windows: run a single simulation
+    return RunSimulation(argc, argv);
+#endif
+}
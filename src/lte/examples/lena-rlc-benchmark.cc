@@ -0,0 +1,200 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the processing cost of a pair of RLC entities
+// (UM or AM) under a high offered load.  A transmitting RLC entity is
+// filled with SDUs, and every TTI it is given a transmission opportunity
+// whose PDUs are directly delivered to a receiving RLC entity; the control
+// PDUs of the receiving entity (AM STATUS PDUs) are delivered back to the
+// transmitting one.  No PHY or MAC is involved, so that the wall-clock
+// time reflects the cost of the RLC buffers, segmentation and reassembly.
+//
+// Usage example:
+//   ./ns3 run "lena-rlc-benchmark --rlc=um --sdus=100000 --bytesPerTti=10000"
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/network-module.h"
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaRlcBenchmark");
+
+/**
+ * MAC SAP provider storing the PDUs transmitted by an RLC entity,
+ * until they are delivered to the peer RLC entity.
+ */
+class BenchmarkMacSapProvider : public LteMacSapProvider
+{
+  public:
+    void TransmitPdu(TransmitPduParameters params) override
+    {
+        m_pdus.push_back(params.pdu);
+    }
+
+    void ReportBufferStatus(ReportBufferStatusParameters params [[maybe_unused]]) override
+    {
+    }
+
+    std::vector<Ptr<Packet>> m_pdus; //!< PDUs waiting to be delivered to the peer
+};
+
+/**
+ * RLC SAP user counting the received SDUs.
+ */
+class BenchmarkRlcSapUser : public LteRlcSapUser
+{
+  public:
+    void ReceivePdcpPdu(Ptr<Packet> p) override
+    {
+        m_rxSdus++;
+        m_rxBytes += p->GetSize();
+    }
+
+    uint64_t m_rxSdus{0};  //!< number of received SDUs
+    uint64_t m_rxBytes{0}; //!< number of received bytes
+};
+
+/**
+ * Give a transmission opportunity to an RLC entity and deliver its PDUs to the peer entity.
+ * \param from the transmitting RLC entity
+ * \param fromMac the MAC SAP provider of the transmitting RLC entity
+ * \param to the receiving RLC entity
+ * \param bytes the size of the transmission opportunity
+ */
+static void
+Transfer(Ptr<LteRlc> from, BenchmarkMacSapProvider* fromMac, Ptr<LteRlc> to, uint32_t bytes)
+{
+    from->GetLteMacSapUser()->NotifyTxOpportunity(
+        LteMacSapUser::TxOpportunityParameters(bytes, 0, 0, 0, 1, 3));
+    for (const auto& pdu : fromMac->m_pdus)
+    {
+        // the constructor leaves the L2 IDs uninitialized, and a non-zero
+        // destination marks a Sidelink PDU
+        LteMacSapUser::ReceivePduParameters params(pdu, 1, 3);
+        params.srcL2Id = 0;
+        params.dstL2Id = 0;
+        to->GetLteMacSapUser()->ReceivePdu(params);
+    }
+    fromMac->m_pdus.clear();
+}
+
+/**
+ * Exchange the PDUs of a TTI between the two RLC entities and schedule the next TTI.
+ * \param tx the transmitting RLC entity
+ * \param txMac the MAC SAP provider of the transmitting RLC entity
+ * \param rx the receiving RLC entity
+ * \param rxMac the MAC SAP provider of the receiving RLC entity
+ * \param bytesPerTti the size of the transmission opportunity of each TTI
+ */
+static void
+Tti(Ptr<LteRlc> tx,
+    BenchmarkMacSapProvider* txMac,
+    Ptr<LteRlc> rx,
+    BenchmarkMacSapProvider* rxMac,
+    uint32_t bytesPerTti)
+{
+    Transfer(tx, txMac, rx, bytesPerTti);
+    Transfer(rx, rxMac, tx, bytesPerTti);
+    Simulator::Schedule(MilliSeconds(1), &Tti, tx, txMac, rx, rxMac, bytesPerTti);
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string rlc = "um";
+    uint32_t sdus = 20000;
+    uint32_t sduSize = 1000;
+    uint32_t bytesPerTti = 10000;
+    double simTime = 5;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("rlc", "RLC mode, um or am", rlc);
+    cmd.AddValue("sdus", "Number of SDUs offered to the RLC at the start", sdus);
+    cmd.AddValue("sduSize", "Size of the SDUs in bytes", sduSize);
+    cmd.AddValue("bytesPerTti", "Size of the transmission opportunity of each TTI", bytesPerTti);
+    cmd.AddValue("simTime", "Simulated time in seconds", simTime);
+    cmd.Parse(argc, argv);
+
+    ObjectFactory factory;
+    if (rlc == "um")
+    {
+        factory.SetTypeId(LteRlcUm::GetTypeId());
+    }
+    else if (rlc == "am")
+    {
+        factory.SetTypeId(LteRlcAm::GetTypeId());
+    }
+    else
+    {
+        NS_FATAL_ERROR("Unknown RLC mode " << rlc);
+    }
+    // do not drop any of the offered SDUs
+    factory.Set("MaxTxBufferSize", UintegerValue(std::numeric_limits<uint32_t>::max()));
+
+    BenchmarkMacSapProvider txMac;
+    BenchmarkMacSapProvider rxMac;
+    BenchmarkRlcSapUser txPdcp;
+    BenchmarkRlcSapUser rxPdcp;
+    Ptr<LteRlc> tx = factory.Create<LteRlc>();
+    Ptr<LteRlc> rx = factory.Create<LteRlc>();
+    for (auto [entity, mac, pdcp] : {std::make_tuple(tx, &txMac, &txPdcp),
+                                     std::make_tuple(rx, &rxMac, &rxPdcp)})
+    {
+        entity->SetRnti(1);
+        entity->SetLcId(3);
+        entity->SetLteMacSapProvider(mac);
+        entity->SetLteRlcSapUser(pdcp);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < sdus; i++)
+    {
+        LteRlcSapProvider::TransmitPdcpPduParameters params;
+        params.pdcpPdu = Create<Packet>(sduSize);
+        params.rnti = 1;
+        params.lcid = 3;
+        params.srcL2Id = 0;
+        params.dstL2Id = 0;
+        tx->GetLteRlcSapProvider()->TransmitPdcpPdu(params);
+    }
+    std::chrono::duration<double> enqueue = std::chrono::steady_clock::now() - start;
+
+    Simulator::Schedule(MilliSeconds(1), &Tti, tx, &txMac, rx, &rxMac, bytesPerTti);
+    Simulator::Stop(Seconds(simTime));
+    start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    std::chrono::duration<double> run = std::chrono::steady_clock::now() - start;
+
+    std::cout << "RLC " << rlc << ": " << sdus << " SDUs of " << sduSize << " bytes offered, "
+              << rxPdcp.m_rxSdus << " SDUs (" << rxPdcp.m_rxBytes << " bytes) delivered"
+              << std::endl;
+    std::cout << "Enqueue time: " << enqueue.count() << " s" << std::endl;
+    std::cout << "Transfer time: " << run.count() << " s";
+    if (run.count() > 0)
+    {
+        std::cout << " (" << rxPdcp.m_rxSdus / run.count() << " SDUs/s)";
+    }
+    std::cout << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
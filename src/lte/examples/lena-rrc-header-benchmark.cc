@@ -0,0 +1,182 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the cost of the ASN.1 serialization of the RRC
+// headers used by the real RRC protocol (UseIdealRrc=false): a
+// RrcConnectionReconfiguration message carrying a measurement configuration
+// and several data radio bearers, and the MIB-SL sent by the SyncRef UEs.
+// Each header is serialized into a packet and deserialized from it, and the
+// number of round trips per second is reported.
+//
+// Usage example:
+//   ./ns3 run "lena-rrc-header-benchmark --messages=100000 --drbs=8"
+
+#include "ns3/abort.h"
+#include "ns3/command-line.h"
+#include "ns3/lte-rrc-header.h"
+#include "ns3/packet.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * Create the RrcConnectionReconfiguration message of the benchmark.
+ * \param drbs the number of data radio bearers to add
+ * \return the message
+ */
+static LteRrcSap::RrcConnectionReconfiguration
+CreateReconfiguration(uint32_t drbs)
+{
+    LteRrcSap::RrcConnectionReconfiguration msg;
+    msg.rrcTransactionIdentifier = 2;
+
+    msg.haveMeasConfig = true;
+    msg.measConfig.haveQuantityConfig = true;
+    msg.measConfig.quantityConfig.filterCoefficientRSRP = 4;
+    msg.measConfig.quantityConfig.filterCoefficientRSRQ = 4;
+    msg.measConfig.haveMeasGapConfig = false;
+    msg.measConfig.haveSmeasure = false;
+    msg.measConfig.haveSpeedStatePars = false;
+
+    LteRrcSap::MeasObjectToAddMod measObject;
+    measObject.measObjectId = 1;
+    measObject.measObjectEutra.carrierFreq = 100;
+    measObject.measObjectEutra.allowedMeasBandwidth = 50;
+    measObject.measObjectEutra.presenceAntennaPort1 = false;
+    measObject.measObjectEutra.neighCellConfig = 0;
+    measObject.measObjectEutra.offsetFreq = 0;
+    measObject.measObjectEutra.haveCellForWhichToReportCGI = false;
+    msg.measConfig.measObjectToAddModList.push_back(measObject);
+
+    LteRrcSap::ReportConfigToAddMod reportConfig;
+    reportConfig.reportConfigId = 1;
+    reportConfig.reportConfigEutra.triggerType = LteRrcSap::ReportConfigEutra::EVENT;
+    reportConfig.reportConfigEutra.eventId = LteRrcSap::ReportConfigEutra::EVENT_A3;
+    reportConfig.reportConfigEutra.a3Offset = 0;
+    reportConfig.reportConfigEutra.reportOnLeave = false;
+    reportConfig.reportConfigEutra.hysteresis = 6;
+    reportConfig.reportConfigEutra.timeToTrigger = 256;
+    reportConfig.reportConfigEutra.purpose = LteRrcSap::ReportConfigEutra::REPORT_STRONGEST_CELLS;
+    reportConfig.reportConfigEutra.triggerQuantity = LteRrcSap::ReportConfigEutra::RSRP;
+    reportConfig.reportConfigEutra.reportQuantity = LteRrcSap::ReportConfigEutra::BOTH;
+    reportConfig.reportConfigEutra.maxReportCells = 4;
+    reportConfig.reportConfigEutra.reportInterval = LteRrcSap::ReportConfigEutra::MS480;
+    reportConfig.reportConfigEutra.reportAmount = 255;
+    msg.measConfig.reportConfigToAddModList.push_back(reportConfig);
+
+    LteRrcSap::MeasIdToAddMod measId;
+    measId.measId = 1;
+    measId.measObjectId = 1;
+    measId.reportConfigId = 1;
+    msg.measConfig.measIdToAddModList.push_back(measId);
+
+    msg.haveMobilityControlInfo = false;
+
+    msg.haveRadioResourceConfigDedicated = true;
+    LteRrcSap::RadioResourceConfigDedicated& rrcd = msg.radioResourceConfigDedicated;
+    for (uint32_t i = 0; i < drbs; i++)
+    {
+        LteRrcSap::DrbToAddMod drb;
+        drb.epsBearerIdentity = 5 + i;
+        drb.drbIdentity = 1 + i;
+        drb.logicalChannelIdentity = 3 + i;
+        drb.rlcConfig.choice = LteRrcSap::RlcConfig::UM_BI_DIRECTIONAL;
+        drb.logicalChannelConfig.priority = 7;
+        drb.logicalChannelConfig.prioritizedBitRateKbps = 256;
+        drb.logicalChannelConfig.bucketSizeDurationMs = 100;
+        drb.logicalChannelConfig.logicalChannelGroup = 2;
+        rrcd.drbToAddModList.push_back(drb);
+    }
+    rrcd.havePhysicalConfigDedicated = true;
+    rrcd.physicalConfigDedicated.haveSoundingRsUlConfigDedicated = true;
+    rrcd.physicalConfigDedicated.soundingRsUlConfigDedicated.type =
+        LteRrcSap::SoundingRsUlConfigDedicated::SETUP;
+    rrcd.physicalConfigDedicated.soundingRsUlConfigDedicated.srsBandwidth = 0;
+    rrcd.physicalConfigDedicated.soundingRsUlConfigDedicated.srsConfigIndex = 15;
+    rrcd.physicalConfigDedicated.haveAntennaInfoDedicated = true;
+    rrcd.physicalConfigDedicated.antennaInfo.transmissionMode = 0;
+    rrcd.physicalConfigDedicated.havePdschConfigDedicated = true;
+    rrcd.physicalConfigDedicated.pdschConfigDedicated.pa = LteRrcSap::PdschConfigDedicated::dB0;
+
+    msg.haveNonCriticalExtension = false;
+    msg.haveSlCommConfig = false;
+    msg.haveSlDiscConfig = false;
+    return msg;
+}
+
+/**
+ * Serialize a header into a packet and deserialize it, a number of times,
+ * and print the number of round trips per second.
+ * \param name the name of the header
+ * \param source the header to serialize
+ * \param messages the number of round trips
+ * \return the header deserialized by the last round trip
+ */
+template <class T>
+static T
+Run(const std::string& name, const T& source, uint32_t messages)
+{
+    T destination;
+    uint32_t size = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < messages; i++)
+    {
+        // copy the header, so that each round trip serializes it again
+        T header = source;
+        Ptr<Packet> packet = Create<Packet>();
+        packet->AddHeader(header);
+        size = packet->GetSize();
+        packet->RemoveHeader(destination);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << name << " (" << size << " bytes): " << messages / elapsed.count()
+              << " round trips/s" << std::endl;
+    return destination;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t messages = 20000;
+    uint32_t drbs = 4;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("messages", "Number of round trips of each header", messages);
+    cmd.AddValue("drbs", "Number of DRBs added by the RRC connection reconfiguration", drbs);
+    cmd.Parse(argc, argv);
+
+    RrcConnectionReconfigurationHeader reconfiguration;
+    reconfiguration.SetMessage(CreateReconfiguration(drbs));
+    RrcConnectionReconfigurationHeader reconfigurationRx =
+        Run("RrcConnectionReconfiguration", reconfiguration, messages);
+    NS_ABORT_MSG_IF(reconfigurationRx.GetRadioResourceConfigDedicated().drbToAddModList.size() !=
+                        drbs,
+                    "RrcConnectionReconfiguration not decoded correctly");
+
+    LteRrcSap::MasterInformationBlockSL mibSl;
+    mibSl.slBandwidth = 50;
+    mibSl.directFrameNo = 512;
+    mibSl.directSubframeNo = 3;
+    mibSl.inCoverage = true;
+    MasterInformationBlockSlHeader mibSlHeader;
+    mibSlHeader.SetMessage(mibSl);
+    MasterInformationBlockSlHeader mibSlRx = Run("MasterInformationBlockSL", mibSlHeader, messages);
+    NS_ABORT_MSG_IF(mibSlRx.GetMessage().directFrameNo != mibSl.directFrameNo,
+                    "MasterInformationBlockSL not decoded correctly");
+    return 0;
+}
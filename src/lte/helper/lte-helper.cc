@@ -1799,6 +1799,13 @@ LteHelper::AssignStreams(NetDeviceContainer c, int64_t stream)
             currentStream += ulPhy->AssignStreams(currentStream);
             currentStream += ueMac->AssignStreams(currentStream);
             currentStream += uePhy->AssignStreams(currentStream);
+            Ptr<LteSpectrumPhy> slPhy = uePhy->GetSlSpectrumPhy();
+            Ptr<LteSlFadingTraceBank> slFadingBank =
+                slPhy ? slPhy->GetSlFadingTraceBank() : nullptr;
+            if (slFadingBank && m_slFadingBanksAssigned.insert(slFadingBank).second)
+            {
+                currentStream += slFadingBank->AssignStreams(currentStream);
+            }
         }
     }
     if (m_epcHelper)
@@ -1927,10 +1934,11 @@ void
 LteHelper::EnableUlPhyTraces()
 {
     NS_LOG_FUNCTION_NOARGS();
-    Config::Connect("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/ReportUeSinr",
-                    MakeBoundCallback(&PhyStatsCalculator::ReportUeSinr, m_phyStats));
-    Config::Connect("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/ReportInterference",
-                    MakeBoundCallback(&PhyStatsCalculator::ReportInterference, m_phyStats));
+    Config::ConnectBulk(
+        "/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy",
+        {{"ReportUeSinr", MakeBoundCallback(&PhyStatsCalculator::ReportUeSinr, m_phyStats)},
+         {"ReportInterference",
+          MakeBoundCallback(&PhyStatsCalculator::ReportInterference, m_phyStats)}});
 }
 
 Ptr<RadioBearerStatsCalculator>
@@ -49,6 +49,7 @@
 
 #include <cfloat>
 #include <map>
+#include <set>
 
 namespace ns3
 {
@@ -984,6 +985,12 @@ class LteHelper : public Object
      * model. Used to prevent such assignment to be done more than once.
      */
     bool m_fadingStreamsAssigned;
+    /**
+     * Sidelink fading trace banks of the UEs for which a random variable
+     * stream number has been assigned. Since a bank is usually shared by all
+     * the UEs, it is used to assign its stream only once.
+     */
+    std::set<Ptr<LteSlFadingTraceBank>> m_slFadingBanksAssigned;
 
     /// Container of PHY layer statistics.
     Ptr<PhyStatsCalculator> m_phyStats;
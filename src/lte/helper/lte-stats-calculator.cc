@@ -39,7 +39,8 @@ LteStatsCalculator::LteStatsCalculator()
       m_ulOutputFilename(""),
       m_slOutputFilename(""),
       m_slPscchOutputFilename(""),
-      m_slPsdchOutputFilename("")
+      m_slPsdchOutputFilename(""),
+      m_databaseFilename("")
 {
     // Nothing to do here
 }
@@ -52,10 +53,18 @@ LteStatsCalculator::~LteStatsCalculator()
 TypeId
 LteStatsCalculator::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::LteStatsCalculator")
-                            .SetParent<Object>()
-                            .SetGroupName("Lte")
-                            .AddConstructor<LteStatsCalculator>();
+    static TypeId tid =
+        TypeId("ns3::LteStatsCalculator")
+            .SetParent<Object>()
+            .SetGroupName("Lte")
+            .AddConstructor<LteStatsCalculator>()
+            .AddAttribute("DatabaseFilename",
+                          "Name of the SQLite database where the results will be saved. "
+                          "If empty, the results are saved in the text output files.",
+                          StringValue(""),
+                          MakeStringAccessor(&LteStatsCalculator::SetDatabaseFilename,
+                                             &LteStatsCalculator::GetDatabaseFilename),
+                          MakeStringChecker());
     return tid;
 }
 
@@ -119,6 +128,18 @@ LteStatsCalculator::GetSlPsdchOutputFilename()
     return m_slPsdchOutputFilename;
 }
 
+void
+LteStatsCalculator::SetDatabaseFilename(std::string databaseFilename)
+{
+    m_databaseFilename = databaseFilename;
+}
+
+std::string
+LteStatsCalculator::GetDatabaseFilename() const
+{
+    return m_databaseFilename;
+}
+
 bool
 LteStatsCalculator::ExistsImsiPath(std::string path)
 {
@@ -21,10 +21,14 @@
 #ifndef LTE_STATS_CALCULATOR_H_
 #define LTE_STATS_CALCULATOR_H_
 
+#include "ns3/batch-trace-sink.h"
 #include "ns3/object.h"
+#include "ns3/sqlite-batch-trace-backend.h"
 #include "ns3/string.h"
 
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace ns3
 {
@@ -35,6 +39,10 @@ namespace ns3
  * Base class for ***StatsCalculator classes. Provides
  * basic functionality to parse and store IMSI and CellId.
  * Also stores names of output files.
+ *
+ * When the DatabaseFilename attribute is set, the statistics are inserted as
+ * rows of tables of that SQLite database instead of being written to the
+ * text output files.
  */
 
 class LteStatsCalculator : public Object
@@ -121,6 +129,21 @@ class LteStatsCalculator : public Object
      */
     std::string GetSlPsdchOutputFilename();
 
+    /**
+     * Set the name of the SQLite database where the statistics will be stored.
+     *
+     * \param databaseFilename string with the name of the database, or an empty
+     *        string to store the statistics in the text output files
+     */
+    void SetDatabaseFilename(std::string databaseFilename);
+
+    /**
+     * Get the name of the SQLite database where the statistics will be stored.
+     * @return the name of the database, or an empty string if the statistics are
+     *         stored in the text output files
+     */
+    std::string GetDatabaseFilename() const;
+
     /**
      * Checks if there is an already stored IMSI for the given path
      * @param path Path in the attribute system to check
@@ -224,6 +247,28 @@ class LteStatsCalculator : public Object
      */
     static uint64_t FindImsiForUe(std::string path, uint16_t rnti);
 
+    /**
+     * Create the sink of a kind of statistics, writing either to a text output
+     * file or to a table of the database, depending on the DatabaseFilename
+     * attribute.
+     *
+     * @param filename the name of the text output file
+     * @param header the first line of the text output file
+     * @param formatter the function writing a record to the text output file
+     * @param table the name of the table of the database
+     * @param columns the definitions of the columns of the table
+     * @param binder the function binding the fields of a record to the columns
+     * @return the sink, or nullptr if the text output file cannot be opened
+     */
+    template <typename T>
+    std::unique_ptr<BatchTraceSink<T>> CreateOutputSink(
+        const std::string& filename,
+        const std::string& header,
+        typename TextBatchTraceBackend<T>::Formatter formatter,
+        const std::string& table,
+        const std::vector<std::string>& columns,
+        typename SqliteBatchTraceBackend<T>::Binder binder) const;
+
   private:
     /**
      * List of IMSI by path in the attribute system
@@ -259,8 +304,29 @@ class LteStatsCalculator : public Object
      * Name of the file where the Sidlink PSDCH results will be saved
      */
     std::string m_slPsdchOutputFilename;
+
+    /**
+     * Name of the SQLite database where the results will be saved, if not empty
+     */
+    std::string m_databaseFilename;
 };
 
+template <typename T>
+std::unique_ptr<BatchTraceSink<T>>
+LteStatsCalculator::CreateOutputSink(const std::string& filename,
+                                     const std::string& header,
+                                     typename TextBatchTraceBackend<T>::Formatter formatter,
+                                     const std::string& table,
+                                     const std::vector<std::string>& columns,
+                                     typename SqliteBatchTraceBackend<T>::Binder binder) const
+{
+    if (m_databaseFilename.empty())
+    {
+        return CreateTextBatchTraceSink<T>(filename, header, formatter);
+    }
+    return CreateSqliteBatchTraceSink<T>(m_databaseFilename, table, columns, binder);
+}
+
 } // namespace ns3
 
 #endif /* LTE_STATS_CALCULATOR_H_ */
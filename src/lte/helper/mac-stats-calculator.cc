@@ -34,11 +34,7 @@ NS_LOG_COMPONENT_DEFINE("MacStatsCalculator");
 NS_OBJECT_ENSURE_REGISTERED(MacStatsCalculator);
 
 MacStatsCalculator::MacStatsCalculator()
-    : m_dlFirstWrite(true),
-      m_ulFirstWrite(true),
-      m_slUeCchFirstWrite(true),
-      m_slUeSchFirstWrite(true),
-      m_slUeDchFirstWrite(true)
+    : m_slUeDchFirstWrite(true)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -46,15 +42,6 @@ MacStatsCalculator::MacStatsCalculator()
 MacStatsCalculator::~MacStatsCalculator()
 {
     NS_LOG_FUNCTION(this);
-    if (m_dlOutFile.is_open())
-    {
-        m_dlOutFile.close();
-    }
-
-    if (m_ulOutFile.is_open())
-    {
-        m_ulOutFile.close();
-    }
 }
 
 TypeId
@@ -153,6 +140,61 @@ MacStatsCalculator::GetSlUeDchOutputFilename()
     return LteStatsCalculator::GetSlPsdchOutputFilename();
 }
 
+/// Columns of the tables of the SL UE MAC statistics
+static const std::vector<std::string> g_slUeMacColumns = {"time INTEGER",
+                                                          "cellId INTEGER",
+                                                          "imsi INTEGER",
+                                                          "rnti INTEGER",
+                                                          "frame INTEGER",
+                                                          "sframe INTEGER",
+                                                          "scPrdStartFr INTEGER",
+                                                          "scPrdStartSf INTEGER",
+                                                          "resIndex INTEGER",
+                                                          "sizeTb INTEGER",
+                                                          "pscchRbLen INTEGER",
+                                                          "pscchStartRb INTEGER",
+                                                          "psschRbLen INTEGER",
+                                                          "psschStartRb INTEGER",
+                                                          "iTrp INTEGER",
+                                                          "mcs INTEGER",
+                                                          "hopping INTEGER",
+                                                          "hoppingInfo INTEGER",
+                                                          "l1GroupDstId INTEGER",
+                                                          "rv INTEGER",
+                                                          "dropped INTEGER"};
+
+/**
+ * Bind the SL UE MAC statistics to the columns of a table
+ *
+ * \param table the table
+ * \param params the SL UE MAC statistics
+ */
+static void
+BindSlUeMacStats(SqliteTraceTable& table, const SlUeMacStatParameters& params)
+{
+    table.BindInteger(0, params.m_timestamp);
+    table.BindInteger(1, params.m_cellId);
+    table.BindInteger(2, static_cast<int64_t>(params.m_imsi));
+    table.BindInteger(3, params.m_rnti);
+    table.BindInteger(4, params.m_frameNo);
+    table.BindInteger(5, params.m_subframeNo);
+    table.BindInteger(6, params.m_periodStartFrame);
+    table.BindInteger(7, params.m_periodStartSubframe);
+    table.BindInteger(8, params.m_resIndex);
+    table.BindInteger(9, params.m_tbSize);
+    table.BindInteger(10, params.m_pscchTxLengthRB);
+    table.BindInteger(11, params.m_pscchTxStartRB);
+    table.BindInteger(12, params.m_txLengthRB);
+    table.BindInteger(13, params.m_txStartRB);
+    table.BindInteger(14, params.m_psschItrp);
+    table.BindInteger(15, params.m_mcs);
+    table.BindInteger(16, params.m_hopping);
+    table.BindInteger(17, params.m_hoppingInfo);
+    table.BindInteger(18, params.m_groupDstId);
+    table.BindInteger(19, params.m_rv);
+    table.BindInteger(20, params.m_sidelinkDropped);
+}
+
 void
 MacStatsCalculator::DlScheduling(uint16_t cellId,
                                  uint64_t imsi,
@@ -165,31 +207,58 @@ MacStatsCalculator::DlScheduling(uint16_t cellId,
              << (uint32_t)dlSchedulingCallbackInfo.mcsTb2 << dlSchedulingCallbackInfo.sizeTb2);
     NS_LOG_INFO("Write DL Mac Stats in " << GetDlOutputFilename());
 
-    if (m_dlFirstWrite)
+    if (!m_dlOutSink)
     {
-        m_dlOutFile.open(GetDlOutputFilename());
-        if (!m_dlOutFile.is_open())
+        m_dlOutSink = CreateOutputSink<DlSchedulingRecord>(
+            GetDlOutputFilename(),
+            "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcsTb1\tsizeTb1\tmcsTb2\tsizeTb2\tccId",
+            [](std::ostream& os, const DlSchedulingRecord& r) {
+                os << r.time << "\t";
+                os << (uint32_t)r.cellId << "\t";
+                os << r.imsi << "\t";
+                os << r.info.frameNo << "\t";
+                os << r.info.subframeNo << "\t";
+                os << r.info.rnti << "\t";
+                os << (uint32_t)r.info.mcsTb1 << "\t";
+                os << r.info.sizeTb1 << "\t";
+                os << (uint32_t)r.info.mcsTb2 << "\t";
+                os << r.info.sizeTb2 << "\t";
+                os << (uint32_t)r.info.componentCarrierId;
+            },
+            "DlMacStats",
+            {"time REAL",
+             "cellId INTEGER",
+             "imsi INTEGER",
+             "frame INTEGER",
+             "sframe INTEGER",
+             "rnti INTEGER",
+             "mcsTb1 INTEGER",
+             "sizeTb1 INTEGER",
+             "mcsTb2 INTEGER",
+             "sizeTb2 INTEGER",
+             "ccId INTEGER"},
+            [](SqliteTraceTable& table, const DlSchedulingRecord& r) {
+                table.BindDouble(0, r.time);
+                table.BindInteger(1, r.cellId);
+                table.BindInteger(2, static_cast<int64_t>(r.imsi));
+                table.BindInteger(3, r.info.frameNo);
+                table.BindInteger(4, r.info.subframeNo);
+                table.BindInteger(5, r.info.rnti);
+                table.BindInteger(6, r.info.mcsTb1);
+                table.BindInteger(7, r.info.sizeTb1);
+                table.BindInteger(8, r.info.mcsTb2);
+                table.BindInteger(9, r.info.sizeTb2);
+                table.BindInteger(10, r.info.componentCarrierId);
+            });
+        if (!m_dlOutSink)
         {
             NS_LOG_ERROR("Can't open file " << GetDlOutputFilename());
             return;
         }
-        m_dlFirstWrite = false;
-        m_dlOutFile
-            << "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcsTb1\tsizeTb1\tmcsTb2\tsizeTb2\tccId";
-        m_dlOutFile << "\n";
     }
 
-    m_dlOutFile << Simulator::Now().GetSeconds() << "\t";
-    m_dlOutFile << (uint32_t)cellId << "\t";
-    m_dlOutFile << imsi << "\t";
-    m_dlOutFile << dlSchedulingCallbackInfo.frameNo << "\t";
-    m_dlOutFile << dlSchedulingCallbackInfo.subframeNo << "\t";
-    m_dlOutFile << dlSchedulingCallbackInfo.rnti << "\t";
-    m_dlOutFile << (uint32_t)dlSchedulingCallbackInfo.mcsTb1 << "\t";
-    m_dlOutFile << dlSchedulingCallbackInfo.sizeTb1 << "\t";
-    m_dlOutFile << (uint32_t)dlSchedulingCallbackInfo.mcsTb2 << "\t";
-    m_dlOutFile << dlSchedulingCallbackInfo.sizeTb2 << "\t";
-    m_dlOutFile << (uint32_t)dlSchedulingCallbackInfo.componentCarrierId << std::endl;
+    m_dlOutSink->Append(
+        DlSchedulingRecord{Simulator::Now().GetSeconds(), cellId, imsi, dlSchedulingCallbackInfo});
 }
 
 void
@@ -206,28 +275,59 @@ MacStatsCalculator::UlScheduling(uint16_t cellId,
                          << size);
     NS_LOG_INFO("Write UL Mac Stats in " << GetUlOutputFilename());
 
-    if (m_ulFirstWrite)
+    if (!m_ulOutSink)
     {
-        m_ulOutFile.open(GetUlOutputFilename());
-        if (!m_ulOutFile.is_open())
+        m_ulOutSink = CreateOutputSink<UlSchedulingRecord>(
+            GetUlOutputFilename(),
+            "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcs\tsize\tccId",
+            [](std::ostream& os, const UlSchedulingRecord& r) {
+                os << r.time << "\t";
+                os << (uint32_t)r.cellId << "\t";
+                os << r.imsi << "\t";
+                os << r.frameNo << "\t";
+                os << r.subframeNo << "\t";
+                os << r.rnti << "\t";
+                os << (uint32_t)r.mcsTb << "\t";
+                os << r.size << "\t";
+                os << (uint32_t)r.componentCarrierId;
+            },
+            "UlMacStats",
+            {"time REAL",
+             "cellId INTEGER",
+             "imsi INTEGER",
+             "frame INTEGER",
+             "sframe INTEGER",
+             "rnti INTEGER",
+             "mcs INTEGER",
+             "size INTEGER",
+             "ccId INTEGER"},
+            [](SqliteTraceTable& table, const UlSchedulingRecord& r) {
+                table.BindDouble(0, r.time);
+                table.BindInteger(1, r.cellId);
+                table.BindInteger(2, static_cast<int64_t>(r.imsi));
+                table.BindInteger(3, r.frameNo);
+                table.BindInteger(4, r.subframeNo);
+                table.BindInteger(5, r.rnti);
+                table.BindInteger(6, r.mcsTb);
+                table.BindInteger(7, r.size);
+                table.BindInteger(8, r.componentCarrierId);
+            });
+        if (!m_ulOutSink)
         {
             NS_LOG_ERROR("Can't open file " << GetUlOutputFilename());
             return;
         }
-        m_ulFirstWrite = false;
-        m_ulOutFile << "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcs\tsize\tccId";
-        m_ulOutFile << "\n";
     }
 
-    m_ulOutFile << Simulator::Now().GetSeconds() << "\t";
-    m_ulOutFile << (uint32_t)cellId << "\t";
-    m_ulOutFile << imsi << "\t";
-    m_ulOutFile << frameNo << "\t";
-    m_ulOutFile << subframeNo << "\t";
-    m_ulOutFile << rnti << "\t";
-    m_ulOutFile << (uint32_t)mcsTb << "\t";
-    m_ulOutFile << size << "\t";
-    m_ulOutFile << (uint32_t)componentCarrierId << std::endl;
+    m_ulOutSink->Append(UlSchedulingRecord{Simulator::Now().GetSeconds(),
+                                           cellId,
+                                           imsi,
+                                           frameNo,
+                                           subframeNo,
+                                           rnti,
+                                           mcsTb,
+                                           size,
+                                           componentCarrierId});
 }
 
 void
@@ -239,54 +339,46 @@ MacStatsCalculator::SlUeCchScheduling(SlUeMacStatParameters params)
                          << params.m_psschItrp << params.m_sidelinkDropped);
     NS_LOG_INFO("Write SL UE Mac Stats in " << GetSlUeCchOutputFilename().c_str());
 
-    std::ofstream outFile;
-    if (m_slUeCchFirstWrite)
-    {
-        outFile.open(GetSlUeCchOutputFilename().c_str());
-        if (!outFile.is_open())
-        {
-            NS_LOG_ERROR("Can't open file " << GetSlUeCchOutputFilename().c_str());
-            return;
-        }
-        m_slUeCchFirstWrite = false;
-        outFile << "% "
-                   "time\tcellId\tIMSI\tRNTI\tframe\tsframe\tscPrdStartFr\tscPrdStartSf\tresPscch\t"
-                   "sizeTb\tpscchRbLen\tpscchStartRb\thopping\thoppingInfo\tpsschRbLen\tpsschStartR"
-                   "b\tiTrp\tmcs\tl1GroupDstId\tdropped";
-        outFile << std::endl;
-    }
-    else
+    if (!m_slUeCchOutSink)
     {
-        outFile.open(GetSlUeCchOutputFilename().c_str(), std::ios_base::app);
-        if (!outFile.is_open())
+        m_slUeCchOutSink = CreateOutputSink<SlUeMacStatParameters>(
+            GetSlUeCchOutputFilename(),
+            "% "
+            "time\tcellId\tIMSI\tRNTI\tframe\tsframe\tscPrdStartFr\tscPrdStartSf\tresPscch\t"
+            "sizeTb\tpscchRbLen\tpscchStartRb\thopping\thoppingInfo\tpsschRbLen\tpsschStartR"
+            "b\tiTrp\tmcs\tl1GroupDstId\tdropped",
+            [](std::ostream& os, const SlUeMacStatParameters& p) {
+                os << p.m_timestamp << "\t";
+                os << p.m_cellId << "\t";
+                os << p.m_imsi << "\t";
+                os << p.m_rnti << "\t";
+                os << p.m_frameNo << "\t";
+                os << p.m_subframeNo << "\t";
+                os << p.m_periodStartFrame << "\t";
+                os << p.m_periodStartSubframe << "\t";
+                os << p.m_resIndex << "\t";
+                os << p.m_tbSize << "\t";
+                os << (uint16_t)p.m_pscchTxLengthRB << "\t";
+                os << (uint16_t)p.m_pscchTxStartRB << "\t";
+                os << (uint16_t)p.m_hopping << "\t";
+                os << (uint16_t)p.m_hoppingInfo << "\t";
+                os << (uint16_t)p.m_txLengthRB << "\t";
+                os << (uint16_t)p.m_txStartRB << "\t";
+                os << (uint16_t)p.m_psschItrp << "\t";
+                os << (uint16_t)p.m_mcs << "\t";
+                os << (uint16_t)p.m_groupDstId << "\t";
+                os << (uint16_t)p.m_sidelinkDropped;
+            },
+            "SlUeCchMacStats",
+            g_slUeMacColumns,
+            &BindSlUeMacStats);
+        if (!m_slUeCchOutSink)
         {
             NS_LOG_ERROR("Can't open file " << GetSlUeCchOutputFilename().c_str());
             return;
         }
     }
-
-    outFile << params.m_timestamp << "\t";
-    outFile << params.m_cellId << "\t";
-    outFile << params.m_imsi << "\t";
-    outFile << params.m_rnti << "\t";
-    outFile << params.m_frameNo << "\t";
-    outFile << params.m_subframeNo << "\t";
-    outFile << params.m_periodStartFrame << "\t";
-    outFile << params.m_periodStartSubframe << "\t";
-    outFile << params.m_resIndex << "\t";
-    outFile << params.m_tbSize << "\t";
-    outFile << (uint16_t)params.m_pscchTxLengthRB << "\t";
-    outFile << (uint16_t)params.m_pscchTxStartRB << "\t";
-    outFile << (uint16_t)params.m_hopping << "\t";
-    outFile << (uint16_t)params.m_hoppingInfo << "\t";
-    outFile << (uint16_t)params.m_txLengthRB << "\t";
-    outFile << (uint16_t)params.m_txStartRB << "\t";
-    outFile << (uint16_t)params.m_psschItrp << "\t";
-    outFile << (uint16_t)params.m_mcs << "\t";
-    outFile << (uint16_t)params.m_groupDstId << "\t";
-    outFile << (uint16_t)params.m_sidelinkDropped << std::endl;
-
-    outFile.close();
+    m_slUeCchOutSink->Append(params);
 }
 
 void
@@ -297,46 +389,39 @@ MacStatsCalculator::SlUeSchScheduling(SlUeMacStatParameters params)
                          << params.m_txStartRB << params.m_txLengthRB);
     NS_LOG_INFO("Write SL Shared Channel UE Mac Stats in " << GetSlUeSchOutputFilename().c_str());
 
-    std::ofstream outFile;
-    if (m_slUeSchFirstWrite)
+    if (!m_slUeSchOutSink)
     {
-        outFile.open(GetSlUeSchOutputFilename().c_str());
-        if (!outFile.is_open())
-        {
-            NS_LOG_ERROR("Can't open file " << GetSlUeSchOutputFilename().c_str());
-            return;
-        }
-        m_slUeSchFirstWrite = false;
-        outFile << "% "
-                   "time\tcellId\tIMSI\tRNTI\tcurrFr\tcurrSf\tscPrdStartFr\tscPrdStartSf\tpsschRbLe"
-                   "n\tpsschStartRb\tmcs\tsizeTb\trv\tdropped";
-        outFile << std::endl;
-    }
-    else
-    {
-        outFile.open(GetSlUeSchOutputFilename().c_str(), std::ios_base::app);
-        if (!outFile.is_open())
+        m_slUeSchOutSink = CreateOutputSink<SlUeMacStatParameters>(
+            GetSlUeSchOutputFilename(),
+            "% "
+            "time\tcellId\tIMSI\tRNTI\tcurrFr\tcurrSf\tscPrdStartFr\tscPrdStartSf\tpsschRbLe"
+            "n\tpsschStartRb\tmcs\tsizeTb\trv\tdropped",
+            [](std::ostream& os, const SlUeMacStatParameters& p) {
+                os << p.m_timestamp << "\t";
+                os << p.m_cellId << "\t";
+                os << p.m_imsi << "\t";
+                os << p.m_rnti << "\t";
+                os << p.m_frameNo << "\t";
+                os << p.m_subframeNo << "\t";
+                os << p.m_periodStartFrame << "\t";
+                os << p.m_periodStartSubframe << "\t";
+                os << (uint16_t)p.m_txLengthRB << "\t";
+                os << (uint16_t)p.m_txStartRB << "\t";
+                os << (uint16_t)p.m_mcs << "\t";
+                os << p.m_tbSize << "\t";
+                os << (uint16_t)p.m_rv << "\t";
+                os << (uint16_t)p.m_sidelinkDropped;
+            },
+            "SlUeSchMacStats",
+            g_slUeMacColumns,
+            &BindSlUeMacStats);
+        if (!m_slUeSchOutSink)
         {
             NS_LOG_ERROR("Can't open file " << GetSlUeSchOutputFilename().c_str());
             return;
         }
     }
-
-    outFile << params.m_timestamp << "\t";
-    outFile << params.m_cellId << "\t";
-    outFile << params.m_imsi << "\t";
-    outFile << params.m_rnti << "\t";
-    outFile << params.m_frameNo << "\t";
-    outFile << params.m_subframeNo << "\t";
-    outFile << params.m_periodStartFrame << "\t";
-    outFile << params.m_periodStartSubframe << "\t";
-    outFile << (uint16_t)params.m_txLengthRB << "\t";
-    outFile << (uint16_t)params.m_txStartRB << "\t";
-    outFile << (uint16_t)params.m_mcs << "\t";
-    outFile << params.m_tbSize << "\t";
-    outFile << (uint16_t)params.m_rv << "\t";
-    outFile << (uint16_t)params.m_sidelinkDropped << std::endl;
-    outFile.close();
+    m_slUeSchOutSink->Append(params);
 }
 
 void
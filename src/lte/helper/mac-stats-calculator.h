@@ -24,6 +24,7 @@
 
 #include "lte-stats-calculator.h"
 
+#include "ns3/batch-trace-sink.h"
 #include "ns3/config.h"
 #include "ns3/ff-mac-common.h"
 #include "ns3/lte-common.h"
@@ -35,6 +36,7 @@
 
 #include <bitset>
 #include <fstream>
+#include <memory>
 #include <string>
 
 namespace ns3
@@ -265,55 +267,56 @@ class MacStatsCalculator : public LteStatsCalculator
     void SlUeDchScheduling(SlUeMacStatParameters params, LteSlDiscHeader discMsg);
 
   private:
-    /**
-     * When writing DL MAC statistics first time to file,
-     * columns description is added. Then next lines are
-     * appended to file. This value is true if output
-     * files have not been opened yet
-     */
-    bool m_dlFirstWrite;
-
-    /**
-     * When writing UL MAC statistics first time to file,
-     * columns description is added. Then next lines are
-     * appended to file. This value is true if output
-     * files have not been opened yet
-     */
-    bool m_ulFirstWrite;
+    /// DL MAC statistics of a scheduled UE, as written to the output
+    struct DlSchedulingRecord
+    {
+        double time;                   ///< time in seconds
+        uint16_t cellId;               ///< cell ID
+        uint64_t imsi;                 ///< IMSI
+        DlSchedulingCallbackInfo info; ///< scheduling information
+    };
+
+    /// UL MAC statistics of a scheduled UE, as written to the output
+    struct UlSchedulingRecord
+    {
+        double time;                ///< time in seconds
+        uint16_t cellId;            ///< cell ID
+        uint64_t imsi;              ///< IMSI
+        uint32_t frameNo;           ///< frame number
+        uint32_t subframeNo;        ///< subframe number
+        uint16_t rnti;              ///< RNTI
+        uint8_t mcsTb;              ///< MCS
+        uint16_t size;              ///< transport block size
+        uint8_t componentCarrierId; ///< component carrier ID
+    };
 
     /**
-     * When writing Sidelink PSCCH UE MAC statistics first time to file,
+     * When writing Discovery Announcement messages first time to file,
      * columns description is added. Then next lines are
      * appended to file. This value is true if output
      * files have not been opened yet
      */
-    bool m_slUeCchFirstWrite;
+    bool m_slUeDchFirstWrite;
 
     /**
-     * When writing Sidelink PSSCH UE MAC statistics first time to file,
-     * columns description is added. Then next lines are
-     * appended to file. This value is true if output
-     * files have not been opened yet
+     * Downlink output trace sink, created at the first write
      */
-    bool m_slUeSchFirstWrite;
+    std::unique_ptr<BatchTraceSink<DlSchedulingRecord>> m_dlOutSink;
 
     /**
-     * When writing Discovery Announcement messages first time to file,
-     * columns description is added. Then next lines are
-     * appended to file. This value is true if output
-     * files have not been opened yet
+     * Uplink output trace sink, created at the first write
      */
-    bool m_slUeDchFirstWrite;
+    std::unique_ptr<BatchTraceSink<UlSchedulingRecord>> m_ulOutSink;
 
     /**
-     * Downlink output trace file
+     * Sidelink PSCCH UE MAC output trace sink, created at the first write
      */
-    std::ofstream m_dlOutFile;
+    std::unique_ptr<BatchTraceSink<SlUeMacStatParameters>> m_slUeCchOutSink;
 
     /**
-     * Uplink output trace file
+     * Sidelink PSSCH UE MAC output trace sink, created at the first write
      */
-    std::ofstream m_ulOutFile;
+    std::unique_ptr<BatchTraceSink<SlUeMacStatParameters>> m_slUeSchOutSink;
 };
 
 } // namespace ns3
@@ -34,10 +34,6 @@ NS_LOG_COMPONENT_DEFINE("PhyRxStatsCalculator");
 NS_OBJECT_ENSURE_REGISTERED(PhyRxStatsCalculator);
 
 PhyRxStatsCalculator::PhyRxStatsCalculator()
-    : m_dlRxFirstWrite(true),
-      m_ulRxFirstWrite(true),
-      m_slRxFirstWrite(true),
-      m_slPscchRxFirstWrite(true)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -45,15 +41,6 @@ PhyRxStatsCalculator::PhyRxStatsCalculator()
 PhyRxStatsCalculator::~PhyRxStatsCalculator()
 {
     NS_LOG_FUNCTION(this);
-    if (m_dlRxOutFile.is_open())
-    {
-        m_dlRxOutFile.close();
-    }
-
-    if (m_ulRxOutFile.is_open())
-    {
-        m_ulRxOutFile.close();
-    }
 }
 
 TypeId
@@ -136,6 +123,113 @@ PhyRxStatsCalculator::GetSlPscchRxOutputFilename()
     return LteStatsCalculator::GetSlPscchOutputFilename();
 }
 
+/**
+ * Write the DL or UL PHY reception statistics of a transport block
+ *
+ * \param os the output stream
+ * \param params the PHY reception statistics
+ * \param txMode whether the transmission mode is written
+ */
+static void
+WritePhyReception(std::ostream& os, const PhyReceptionStatParameters& params, bool txMode)
+{
+    os << params.m_timestamp << "\t";
+    os << (uint32_t)params.m_cellId << "\t";
+    os << params.m_imsi << "\t";
+    os << params.m_rnti << "\t";
+    if (txMode)
+    {
+        os << (uint32_t)params.m_txMode << "\t";
+    }
+    os << (uint32_t)params.m_layer << "\t";
+    os << (uint32_t)params.m_mcs << "\t";
+    os << params.m_size << "\t";
+    os << (uint32_t)params.m_rv << "\t";
+    os << (uint32_t)params.m_ndi << "\t";
+    os << (uint32_t)params.m_correctness << "\t";
+    os << (uint32_t)params.m_ccId;
+}
+
+/// Columns of the tables of the DL, UL and SL PHY reception statistics
+static const std::vector<std::string> g_phyReceptionColumns = {"time INTEGER",
+                                                               "cellId INTEGER",
+                                                               "imsi INTEGER",
+                                                               "rnti INTEGER",
+                                                               "txMode INTEGER",
+                                                               "layer INTEGER",
+                                                               "mcs INTEGER",
+                                                               "size INTEGER",
+                                                               "rv INTEGER",
+                                                               "ndi INTEGER",
+                                                               "correct INTEGER",
+                                                               "ccId INTEGER",
+                                                               "sinrPerRb REAL"};
+
+/**
+ * Bind the PHY reception statistics of a transport block to the columns of a table
+ *
+ * \param table the table
+ * \param params the PHY reception statistics
+ */
+static void
+BindPhyReception(SqliteTraceTable& table, const PhyReceptionStatParameters& params)
+{
+    table.BindInteger(0, params.m_timestamp);
+    table.BindInteger(1, params.m_cellId);
+    table.BindInteger(2, static_cast<int64_t>(params.m_imsi));
+    table.BindInteger(3, params.m_rnti);
+    table.BindInteger(4, params.m_txMode);
+    table.BindInteger(5, params.m_layer);
+    table.BindInteger(6, params.m_mcs);
+    table.BindInteger(7, params.m_size);
+    table.BindInteger(8, params.m_rv);
+    table.BindInteger(9, params.m_ndi);
+    table.BindInteger(10, params.m_correctness);
+    table.BindInteger(11, params.m_ccId);
+    table.BindDouble(12, params.m_sinrPerRb);
+}
+
+/// Columns of the table of the SL PSCCH reception statistics
+static const std::vector<std::string> g_slPscchReceptionColumns = {"time INTEGER",
+                                                                   "cellId INTEGER",
+                                                                   "imsi INTEGER",
+                                                                   "rnti INTEGER",
+                                                                   "resPscch INTEGER",
+                                                                   "sizeTb INTEGER",
+                                                                   "hopping INTEGER",
+                                                                   "hoppingInfo INTEGER",
+                                                                   "psschRbLen INTEGER",
+                                                                   "psschStartRb INTEGER",
+                                                                   "iTrp INTEGER",
+                                                                   "mcs INTEGER",
+                                                                   "l1GroupDstId INTEGER",
+                                                                   "correct INTEGER"};
+
+/**
+ * Bind the SL PSCCH reception statistics to the columns of a table
+ *
+ * \param table the table
+ * \param params the PSCCH reception statistics
+ */
+static void
+BindSlPscchReception(SqliteTraceTable& table, const SlPhyReceptionStatParameters& params)
+{
+    table.BindInteger(0, params.m_timestamp);
+    table.BindInteger(1, params.m_cellId);
+    table.BindInteger(2, static_cast<int64_t>(params.m_imsi));
+    table.BindInteger(3, params.m_rnti);
+    table.BindInteger(4, params.m_resPscch);
+    table.BindInteger(5, params.m_size);
+    table.BindInteger(6, params.m_hopping);
+    table.BindInteger(7, params.m_hoppingInfo);
+    table.BindInteger(8, params.m_rbLen);
+    table.BindInteger(9, params.m_rbStart);
+    table.BindInteger(10, params.m_iTrp);
+    table.BindInteger(11, params.m_mcs);
+    table.BindInteger(12, params.m_groupDstId);
+    table.BindInteger(13, params.m_correctness);
+}
+
 void
 PhyRxStatsCalculator::DlPhyReception(PhyReceptionStatParameters params)
 {
@@ -144,32 +238,24 @@ PhyRxStatsCalculator::DlPhyReception(PhyReceptionStatParameters params)
                          << params.m_ndi << params.m_correctness);
     NS_LOG_INFO("Write DL Rx Phy Stats in " << GetDlRxOutputFilename());
 
-    if (m_dlRxFirstWrite)
+    if (!m_dlRxOutSink)
     {
-        m_dlRxOutFile.open(GetDlRxOutputFilename());
-        if (!m_dlRxOutFile.is_open())
+        m_dlRxOutSink = CreateOutputSink<PhyReceptionStatParameters>(
+            GetDlRxOutputFilename(),
+            "% time\tcellId\tIMSI\tRNTI\ttxMode\tlayer\tmcs\tsize\trv\tndi\tcorrect\tccId",
+            [](std::ostream& os, const PhyReceptionStatParameters& p) {
+                WritePhyReception(os, p, true);
+            },
+            "DlRxPhyStats",
+            g_phyReceptionColumns,
+            &BindPhyReception);
+        if (!m_dlRxOutSink)
         {
             NS_LOG_ERROR("Can't open file " << GetDlRxOutputFilename());
             return;
         }
-        m_dlRxFirstWrite = false;
-        m_dlRxOutFile
-            << "% time\tcellId\tIMSI\tRNTI\ttxMode\tlayer\tmcs\tsize\trv\tndi\tcorrect\tccId";
-        m_dlRxOutFile << "\n";
     }
-
-    m_dlRxOutFile << params.m_timestamp << "\t";
-    m_dlRxOutFile << (uint32_t)params.m_cellId << "\t";
-    m_dlRxOutFile << params.m_imsi << "\t";
-    m_dlRxOutFile << params.m_rnti << "\t";
-    m_dlRxOutFile << (uint32_t)params.m_txMode << "\t";
-    m_dlRxOutFile << (uint32_t)params.m_layer << "\t";
-    m_dlRxOutFile << (uint32_t)params.m_mcs << "\t";
-    m_dlRxOutFile << params.m_size << "\t";
-    m_dlRxOutFile << (uint32_t)params.m_rv << "\t";
-    m_dlRxOutFile << (uint32_t)params.m_ndi << "\t";
-    m_dlRxOutFile << (uint32_t)params.m_correctness << "\t";
-    m_dlRxOutFile << (uint32_t)params.m_ccId << std::endl;
+    m_dlRxOutSink->Append(params);
 }
 
 void
@@ -180,30 +266,24 @@ PhyRxStatsCalculator::UlPhyReception(PhyReceptionStatParameters params)
                          << params.m_ndi << params.m_correctness);
     NS_LOG_INFO("Write UL Rx Phy Stats in " << GetUlRxOutputFilename());
 
-    if (m_ulRxFirstWrite)
+    if (!m_ulRxOutSink)
     {
-        m_ulRxOutFile.open(GetUlRxOutputFilename());
-        if (!m_ulRxOutFile.is_open())
+        m_ulRxOutSink = CreateOutputSink<PhyReceptionStatParameters>(
+            GetUlRxOutputFilename(),
+            "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tcorrect\tccId",
+            [](std::ostream& os, const PhyReceptionStatParameters& p) {
+                WritePhyReception(os, p, false);
+            },
+            "UlRxPhyStats",
+            g_phyReceptionColumns,
+            &BindPhyReception);
+        if (!m_ulRxOutSink)
         {
             NS_LOG_ERROR("Can't open file " << GetUlRxOutputFilename());
             return;
         }
-        m_ulRxFirstWrite = false;
-        m_ulRxOutFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tcorrect\tccId";
-        m_ulRxOutFile << "\n";
     }
-
-    m_ulRxOutFile << params.m_timestamp << "\t";
-    m_ulRxOutFile << (uint32_t)params.m_cellId << "\t";
-    m_ulRxOutFile << params.m_imsi << "\t";
-    m_ulRxOutFile << params.m_rnti << "\t";
-    m_ulRxOutFile << (uint32_t)params.m_layer << "\t";
-    m_ulRxOutFile << (uint32_t)params.m_mcs << "\t";
-    m_ulRxOutFile << params.m_size << "\t";
-    m_ulRxOutFile << (uint32_t)params.m_rv << "\t";
-    m_ulRxOutFile << (uint32_t)params.m_ndi << "\t";
-    m_ulRxOutFile << (uint32_t)params.m_correctness << "\t";
-    m_ulRxOutFile << (uint32_t)params.m_ccId << std::endl;
+    m_ulRxOutSink->Append(params);
 }
 
 void
@@ -214,41 +294,34 @@ PhyRxStatsCalculator::SlPhyReception(PhyReceptionStatParameters params)
                          << params.m_ndi << params.m_correctness);
     NS_LOG_INFO("Write SL Rx Phy Stats in " << GetSlRxOutputFilename().c_str());
 
-    std::ofstream outFile;
-    if (m_slRxFirstWrite)
-    {
-        outFile.open(GetSlRxOutputFilename().c_str());
-        if (!outFile.is_open())
-        {
-            NS_LOG_ERROR("Can't open file " << GetSlRxOutputFilename().c_str());
-            return;
-        }
-        m_slRxFirstWrite = false;
-        outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tcorrect\tavrgSinrPerRb";
-        outFile << std::endl;
-    }
-    else
+    if (!m_slRxOutSink)
     {
-        outFile.open(GetSlRxOutputFilename().c_str(), std::ios_base::app);
-        if (!outFile.is_open())
+        m_slRxOutSink = CreateOutputSink<PhyReceptionStatParameters>(
+            GetSlRxOutputFilename(),
+            "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tcorrect\tavrgSinrPerRb",
+            [](std::ostream& os, const PhyReceptionStatParameters& p) {
+                os << p.m_timestamp << "\t";
+                os << (uint32_t)p.m_cellId << "\t";
+                os << p.m_imsi << "\t";
+                os << p.m_rnti << "\t";
+                os << (uint32_t)p.m_layer << "\t";
+                os << (uint32_t)p.m_mcs << "\t";
+                os << p.m_size << "\t";
+                os << (uint32_t)p.m_rv << "\t";
+                os << (uint32_t)p.m_ndi << "\t";
+                os << (uint32_t)p.m_correctness << "\t";
+                os << (double)p.m_sinrPerRb;
+            },
+            "SlRxPhyStats",
+            g_phyReceptionColumns,
+            &BindPhyReception);
+        if (!m_slRxOutSink)
         {
             NS_LOG_ERROR("Can't open file " << GetSlRxOutputFilename().c_str());
             return;
         }
     }
-
-    outFile << params.m_timestamp << "\t";
-    outFile << (uint32_t)params.m_cellId << "\t";
-    outFile << params.m_imsi << "\t";
-    outFile << params.m_rnti << "\t";
-    outFile << (uint32_t)params.m_layer << "\t";
-    outFile << (uint32_t)params.m_mcs << "\t";
-    outFile << params.m_size << "\t";
-    outFile << (uint32_t)params.m_rv << "\t";
-    outFile << (uint32_t)params.m_ndi << "\t";
-    outFile << (uint32_t)params.m_correctness << "\t";
-    outFile << (double)params.m_sinrPerRb << std::endl;
-    outFile.close();
+    m_slRxOutSink->Append(params);
 }
 
 void
@@ -261,46 +334,39 @@ PhyRxStatsCalculator::SlPscchReception(SlPhyReceptionStatParameters params)
                          << (uint16_t)params.m_groupDstId << (uint16_t)params.m_correctness);
     NS_LOG_INFO("Write SL Rx PSCCH Stats in " << GetSlPscchRxOutputFilename().c_str());
 
-    std::ofstream outFile;
-    if (m_slPscchRxFirstWrite)
-    {
-        outFile.open(GetSlPscchRxOutputFilename().c_str());
-        if (!outFile.is_open())
-        {
-            NS_LOG_ERROR("Can't open file " << GetSlPscchRxOutputFilename().c_str());
-            return;
-        }
-        m_slPscchRxFirstWrite = false;
-        outFile << "% "
-                   "time\tcellId\tIMSI\tRNTI\tresPscch\tsizeTb\thopping\thoppingInfo\tpsschRbLen\tp"
-                   "sschStartRb\tiTrp\tmcs\tl1GroupDstId\tcorrect";
-        outFile << std::endl;
-    }
-    else
+    if (!m_slPscchRxOutSink)
     {
-        outFile.open(GetSlPscchRxOutputFilename().c_str(), std::ios_base::app);
-        if (!outFile.is_open())
+        m_slPscchRxOutSink = CreateOutputSink<SlPhyReceptionStatParameters>(
+            GetSlPscchRxOutputFilename(),
+            "% "
+            "time\tcellId\tIMSI\tRNTI\tresPscch\tsizeTb\thopping\thoppingInfo\tpsschRbLen\tp"
+            "sschStartRb\tiTrp\tmcs\tl1GroupDstId\tcorrect",
+            [](std::ostream& os, const SlPhyReceptionStatParameters& p) {
+                os << p.m_timestamp << "\t";
+                os << p.m_cellId << "\t";
+                os << p.m_imsi << "\t";
+                os << p.m_rnti << "\t";
+                os << p.m_resPscch << "\t";
+                os << p.m_size << "\t";
+                os << (uint32_t)p.m_hopping << "\t";
+                os << (uint32_t)p.m_hoppingInfo << "\t";
+                os << (uint32_t)p.m_rbLen << "\t";
+                os << (uint32_t)p.m_rbStart << "\t";
+                os << (uint32_t)p.m_iTrp << "\t";
+                os << (uint32_t)p.m_mcs << "\t";
+                os << (uint32_t)p.m_groupDstId << "\t";
+                os << (uint32_t)p.m_correctness;
+            },
+            "SlCchRxPhyStats",
+            g_slPscchReceptionColumns,
+            &BindSlPscchReception);
+        if (!m_slPscchRxOutSink)
         {
             NS_LOG_ERROR("Can't open file " << GetSlPscchRxOutputFilename().c_str());
             return;
         }
     }
-
-    outFile << params.m_timestamp << "\t";
-    outFile << params.m_cellId << "\t";
-    outFile << params.m_imsi << "\t";
-    outFile << params.m_rnti << "\t";
-    outFile << params.m_resPscch << "\t";
-    outFile << params.m_size << "\t";
-    outFile << (uint32_t)params.m_hopping << "\t";
-    outFile << (uint32_t)params.m_hoppingInfo << "\t";
-    outFile << (uint32_t)params.m_rbLen << "\t";
-    outFile << (uint32_t)params.m_rbStart << "\t";
-    outFile << (uint32_t)params.m_iTrp << "\t";
-    outFile << (uint32_t)params.m_mcs << "\t";
-    outFile << (uint32_t)params.m_groupDstId << "\t";
-    outFile << (uint32_t)params.m_correctness << std::endl;
-    outFile.close();
+    m_slPscchRxOutSink->Append(params);
 }
 
 void
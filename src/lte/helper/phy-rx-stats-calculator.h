@@ -25,11 +25,12 @@
 
 #include "lte-stats-calculator.h"
 
+#include "ns3/batch-trace-sink.h"
 #include "ns3/nstime.h"
 #include "ns3/uinteger.h"
 #include <ns3/lte-common.h>
 
-#include <fstream>
+#include <memory>
 #include <string>
 
 namespace ns3
@@ -193,46 +194,24 @@ class PhyRxStatsCalculator : public LteStatsCalculator
 
   private:
     /**
-     * When writing DL RX PHY statistics first time to file,
-     * columns description is added. Then next lines are
-     * appended to file. This value is true if output
-     * files have not been opened yet
+     * DL RX PHY output trace sink, created at the first write
      */
-    bool m_dlRxFirstWrite;
+    std::unique_ptr<BatchTraceSink<PhyReceptionStatParameters>> m_dlRxOutSink;
 
     /**
-     * When writing UL RX PHY statistics first time to file,
-     * columns description is added. Then next lines are
-     * appended to file. This value is true if output
-     * files have not been opened yet
+     * UL RX PHY output trace sink, created at the first write
      */
-    bool m_ulRxFirstWrite;
+    std::unique_ptr<BatchTraceSink<PhyReceptionStatParameters>> m_ulRxOutSink;
 
     /**
-     * When writing Sidelink RX PHY statistics first time to file,
-     * columns description is added. Then next lines are
-     * appended to file. This value is true if output
-     * files have not been opened yet
+     * Sidelink RX PHY output trace sink, created at the first write
      */
-    bool m_slRxFirstWrite;
+    std::unique_ptr<BatchTraceSink<PhyReceptionStatParameters>> m_slRxOutSink;
 
     /**
-     * When writing Sidelink PSCCH RX PHY statistics first time to file,
-     * columns description is added. Then next lines are
-     * appended to file. This value is true if output
-     * files have not been opened yet
+     * Sidelink PSCCH RX PHY output trace sink, created at the first write
      */
-    bool m_slPscchRxFirstWrite;
-
-    /**
-     * DL RX PHY output trace file
-     */
-    std::ofstream m_dlRxOutFile;
-
-    /**
-     * UL RX PHY output trace file
-     */
-    std::ofstream m_ulRxOutFile;
+    std::unique_ptr<BatchTraceSink<SlPhyReceptionStatParameters>> m_slPscchRxOutSink;
 };
 
 } // namespace ns3
@@ -25,6 +25,7 @@
 #include <ns3/log.h>
 
 #include <algorithm>
+#include <set>
 #include <vector>
 
 namespace ns3
@@ -106,6 +107,9 @@ RadioBearerStatsCalculator::DoDispose()
     {
         ShowResults();
     }
+    // write the last records and close the database
+    m_ulDatabaseSink.reset();
+    m_dlDatabaseSink.reset();
 }
 
 void
@@ -238,6 +242,13 @@ void
 RadioBearerStatsCalculator::ShowResults()
 {
     NS_LOG_FUNCTION(this << GetUlOutputFilename() << GetDlOutputFilename());
+    if (!GetDatabaseFilename().empty())
+    {
+        WriteDatabaseResults();
+        m_pendingOutput = false;
+        return;
+    }
+
     NS_LOG_INFO("Write Rlc Stats in " << GetUlOutputFilename() << " and in "
                                       << GetDlOutputFilename());
 
@@ -411,6 +422,129 @@ RadioBearerStatsCalculator::WriteDlResults(std::ofstream& outFile)
     outFile.close();
 }
 
+/// Columns of the tables of the radio bearer statistics
+static const std::vector<std::string> g_radioBearerColumns = {"start REAL",
+                                                              "end REAL",
+                                                              "cellId INTEGER",
+                                                              "imsi INTEGER",
+                                                              "rnti INTEGER",
+                                                              "lcid INTEGER",
+                                                              "nTxPDUs INTEGER",
+                                                              "TxBytes INTEGER",
+                                                              "nRxPDUs INTEGER",
+                                                              "RxBytes INTEGER",
+                                                              "delay REAL",
+                                                              "delayStdDev REAL",
+                                                              "delayMin REAL",
+                                                              "delayMax REAL",
+                                                              "PduSize REAL",
+                                                              "PduSizeStdDev REAL",
+                                                              "PduSizeMin REAL",
+                                                              "PduSizeMax REAL"};
+
+void
+RadioBearerStatsCalculator::WriteDatabaseResults()
+{
+    NS_LOG_FUNCTION(this << GetDatabaseFilename());
+
+    if (!m_ulDatabaseSink)
+    {
+        auto binder = [](SqliteTraceTable& table, const RadioBearerStatsRecord& r) {
+            table.BindDouble(0, r.start);
+            table.BindDouble(1, r.end);
+            table.BindInteger(2, r.cellId);
+            table.BindInteger(3, static_cast<int64_t>(r.imsi));
+            table.BindInteger(4, r.rnti);
+            table.BindInteger(5, r.lcid);
+            table.BindInteger(6, r.txPackets);
+            table.BindInteger(7, static_cast<int64_t>(r.txData));
+            table.BindInteger(8, r.rxPackets);
+            table.BindInteger(9, static_cast<int64_t>(r.rxData));
+            for (int i = 0; i < 4; i++)
+            {
+                table.BindDouble(10 + i, r.delay[i]);
+                table.BindDouble(14 + i, r.pduSize[i]);
+            }
+        };
+        std::string protocol = m_protocolType == "PDCP" ? "Pdcp" : "Rlc";
+        m_ulDatabaseSink =
+            CreateSqliteBatchTraceSink<RadioBearerStatsRecord>(GetDatabaseFilename(),
+                                                               "Ul" + protocol + "Stats",
+                                                               g_radioBearerColumns,
+                                                               binder);
+        m_dlDatabaseSink =
+            CreateSqliteBatchTraceSink<RadioBearerStatsRecord>(GetDatabaseFilename(),
+                                                               "Dl" + protocol + "Stats",
+                                                               g_radioBearerColumns,
+                                                               binder);
+    }
+
+    AppendDatabaseResults(*m_ulDatabaseSink, true);
+    AppendDatabaseResults(*m_dlDatabaseSink, false);
+}
+
+void
+RadioBearerStatsCalculator::AppendDatabaseResults(BatchTraceSink<RadioBearerStatsRecord>& sink,
+                                                  bool uplink)
+{
+    NS_LOG_FUNCTION(this << uplink);
+
+    // Get the unique IMSI/LCID pairs list
+    std::set<ImsiLcidPair_t> pairs;
+    for (const auto& txPackets : uplink ? m_ulTxPackets : m_dlTxPackets)
+    {
+        pairs.insert(txPackets.first);
+    }
+    for (const auto& rxPackets : uplink ? m_ulRxPackets : m_dlRxPackets)
+    {
+        pairs.insert(rxPackets.first);
+    }
+
+    Time endTime = m_startTime + m_epochDuration;
+    for (const auto& p : pairs)
+    {
+        auto flowIdIt = m_flowId.find(p);
+        NS_ASSERT_MSG(flowIdIt != m_flowId.end(),
+                      "FlowId (imsi " << p.m_imsi << " lcid " << (uint32_t)p.m_lcId
+                                      << ") is missing");
+
+        RadioBearerStatsRecord record;
+        record.start = m_startTime.GetSeconds();
+        record.end = endTime.GetSeconds();
+        record.imsi = p.m_imsi;
+        record.rnti = flowIdIt->second.m_rnti;
+        record.lcid = p.m_lcId;
+        std::vector<double> delay;
+        std::vector<double> pduSize;
+        if (uplink)
+        {
+            record.cellId = GetUlCellId(p.m_imsi, p.m_lcId);
+            record.txPackets = GetUlTxPackets(p.m_imsi, p.m_lcId);
+            record.txData = GetUlTxData(p.m_imsi, p.m_lcId);
+            record.rxPackets = GetUlRxPackets(p.m_imsi, p.m_lcId);
+            record.rxData = GetUlRxData(p.m_imsi, p.m_lcId);
+            delay = GetUlDelayStats(p.m_imsi, p.m_lcId);
+            pduSize = GetUlPduSizeStats(p.m_imsi, p.m_lcId);
+        }
+        else
+        {
+            record.cellId = GetDlCellId(p.m_imsi, p.m_lcId);
+            record.txPackets = GetDlTxPackets(p.m_imsi, p.m_lcId);
+            record.txData = GetDlTxData(p.m_imsi, p.m_lcId);
+            record.rxPackets = GetDlRxPackets(p.m_imsi, p.m_lcId);
+            record.rxData = GetDlRxData(p.m_imsi, p.m_lcId);
+            delay = GetDlDelayStats(p.m_imsi, p.m_lcId);
+            pduSize = GetDlPduSizeStats(p.m_imsi, p.m_lcId);
+        }
+        for (int i = 0; i < 4; i++)
+        {
+            record.delay[i] = delay[i] * 1e-9;
+            record.pduSize[i] = pduSize[i];
+        }
+        sink.Append(record);
+    }
+}
+
 void
 RadioBearerStatsCalculator::ResetResults()
 {
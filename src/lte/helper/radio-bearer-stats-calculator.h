@@ -30,6 +30,7 @@
 
 #include <fstream>
 #include <map>
+#include <memory>
 #include <string>
 
 namespace ns3
@@ -360,6 +361,37 @@ class RadioBearerStatsCalculator : public LteStatsCalculator
      */
     void WriteDlResults(std::ofstream& outFile);
 
+    /// Statistics of a radio bearer in an epoch, as stored in the database
+    struct RadioBearerStatsRecord
+    {
+        double start;       ///< start of the epoch in seconds
+        double end;         ///< end of the epoch in seconds
+        uint32_t cellId;    ///< cell ID
+        uint64_t imsi;      ///< IMSI
+        uint16_t rnti;      ///< RNTI
+        uint8_t lcid;       ///< LCID
+        uint32_t txPackets; ///< number of TX PDUs
+        uint64_t txData;    ///< amount of TX data in bytes
+        uint32_t rxPackets; ///< number of RX PDUs
+        uint64_t rxData;    ///< amount of RX data in bytes
+        double delay[4];    ///< delay average, standard deviation, min and max in seconds
+        double pduSize[4];  ///< PDU size average, standard deviation, min and max in bytes
+    };
+
+    /**
+     * Inserts the collected statistics into the UL and DL
+     * tables of the database. During first call it creates
+     * the tables.
+     */
+    void WriteDatabaseResults();
+
+    /**
+     * Appends the collected UL or DL statistics to a database sink.
+     * @param sink the sink
+     * @param uplink true for the UL statistics, false for the DL ones
+     */
+    void AppendDatabaseResults(BatchTraceSink<RadioBearerStatsRecord>& sink, bool uplink);
+
     /**
      * Erases collected statistics
      */
@@ -432,6 +464,16 @@ class RadioBearerStatsCalculator : public LteStatsCalculator
      * Name of the file where the uplink PDCP statistics will be saved
      */
     std::string m_ulPdcpOutputFilename;
+
+    /**
+     * Sink of the uplink statistics when they are saved in a database
+     */
+    std::unique_ptr<BatchTraceSink<RadioBearerStatsRecord>> m_ulDatabaseSink;
+
+    /**
+     * Sink of the downlink statistics when they are saved in a database
+     */
+    std::unique_ptr<BatchTraceSink<RadioBearerStatsRecord>> m_dlDatabaseSink;
 };
 
 } // namespace ns3
@@ -269,12 +269,12 @@ RadioBearerStatsConnector::ConnectTracesSrb0(std::string context,
         arg->imsi = imsi;
         arg->cellId = cellId;
         arg->stats = m_rlcStats;
-        Config::Connect(ueRrcPath + "/Srb0/LteRlc/TxPDU", MakeBoundCallback(&UlTxPduCallback, arg));
-        Config::Connect(ueRrcPath + "/Srb0/LteRlc/RxPDU", MakeBoundCallback(&DlRxPduCallback, arg));
-        Config::Connect(ueManagerPath + "/Srb0/LteRlc/TxPDU",
-                        MakeBoundCallback(&DlTxPduCallback, arg));
-        Config::Connect(ueManagerPath + "/Srb0/LteRlc/RxPDU",
-                        MakeBoundCallback(&UlRxPduCallback, arg));
+        Config::ConnectBulk(ueRrcPath + "/Srb0/LteRlc",
+                            {{"TxPDU", MakeBoundCallback(&UlTxPduCallback, arg)},
+                             {"RxPDU", MakeBoundCallback(&DlRxPduCallback, arg)}});
+        Config::ConnectBulk(ueManagerPath + "/Srb0/LteRlc",
+                            {{"TxPDU", MakeBoundCallback(&DlTxPduCallback, arg)},
+                             {"RxPDU", MakeBoundCallback(&UlRxPduCallback, arg)}});
     }
 }
 
@@ -300,12 +300,12 @@ RadioBearerStatsConnector::ConnectTracesSrb1(std::string context,
         arg->imsi = imsi;
         arg->cellId = cellId;
         arg->stats = m_rlcStats;
-        Config::Connect(ueRrcPath + "/Srb1/LteRlc/TxPDU", MakeBoundCallback(&UlTxPduCallback, arg));
-        Config::Connect(ueRrcPath + "/Srb1/LteRlc/RxPDU", MakeBoundCallback(&DlRxPduCallback, arg));
-        Config::Connect(ueManagerPath + "/Srb1/LteRlc/TxPDU",
-                        MakeBoundCallback(&DlTxPduCallback, arg));
-        Config::Connect(ueManagerPath + "/Srb1/LteRlc/RxPDU",
-                        MakeBoundCallback(&UlRxPduCallback, arg));
+        Config::ConnectBulk(ueRrcPath + "/Srb1/LteRlc",
+                            {{"TxPDU", MakeBoundCallback(&UlTxPduCallback, arg)},
+                             {"RxPDU", MakeBoundCallback(&DlRxPduCallback, arg)}});
+        Config::ConnectBulk(ueManagerPath + "/Srb1/LteRlc",
+                            {{"TxPDU", MakeBoundCallback(&DlTxPduCallback, arg)},
+                             {"RxPDU", MakeBoundCallback(&UlRxPduCallback, arg)}});
     }
     if (m_pdcpStats)
     {
@@ -313,14 +313,12 @@ RadioBearerStatsConnector::ConnectTracesSrb1(std::string context,
         arg->imsi = imsi;
         arg->cellId = cellId;
         arg->stats = m_pdcpStats;
-        Config::Connect(ueRrcPath + "/Srb1/LtePdcp/TxPDU",
-                        MakeBoundCallback(&UlTxPduCallback, arg));
-        Config::Connect(ueRrcPath + "/Srb1/LtePdcp/RxPDU",
-                        MakeBoundCallback(&DlRxPduCallback, arg));
-        Config::Connect(ueManagerPath + "/Srb1/LtePdcp/TxPDU",
-                        MakeBoundCallback(&DlTxPduCallback, arg));
-        Config::Connect(ueManagerPath + "/Srb1/LtePdcp/RxPDU",
-                        MakeBoundCallback(&UlRxPduCallback, arg));
+        Config::ConnectBulk(ueRrcPath + "/Srb1/LtePdcp",
+                            {{"TxPDU", MakeBoundCallback(&UlTxPduCallback, arg)},
+                             {"RxPDU", MakeBoundCallback(&DlRxPduCallback, arg)}});
+        Config::ConnectBulk(ueManagerPath + "/Srb1/LtePdcp",
+                            {{"TxPDU", MakeBoundCallback(&DlTxPduCallback, arg)},
+                             {"RxPDU", MakeBoundCallback(&UlRxPduCallback, arg)}});
     }
 }
 
@@ -343,8 +341,9 @@ RadioBearerStatsConnector::ConnectTracesDrbEnb(std::string context,
         arg->imsi = imsi;
         arg->cellId = cellId;
         arg->stats = m_rlcStats;
-        Config::Connect(basePath + "/LteRlc/TxPDU", MakeBoundCallback(&DlTxPduCallback, arg));
-        Config::Connect(basePath + "/LteRlc/RxPDU", MakeBoundCallback(&UlRxPduCallback, arg));
+        Config::ConnectBulk(basePath + "/LteRlc",
+                            {{"TxPDU", MakeBoundCallback(&DlTxPduCallback, arg)},
+                             {"RxPDU", MakeBoundCallback(&UlRxPduCallback, arg)}});
     }
     if (m_pdcpStats)
     {
@@ -352,11 +351,11 @@ RadioBearerStatsConnector::ConnectTracesDrbEnb(std::string context,
         arg->imsi = imsi;
         arg->cellId = cellId;
         arg->stats = m_pdcpStats;
-        bool foundTxPdcp = Config::ConnectFailSafe(basePath + "/LtePdcp/TxPDU",
-                                                   MakeBoundCallback(&DlTxPduCallback, arg));
-        bool foundRxPdcp = Config::ConnectFailSafe(basePath + "/LtePdcp/RxPDU",
-                                                   MakeBoundCallback(&UlRxPduCallback, arg));
-        if (!foundTxPdcp && !foundRxPdcp)
+        std::size_t found =
+            Config::ConnectBulkFailSafe(basePath + "/LtePdcp",
+                                        {{"TxPDU", MakeBoundCallback(&DlTxPduCallback, arg)},
+                                         {"RxPDU", MakeBoundCallback(&UlRxPduCallback, arg)}});
+        if (found == 0)
         {
             NS_LOG_WARN("Unable to connect PDCP traces. This may happen if RlcSm is used");
         }
@@ -382,8 +381,9 @@ RadioBearerStatsConnector::ConnectTracesDrbUe(std::string context,
         arg->imsi = imsi;
         arg->cellId = cellId;
         arg->stats = m_rlcStats;
-        Config::Connect(basePath + "/LteRlc/TxPDU", MakeBoundCallback(&UlTxPduCallback, arg));
-        Config::Connect(basePath + "/LteRlc/RxPDU", MakeBoundCallback(&DlRxPduCallback, arg));
+        Config::ConnectBulk(basePath + "/LteRlc",
+                            {{"TxPDU", MakeBoundCallback(&UlTxPduCallback, arg)},
+                             {"RxPDU", MakeBoundCallback(&DlRxPduCallback, arg)}});
     }
     if (m_pdcpStats)
     {
@@ -391,11 +391,11 @@ RadioBearerStatsConnector::ConnectTracesDrbUe(std::string context,
         arg->imsi = imsi;
         arg->cellId = cellId;
         arg->stats = m_pdcpStats;
-        bool foundTxPdcp = Config::ConnectFailSafe(basePath + "/LtePdcp/TxPDU",
-                                                   MakeBoundCallback(&UlTxPduCallback, arg));
-        bool foundRxPdcp = Config::ConnectFailSafe(basePath + "/LtePdcp/RxPDU",
-                                                   MakeBoundCallback(&DlRxPduCallback, arg));
-        if (!foundTxPdcp && !foundRxPdcp)
+        std::size_t found =
+            Config::ConnectBulkFailSafe(basePath + "/LtePdcp",
+                                        {{"TxPDU", MakeBoundCallback(&UlTxPduCallback, arg)},
+                                         {"RxPDU", MakeBoundCallback(&DlRxPduCallback, arg)}});
+        if (found == 0)
         {
             NS_LOG_WARN("Unable to connect PDCP traces. This may happen if RlcSm is used");
         }
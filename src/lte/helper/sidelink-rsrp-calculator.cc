@@ -174,17 +174,25 @@ SidelinkRsrpCalculator::DoCalcRsrp(Ptr<PropagationLossModel> propagationLoss,
 
     double pathLossDb = 0;
     Ptr<AntennaModel> txAntenna = DynamicCast<AntennaModel>(txPhy->GetAntenna());
+    Ptr<AntennaModel> rxAntenna = DynamicCast<AntennaModel>(rxPhy->GetAntenna());
+    Vector txPosition;
+    Vector rxPosition;
+    if (txAntenna || rxAntenna)
+    {
+        // query each position once for both antenna gains
+        txPosition = txMobility->GetPosition();
+        rxPosition = rxMobility->GetPosition();
+    }
     if (txAntenna)
     {
-        Angles txAngles(rxMobility->GetPosition(), txMobility->GetPosition());
+        Angles txAngles(rxPosition, txPosition);
         double txAntennaGain = txAntenna->GetGainDb(txAngles);
         NS_LOG_DEBUG("txAntennaGain = " << txAntennaGain << " dB");
         pathLossDb -= txAntennaGain;
     }
-    Ptr<AntennaModel> rxAntenna = DynamicCast<AntennaModel>(rxPhy->GetAntenna());
     if (rxAntenna)
     {
-        Angles rxAngles(txMobility->GetPosition(), rxMobility->GetPosition());
+        Angles rxAngles(txPosition, rxPosition);
         double rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
         NS_LOG_DEBUG("rxAntennaGain = " << rxAntennaGain << " dB");
         pathLossDb -= rxAntennaGain;
@@ -238,17 +246,25 @@ SidelinkRsrpCalculator::DoCalcRsrp(Ptr<PropagationLossModel> propagationLoss,
 
     double pathLossDb = 0;
     Ptr<AntennaModel> txAntenna = DynamicCast<AntennaModel>(txPhy->GetAntenna());
+    Ptr<AntennaModel> rxAntenna = DynamicCast<AntennaModel>(rxPhy->GetAntenna());
+    Vector txPosition;
+    Vector rxPosition;
+    if (txAntenna || rxAntenna)
+    {
+        // query each position once for both antenna gains
+        txPosition = txMobility->GetPosition();
+        rxPosition = rxMobility->GetPosition();
+    }
     if (txAntenna)
     {
-        Angles txAngles(rxMobility->GetPosition(), txMobility->GetPosition());
+        Angles txAngles(rxPosition, txPosition);
         double txAntennaGain = txAntenna->GetGainDb(txAngles);
         NS_LOG_DEBUG("txAntennaGain = " << txAntennaGain << " dB");
         pathLossDb -= txAntennaGain;
     }
-    Ptr<AntennaModel> rxAntenna = DynamicCast<AntennaModel>(rxPhy->GetAntenna());
     if (rxAntenna)
     {
-        Angles rxAngles(txMobility->GetPosition(), rxMobility->GetPosition());
+        Angles rxAngles(txPosition, rxPosition);
         double rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
         NS_LOG_DEBUG("rxAntennaGain = " << rxAntennaGain << " dB");
         pathLossDb -= rxAntennaGain;
@@ -26,9 +26,14 @@
 #include "epc-tft-classifier.h"
 
 #include "ns3/application.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/ipv6-address.h"
 #include "ns3/socket.h"
 #include "ns3/virtual-net-device.h"
 
+#include <map>
+#include <unordered_map>
+
 namespace ns3
 {
 
@@ -320,22 +325,22 @@ class EpcPgwApplication : public Application
     /**
      * UeInfo stored by UE IPv4 address
      */
-    std::map<Ipv4Address, Ptr<UeInfo>> m_ueInfoByAddrMap;
+    std::unordered_map<Ipv4Address, Ptr<UeInfo>, Ipv4AddressHash> m_ueInfoByAddrMap;
 
     /**
      * UeInfo stored by UE IPv6 address
      */
-    std::map<Ipv6Address, Ptr<UeInfo>> m_ueInfoByAddrMap6;
+    std::unordered_map<Ipv6Address, Ptr<UeInfo>, Ipv6AddressHash> m_ueInfoByAddrMap6;
 
     /**
      * UeInfo stored by IMSI
      */
-    std::map<uint64_t, Ptr<UeInfo>> m_ueInfoByImsiMap;
+    std::unordered_map<uint64_t, Ptr<UeInfo>> m_ueInfoByImsiMap;
 
     /**
      * Map telling for each remote UE prefix the corresponding relay UE info
      */
-    std::map<Ipv6Address, Ptr<UeInfo>> m_ueInfoByRemotePrefixMap;
+    std::unordered_map<Ipv6Address, Ptr<UeInfo>, Ipv6AddressHash> m_ueInfoByRemotePrefixMap;
 
     /**
      * UDP port to be used for GTP-U
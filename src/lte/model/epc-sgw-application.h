@@ -26,7 +26,7 @@
 #include "ns3/application.h"
 #include "ns3/socket.h"
 
-#include <map>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -257,17 +257,17 @@ class EpcSgwApplication : public Application
     /**
      * Map for eNB info by cell ID
      */
-    std::map<uint16_t, EnbInfo> m_enbInfoByCellId;
+    std::unordered_map<uint16_t, EnbInfo> m_enbInfoByCellId;
 
     /**
      * Map for eNB address by TEID
      */
-    std::map<uint32_t, Ipv4Address> m_enbByTeidMap;
+    std::unordered_map<uint32_t, Ipv4Address> m_enbByTeidMap;
 
     /**
      * MME S11 FTEID by SGW S5C TEID
      */
-    std::map<uint32_t, GtpcHeader::Fteid_t> m_mmeS11FteidBySgwS5cTeid;
+    std::unordered_map<uint32_t, GtpcHeader::Fteid_t> m_mmeS11FteidBySgwS5cTeid;
 };
 
 } // namespace ns3
@@ -39,12 +39,64 @@
 #include "ns3/udp-header.h"
 #include "ns3/udp-l4-protocol.h"
 
+#include <utility>
+
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("EpcTftClassifier");
 
+EpcTftClassifier::CompiledFilter::CompiledFilter(const EpcTft::PacketFilter& f, uint32_t id)
+    : id(id),
+      remoteAddress(f.remoteAddress.Get() & f.remoteMask.Get()),
+      remoteMask(f.remoteMask.Get()),
+      localAddress(f.localAddress.Get() & f.localMask.Get()),
+      localMask(f.localMask.Get()),
+      remoteIpv6Address(f.remoteIpv6Address),
+      remoteIpv6Prefix(f.remoteIpv6Prefix),
+      localIpv6Address(f.localIpv6Address),
+      localIpv6Prefix(f.localIpv6Prefix),
+      remotePortStart(f.remotePortStart),
+      remotePortEnd(f.remotePortEnd),
+      localPortStart(f.localPortStart),
+      localPortEnd(f.localPortEnd),
+      typeOfService(f.typeOfService & f.typeOfServiceMask),
+      typeOfServiceMask(f.typeOfServiceMask)
+{
+    uint8_t remotePrefix[16];
+    uint8_t localPrefix[16];
+    remoteIpv6Prefix.GetBytes(remotePrefix);
+    localIpv6Prefix.GetBytes(localPrefix);
+    anyIpv6Address = true;
+    for (uint8_t i = 0; i < 16; i++)
+    {
+        anyIpv6Address = anyIpv6Address && remotePrefix[i] == 0 && localPrefix[i] == 0;
+    }
+}
+
+bool
+EpcTftClassifier::CompiledFilter::UsesPorts() const
+{
+    return remotePortStart != 0 || remotePortEnd != 65535 || localPortStart != 0 ||
+           localPortEnd != 65535;
+}
+
+bool
+EpcTftClassifier::CompiledFilter::MatchesAllIpv4() const
+{
+    return remoteMask == 0 && localMask == 0 && !UsesPorts() && typeOfServiceMask == 0;
+}
+
+bool
+EpcTftClassifier::CompiledFilter::MatchesAllIpv6() const
+{
+    return anyIpv6Address && !UsesPorts() && typeOfServiceMask == 0;
+}
+
 EpcTftClassifier::EpcTftClassifier()
+    : m_usesPorts{false, false},
+      m_matchAllIpv4{0, 0},
+      m_matchAllIpv6{0, 0}
 {
     NS_LOG_FUNCTION(this);
 }
@@ -57,6 +109,7 @@ EpcTftClassifier::Add(Ptr<EpcTft> tft, uint32_t id)
 
     // simple sanity check: there shouldn't be more than 16 bearers (hence TFTs) per UE
     NS_ASSERT(m_tftMap.size() <= 16);
+    Compile();
 }
 
 void
@@ -64,14 +117,61 @@ EpcTftClassifier::Delete(uint32_t id)
 {
     NS_LOG_FUNCTION(this << id);
     m_tftMap.erase(id);
+    Compile();
+}
+
+void
+EpcTftClassifier::Compile()
+{
+    NS_LOG_FUNCTION(this);
+    for (uint8_t index = 0; index < 2; index++)
+    {
+        EpcTft::Direction direction = (index == 0) ? EpcTft::DOWNLINK : EpcTft::UPLINK;
+        std::vector<CompiledFilter>& filters = m_filters[index];
+        filters.clear();
+        m_usesPorts[index] = false;
+
+        // we use a reverse iterator since filter priority is not implemented properly.
+        // This way, since the default bearer is expected to be added first, it will be evaluated
+        // last.
+        for (auto it = m_tftMap.rbegin(); it != m_tftMap.rend(); ++it)
+        {
+            for (const auto& f : it->second->GetPacketFilters())
+            {
+                if (f.direction & direction)
+                {
+                    filters.emplace_back(f, it->first);
+                    m_usesPorts[index] = m_usesPorts[index] || filters.back().UsesPorts();
+                }
+            }
+        }
+
+        m_matchAllIpv4[index] =
+            (!filters.empty() && filters.front().MatchesAllIpv4()) ? filters.front().id : 0;
+        m_matchAllIpv6[index] =
+            (!filters.empty() && filters.front().MatchesAllIpv6()) ? filters.front().id : 0;
+        NS_LOG_LOGIC(direction << ": " << filters.size() << " filters, uses ports "
+                               << m_usesPorts[index]);
+    }
 }
 
 uint32_t
 EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t protocolNumber)
 {
     NS_LOG_FUNCTION(this << p << p->GetSize() << direction);
+    NS_ASSERT(direction == EpcTft::DOWNLINK || direction == EpcTft::UPLINK);
+    const uint8_t index = (direction == EpcTft::DOWNLINK) ? 0 : 1;
 
-    Ptr<Packet> pCopy = p->Copy();
+    if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER && m_matchAllIpv4[index] != 0)
+    {
+        NS_LOG_LOGIC("matches with TFT ID = " << m_matchAllIpv4[index]);
+        return m_matchAllIpv4[index];
+    }
+    if (protocolNumber == Ipv6L3Protocol::PROT_NUMBER && m_matchAllIpv6[index] != 0)
+    {
+        NS_LOG_LOGIC("matches with TFT ID = " << m_matchAllIpv6[index]);
+        return m_matchAllIpv6[index];
+    }
 
     Ipv4Address localAddressIpv4;
     Ipv4Address remoteAddressIpv4;
@@ -88,7 +188,7 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
     if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
     {
         Ipv4Header ipv4Header;
-        pCopy->RemoveHeader(ipv4Header);
+        p->PeekHeader(ipv4Header);
 
         if (direction == EpcTft::UPLINK)
         {
@@ -97,7 +197,6 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
         }
         else
         {
-            NS_ASSERT(direction == EpcTft::DOWNLINK);
             remoteAddressIpv4 = ipv4Header.GetSource();
             localAddressIpv4 = ipv4Header.GetDestination();
         }
@@ -108,10 +207,6 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
         uint16_t fragmentOffset = ipv4Header.GetFragmentOffset();
         bool isLastFragment = ipv4Header.IsLastFragment();
 
-        // NS_LOG_DEBUG ("PayloadSize = " << payloadSize);
-        // NS_LOG_DEBUG ("fragmentOffset " << fragmentOffset << " isLastFragment " <<
-        // isLastFragment);
-
         protocol = ipv4Header.GetProtocol();
         tos = ipv4Header.GetTos();
 
@@ -119,48 +214,45 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
         // there is enough data in the payload
         // We keep the port info for fragmented packets,
         // i.e. it is the first one but it is not the last one
-        if (fragmentOffset == 0)
+        // Nothing is done if no packet filter uses the ports
+        if (!m_usesPorts[index])
         {
+            NS_LOG_LOGIC("port info not needed");
+        }
+        else if (fragmentOffset == 0)
+        {
+            bool hasPorts = false;
             if (protocol == UdpL4Protocol::PROT_NUMBER && payloadSize >= 8)
             {
+                Ptr<Packet> pCopy = p->Copy();
+                pCopy->RemoveHeader(ipv4Header);
                 UdpHeader udpHeader;
-                pCopy->RemoveHeader(udpHeader);
-                if (direction == EpcTft::UPLINK)
-                {
-                    localPort = udpHeader.GetSourcePort();
-                    remotePort = udpHeader.GetDestinationPort();
-                }
-                else
-                {
-                    remotePort = udpHeader.GetSourcePort();
-                    localPort = udpHeader.GetDestinationPort();
-                }
-                if (!isLastFragment)
-                {
-                    std::tuple<uint32_t, uint32_t, uint8_t, uint16_t> fragmentKey =
-                        std::make_tuple(ipv4Header.GetSource().Get(),
-                                        ipv4Header.GetDestination().Get(),
-                                        protocol,
-                                        ipv4Header.GetIdentification());
-
-                    m_classifiedIpv4Fragments[fragmentKey] = std::make_pair(localPort, remotePort);
-                }
+                pCopy->PeekHeader(udpHeader);
+                remotePort = udpHeader.GetSourcePort();
+                localPort = udpHeader.GetDestinationPort();
+                hasPorts = true;
             }
             else if (protocol == TcpL4Protocol::PROT_NUMBER && payloadSize >= 20)
             {
+                Ptr<Packet> pCopy = p->Copy();
+                pCopy->RemoveHeader(ipv4Header);
                 TcpHeader tcpHeader;
-                pCopy->RemoveHeader(tcpHeader);
+                pCopy->PeekHeader(tcpHeader);
+                remotePort = tcpHeader.GetSourcePort();
+                localPort = tcpHeader.GetDestinationPort();
+                hasPorts = true;
+            }
+
+            // else
+            //   First fragment but not enough data for port info or not UDP/TCP protocol.
+            //   Nothing can be done, i.e. we cannot get port info from packet.
+
+            if (hasPorts)
+            {
                 if (direction == EpcTft::UPLINK)
                 {
-                    localPort = tcpHeader.GetSourcePort();
-                    remotePort = tcpHeader.GetDestinationPort();
-                }
-                else
-                {
-                    remotePort = tcpHeader.GetSourcePort();
-                    localPort = tcpHeader.GetDestinationPort();
+                    std::swap(localPort, remotePort);
                 }
-
                 if (!isLastFragment)
                 {
                     std::tuple<uint32_t, uint32_t, uint8_t, uint16_t> fragmentKey =
@@ -172,10 +264,6 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
                     m_classifiedIpv4Fragments[fragmentKey] = std::make_pair(localPort, remotePort);
                 }
             }
-
-            // else
-            //   First fragment but not enough data for port info or not UDP/TCP protocol.
-            //   Nothing can be done, i.e. we cannot get port info from packet.
         }
         else
         {
@@ -196,7 +284,7 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
 
                 if (isLastFragment)
                 {
-                    m_classifiedIpv4Fragments.erase(fragmentKey);
+                    m_classifiedIpv4Fragments.erase(it);
                 }
             }
         }
@@ -204,7 +292,7 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
     else if (protocolNumber == Ipv6L3Protocol::PROT_NUMBER)
     {
         Ipv6Header ipv6Header;
-        pCopy->RemoveHeader(ipv6Header);
+        p->PeekHeader(ipv6Header);
 
         if (direction == EpcTft::UPLINK)
         {
@@ -213,7 +301,6 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
         }
         else
         {
-            NS_ASSERT(direction == EpcTft::DOWNLINK);
             remoteAddressIpv6 = ipv6Header.GetSource();
             localAddressIpv6 = ipv6Header.GetDestination();
         }
@@ -223,36 +310,31 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
         protocol = ipv6Header.GetNextHeader();
         tos = ipv6Header.GetTrafficClass();
 
-        if (protocol == UdpL4Protocol::PROT_NUMBER)
+        if (!m_usesPorts[index])
         {
+            NS_LOG_LOGIC("port info not needed");
+        }
+        else if (protocol == UdpL4Protocol::PROT_NUMBER)
+        {
+            Ptr<Packet> pCopy = p->Copy();
+            pCopy->RemoveHeader(ipv6Header);
             UdpHeader udpHeader;
-            pCopy->RemoveHeader(udpHeader);
-
-            if (direction == EpcTft::UPLINK)
-            {
-                localPort = udpHeader.GetSourcePort();
-                remotePort = udpHeader.GetDestinationPort();
-            }
-            else
-            {
-                remotePort = udpHeader.GetSourcePort();
-                localPort = udpHeader.GetDestinationPort();
-            }
+            pCopy->PeekHeader(udpHeader);
+            remotePort = udpHeader.GetSourcePort();
+            localPort = udpHeader.GetDestinationPort();
         }
         else if (protocol == TcpL4Protocol::PROT_NUMBER)
         {
+            Ptr<Packet> pCopy = p->Copy();
+            pCopy->RemoveHeader(ipv6Header);
             TcpHeader tcpHeader;
-            pCopy->RemoveHeader(tcpHeader);
-            if (direction == EpcTft::UPLINK)
-            {
-                localPort = tcpHeader.GetSourcePort();
-                remotePort = tcpHeader.GetDestinationPort();
-            }
-            else
-            {
-                remotePort = tcpHeader.GetSourcePort();
-                localPort = tcpHeader.GetDestinationPort();
-            }
+            pCopy->PeekHeader(tcpHeader);
+            remotePort = tcpHeader.GetSourcePort();
+            localPort = tcpHeader.GetDestinationPort();
+        }
+        if (direction == EpcTft::UPLINK)
+        {
+            std::swap(localPort, remotePort);
         }
     }
     else
@@ -260,6 +342,8 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
         NS_ABORT_MSG("EpcTftClassifier::Classify - Unknown IP type...");
     }
 
+    // now it is possible to classify the packet!
+    NS_LOG_LOGIC("filters: " << m_filters[index].size());
     if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
     {
         NS_LOG_INFO("Classifying packet:"
@@ -267,58 +351,38 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
                     << " localPort=" << localPort << " remotePort=" << remotePort << " tos=0x"
                     << (uint16_t)tos);
 
-        // now it is possible to classify the packet!
-        // we use a reverse iterator since filter priority is not implemented properly.
-        // This way, since the default bearer is expected to be added first, it will be evaluated
-        // last.
-        std::map<uint32_t, Ptr<EpcTft>>::const_reverse_iterator it;
-        NS_LOG_LOGIC("TFT MAP size: " << m_tftMap.size());
-
-        for (it = m_tftMap.rbegin(); it != m_tftMap.rend(); ++it)
+        uint32_t remoteAddress = remoteAddressIpv4.Get();
+        uint32_t localAddress = localAddressIpv4.Get();
+        for (const auto& f : m_filters[index])
         {
-            NS_LOG_LOGIC("TFT id: " << it->first);
-            NS_LOG_LOGIC(" Ptr<EpcTft>: " << it->second);
-            Ptr<EpcTft> tft = it->second;
-            if (tft->Matches(direction,
-                             remoteAddressIpv4,
-                             localAddressIpv4,
-                             remotePort,
-                             localPort,
-                             tos))
+            if ((remoteAddress & f.remoteMask) == f.remoteAddress &&
+                (localAddress & f.localMask) == f.localAddress && f.remotePortStart <= remotePort &&
+                remotePort <= f.remotePortEnd && f.localPortStart <= localPort &&
+                localPort <= f.localPortEnd && (tos & f.typeOfServiceMask) == f.typeOfService)
             {
-                NS_LOG_LOGIC("matches with TFT ID = " << it->first);
-                return it->first; // the id of the matching TFT
+                NS_LOG_LOGIC("matches with TFT ID = " << f.id);
+                return f.id; // the id of the matching TFT
             }
         }
     }
-    else if (protocolNumber == Ipv6L3Protocol::PROT_NUMBER)
+    else
     {
         NS_LOG_INFO("Classifying packet:"
                     << " localAddr=" << localAddressIpv6 << " remoteAddr=" << remoteAddressIpv6
                     << " localPort=" << localPort << " remotePort=" << remotePort << " tos=0x"
                     << (uint16_t)tos);
 
-        // now it is possible to classify the packet!
-        // we use a reverse iterator since filter priority is not implemented properly.
-        // This way, since the default bearer is expected to be added first, it will be evaluated
-        // last.
-        std::map<uint32_t, Ptr<EpcTft>>::const_reverse_iterator it;
-        NS_LOG_LOGIC("TFT MAP size: " << m_tftMap.size());
-
-        for (it = m_tftMap.rbegin(); it != m_tftMap.rend(); ++it)
+        for (const auto& f : m_filters[index])
         {
-            NS_LOG_LOGIC("TFT id: " << it->first);
-            NS_LOG_LOGIC(" Ptr<EpcTft>: " << it->second);
-            Ptr<EpcTft> tft = it->second;
-            if (tft->Matches(direction,
-                             remoteAddressIpv6,
-                             localAddressIpv6,
-                             remotePort,
-                             localPort,
-                             tos))
+            if (f.remotePortStart <= remotePort && remotePort <= f.remotePortEnd &&
+                f.localPortStart <= localPort && localPort <= f.localPortEnd &&
+                (tos & f.typeOfServiceMask) == f.typeOfService &&
+                (f.anyIpv6Address ||
+                 (f.remoteIpv6Prefix.IsMatch(f.remoteIpv6Address, remoteAddressIpv6) &&
+                  f.localIpv6Prefix.IsMatch(f.localIpv6Address, localAddressIpv6))))
             {
-                NS_LOG_LOGIC("matches with TFT ID = " << it->first);
-                return it->first; // the id of the matching TFT
+                NS_LOG_LOGIC("matches with TFT ID = " << f.id);
+                return f.id; // the id of the matching TFT
             }
         }
     }
@@ -26,6 +26,8 @@
 #include "ns3/simple-ref-count.h"
 
 #include <map>
+#include <tuple>
+#include <vector>
 
 namespace ns3
 {
@@ -48,6 +50,13 @@ class Packet;
  *
  * When we cannot cache the port info, the TFT of the default bearer is used. This may happen
  * if there is reordering or losses of IP packets.
+ *
+ * The packet filters of the TFTs are compiled, when a TFT is added or deleted, into one
+ * list per direction, sorted in evaluation order.  A packet is then classified with a single
+ * parse of its headers; the transport header is not parsed at all if no packet filter of the
+ * direction uses the ports, and no header is parsed if the first filter to be evaluated
+ * matches every packet (e.g., a UE with the default bearer only).  As a consequence, the
+ * packet filters of a TFT must be added before the TFT is added to the classifier.
  */
 class EpcTftClassifier : public SimpleRefCount<EpcTftClassifier>
 {
@@ -83,8 +92,67 @@ class EpcTftClassifier : public SimpleRefCount<EpcTftClassifier>
     uint32_t Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t protocolNumber);
 
   protected:
+    /**
+     * Packet filter of a TFT, as evaluated by the classifier
+     */
+    struct CompiledFilter
+    {
+        /**
+         * Compile a packet filter
+         *
+         * \param f the packet filter
+         * \param id the ID of the TFT the filter belongs to
+         */
+        CompiledFilter(const EpcTft::PacketFilter& f, uint32_t id);
+
+        /**
+         * \return true if the filter matches every IPv4 packet
+         */
+        bool MatchesAllIpv4() const;
+
+        /**
+         * \return true if the filter matches every IPv6 packet
+         */
+        bool MatchesAllIpv6() const;
+
+        /**
+         * \return true if the filter checks the ports
+         */
+        bool UsesPorts() const;
+
+        uint32_t id;                   ///< ID of the TFT the filter belongs to
+        uint32_t remoteAddress;        ///< masked IPv4 address of the remote host
+        uint32_t remoteMask;           ///< IPv4 address mask of the remote host
+        uint32_t localAddress;         ///< masked IPv4 address of the UE
+        uint32_t localMask;            ///< IPv4 address mask of the UE
+        Ipv6Address remoteIpv6Address; ///< IPv6 address of the remote host
+        Ipv6Prefix remoteIpv6Prefix;   ///< IPv6 address prefix of the remote host
+        Ipv6Address localIpv6Address;  ///< IPv6 address of the UE
+        Ipv6Prefix localIpv6Prefix;    ///< IPv6 address prefix of the UE
+        bool anyIpv6Address;           ///< whether both IPv6 prefixes are zero
+        uint16_t remotePortStart;      ///< start of the port number range of the remote host
+        uint16_t remotePortEnd;        ///< end of the port number range of the remote host
+        uint16_t localPortStart;       ///< start of the port number range of the UE
+        uint16_t localPortEnd;         ///< end of the port number range of the UE
+        uint8_t typeOfService;         ///< masked type of service field
+        uint8_t typeOfServiceMask;     ///< type of service field mask
+    };
+
+    /**
+     * Compile the packet filters of the TFTs in m_tftMap
+     */
+    void Compile();
+
     std::map<uint32_t, Ptr<EpcTft>> m_tftMap; ///< TFT map
 
+    std::vector<CompiledFilter> m_filters[2]; ///< compiled packet filters in evaluation order,
+                                              ///< for the downlink [0] and the uplink [1]
+    bool m_usesPorts[2];                      ///< whether any filter of the direction uses ports
+    uint32_t m_matchAllIpv4[2]; ///< ID of the TFT classifying every IPv4 packet of the
+                                ///< direction, if its filter is evaluated first; 0 otherwise
+    uint32_t m_matchAllIpv6[2]; ///< ID of the TFT classifying every IPv6 packet of the
+                                ///< direction, if its filter is evaluated first; 0 otherwise
+
     std::map<std::tuple<uint32_t, uint32_t, uint8_t, uint16_t>, std::pair<uint32_t, uint32_t>>
         m_classifiedIpv4Fragments; ///< Map with already classified IPv4 Fragments
                                    ///< An entry is added when the port info is available, i.e.
@@ -239,55 +239,42 @@ EpcUeNas::Send(Ptr<Packet> packet, uint16_t protocolNumber)
     case ACTIVE: {
         // First Check if there is any sidelink bearer for the destination
         // otherwise it may use the default bearer
-        Ptr<Packet> pCopy = packet->Copy();
         if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
         {
             Ipv4Header ipv4Header;
-            pCopy->RemoveHeader(ipv4Header);
-            for (auto it = m_slBearersActivatedList.begin(); it != m_slBearersActivatedList.end();
-                 it++)
+            packet->PeekHeader(ipv4Header);
+            Ptr<LteSlTft> tft =
+                m_slBearersActivated.Classify(ipv4Header.GetSource(), ipv4Header.GetDestination());
+            if (tft)
             {
-                if ((*it)->Matches(ipv4Header.GetSource(), ipv4Header.GetDestination()))
-                {
-                    // Found sidelink
-                    m_asSapProvider->SendDataToGroup(packet, (*it)->GetRemoteL2Address());
-                    return true;
-                }
+                // Found sidelink
+                m_asSapProvider->SendDataToGroup(packet, tft->GetRemoteL2Address());
+                return true;
             }
             // check if pending
-            for (auto it = m_pendingSlBearersList.begin(); it != m_pendingSlBearersList.end(); it++)
+            if (m_pendingSlBearers.Classify(ipv4Header.GetSource(), ipv4Header.GetDestination()))
             {
-                if ((*it)->Matches(ipv4Header.GetSource(), ipv4Header.GetDestination()))
-                {
-                    NS_LOG_WARN(this
-                                << "Matching sidelink bearer still pending, discarding packet");
-                    return false;
-                }
+                NS_LOG_WARN(this << "Matching sidelink bearer still pending, discarding packet");
+                return false;
             }
         }
         if (protocolNumber == Ipv6L3Protocol::PROT_NUMBER)
         {
             Ipv6Header ipv6Header;
-            pCopy->RemoveHeader(ipv6Header);
-            for (auto it = m_slBearersActivatedList.begin(); it != m_slBearersActivatedList.end();
-                 it++)
+            packet->PeekHeader(ipv6Header);
+            Ptr<LteSlTft> tft =
+                m_slBearersActivated.Classify(ipv6Header.GetSource(), ipv6Header.GetDestination());
+            if (tft)
             {
-                if ((*it)->Matches(ipv6Header.GetSource(), ipv6Header.GetDestination()))
-                {
-                    // Found sidelink
-                    m_asSapProvider->SendDataToGroup(packet, (*it)->GetRemoteL2Address());
-                    return true;
-                }
+                // Found sidelink
+                m_asSapProvider->SendDataToGroup(packet, tft->GetRemoteL2Address());
+                return true;
             }
             // check if pending
-            for (auto it = m_pendingSlBearersList.begin(); it != m_pendingSlBearersList.end(); it++)
+            if (m_pendingSlBearers.Classify(ipv6Header.GetSource(), ipv6Header.GetDestination()))
             {
-                if ((*it)->Matches(ipv6Header.GetSource(), ipv6Header.GetDestination()))
-                {
-                    NS_LOG_WARN(this
-                                << "Matching sidelink bearer still pending, discarding packet");
-                    return false;
-                }
+                NS_LOG_WARN(this << "Matching sidelink bearer still pending, discarding packet");
+                return false;
             }
         }
         // No sidelink found
@@ -308,36 +295,26 @@ EpcUeNas::Send(Ptr<Packet> packet, uint16_t protocolNumber)
     break;
     case OFF: {
         // Check if there is any sidelink bearer for the destination
-        Ptr<Packet> pCopy = packet->Copy();
+        Ptr<LteSlTft> tft;
         if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
         {
             Ipv4Header ipv4Header;
-            pCopy->RemoveHeader(ipv4Header);
-            for (auto it = m_slBearersActivatedList.begin(); it != m_slBearersActivatedList.end();
-                 it++)
-            {
-                if ((*it)->Matches(ipv4Header.GetSource(), ipv4Header.GetDestination()))
-                {
-                    // Found sidelink
-                    m_asSapProvider->SendDataToGroup(packet, (*it)->GetRemoteL2Address());
-                    return true;
-                }
-            }
+            packet->PeekHeader(ipv4Header);
+            tft =
+                m_slBearersActivated.Classify(ipv4Header.GetSource(), ipv4Header.GetDestination());
         }
         if (protocolNumber == Ipv6L3Protocol::PROT_NUMBER)
         {
             Ipv6Header ipv6Header;
-            pCopy->RemoveHeader(ipv6Header);
-            for (auto it = m_slBearersActivatedList.begin(); it != m_slBearersActivatedList.end();
-                 it++)
-            {
-                if ((*it)->Matches(ipv6Header.GetSource(), ipv6Header.GetDestination()))
-                {
-                    // Found sidelink
-                    m_asSapProvider->SendDataToGroup(packet, (*it)->GetRemoteL2Address());
-                    return true;
-                }
-            }
+            packet->PeekHeader(ipv6Header);
+            tft =
+                m_slBearersActivated.Classify(ipv6Header.GetSource(), ipv6Header.GetDestination());
+        }
+        if (tft)
+        {
+            // Found sidelink
+            m_asSapProvider->SendDataToGroup(packet, tft->GetRemoteL2Address());
+            return true;
         }
     }
     default:
@@ -455,7 +432,7 @@ EpcUeNas::ActivateSidelinkBearer(Ptr<LteSlTft> tft)
     // regardless of the state we need to request RRC to setup the bearer
     // for in coverage case, it will trigger communication with the eNodeb
     // for out of coverage, it will trigger the use of preconfiguration
-    m_pendingSlBearersList.push_back(tft);
+    m_pendingSlBearers.Add(tft);
     m_asSapProvider->ActivateSidelinkRadioBearer(tft->GetRemoteL2Address(),
                                                  tft->isTransmit(),
                                                  tft->isReceive());
@@ -465,16 +442,11 @@ void
 EpcUeNas::DeactivateSidelinkBearer(Ptr<LteSlTft> tft)
 {
     NS_LOG_FUNCTION(this);
-    for (auto it = m_slBearersActivatedList.begin(); it != m_slBearersActivatedList.end(); it++)
+    if (m_slBearersActivated.Remove(tft))
     {
-        if (*it == tft)
-        {
-            NS_LOG_LOGIC("Found tft to remove for group " << tft->GetRemoteL2Address());
-            // found the sidelink to remove
-            m_asSapProvider->DeactivateSidelinkRadioBearer(tft->GetRemoteL2Address());
-            m_slBearersActivatedList.erase(it);
-            break;
-        }
+        NS_LOG_LOGIC("Found tft to remove for group " << tft->GetRemoteL2Address());
+        // found the sidelink to remove
+        m_asSapProvider->DeactivateSidelinkRadioBearer(tft->GetRemoteL2Address());
     }
 }
 
@@ -483,19 +455,10 @@ EpcUeNas::DoNotifySidelinkRadioBearerActivated(uint32_t group)
 {
     NS_LOG_FUNCTION(this);
 
-    auto it = m_pendingSlBearersList.begin();
-    while (it != m_pendingSlBearersList.end())
+    for (const auto& tft : m_pendingSlBearers.RemoveGroup(group))
     {
-        if ((*it)->GetRemoteL2Address() == group)
-        {
-            // Found sidelink
-            m_slBearersActivatedList.push_back(*it);
-            it = m_pendingSlBearersList.erase(it);
-        }
-        else
-        {
-            it++;
-        }
+        // Found sidelink
+        m_slBearersActivated.Add(tft);
     }
 }
 
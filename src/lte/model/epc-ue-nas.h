@@ -283,9 +283,9 @@ class EpcUeNas : public Object
 
     std::list<BearerToBeActivated> m_bearersToBeActivatedList; ///< bearers to be activated list
 
-    std::list<Ptr<LteSlTft>> m_pendingSlBearersList; ///< pending Sidelink bearers list
+    LteSlTftClassifier m_pendingSlBearers; ///< pending Sidelink bearers
 
-    std::list<Ptr<LteSlTft>> m_slBearersActivatedList; ///< Sidelink bearers activated list
+    LteSlTftClassifier m_slBearersActivated; ///< Sidelink bearers activated
 
     /**
      * bearers to be activated list maintained and to be used for reconnecting
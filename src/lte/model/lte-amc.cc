@@ -31,6 +31,8 @@
 #include <ns3/math.h>
 #include <ns3/spectrum-value.h>
 
+#include <algorithm>
+#include <array>
 #include <vector>
 
 namespace ns3
@@ -114,7 +116,7 @@ static const int McsToItbsDl[29] = {
  * 36.213 v8.8.0 Table 8.6.1-1: _Modulation, TBS index and redundancy version table for PUSCH_.
  * The index of the vector (range 0-28) identifies the MCS index.
  */
-static const int McsToItbsUl[29] = {
+static constexpr int McsToItbsUl[29] = {
     0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 10, 11, 12, 13,
     14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 23, 24, 25, 26,
 };
@@ -127,7 +129,7 @@ static const int McsToItbsUl[29] = {
  *       consistent with the other values, therefore we use 88 obtained by
  *       following the sequence of NPRB = 1 values.
  */
-static const int TransportBlockSizeTable[110][27] = {
+static constexpr int TransportBlockSizeTable[110][27] = {
     /* NPRB 001*/ {16,  24,  32,  40,  56,  72,  88,  104, 120, 136, 144, 176, 208, 224,
                    256, 280, 328, 336, 376, 408, 440, 488, 520, 552, 584, 616, 712},
     /* NPRB 002*/ {32,  56,  72,  104, 120, 144, 176, 224,  256,  296,  328,  376,  440, 488,
@@ -457,6 +459,60 @@ static const int TransportBlockSizeTable[110][27] = {
                    43816, 46888, 51024, 55056, 59256, 63776, 66592, 71112, 75376},
 };
 
+/// Uplink transport block sizes, indexed by the number of PRBs minus one and the MCS index
+typedef std::array<std::array<int, 29>, 110> UlTbSizeTable_t;
+
+/**
+ * Build the table of the uplink transport block sizes from the MCS to ITBS
+ * table and the transport block size table, at compile time.
+ * \return the table of the uplink transport block sizes
+ */
+static constexpr UlTbSizeTable_t
+BuildUlTbSizeTable()
+{
+    UlTbSizeTable_t table{};
+    for (std::size_t nprb = 0; nprb < table.size(); nprb++)
+    {
+        for (std::size_t mcs = 0; mcs < table[nprb].size(); mcs++)
+        {
+            table[nprb][mcs] = TransportBlockSizeTable[nprb][McsToItbsUl[mcs]];
+        }
+    }
+    return table;
+}
+
+/**
+ * Check that the uplink transport block sizes increase with the MCS index
+ * and with the number of PRBs, so that they can be searched by bisection.
+ * \param table the table of the uplink transport block sizes
+ * \return true if the table is sorted along both dimensions
+ */
+static constexpr bool
+IsSorted(const UlTbSizeTable_t& table)
+{
+    for (std::size_t nprb = 0; nprb < table.size(); nprb++)
+    {
+        for (std::size_t mcs = 0; mcs < table[nprb].size(); mcs++)
+        {
+            if ((mcs > 0 && table[nprb][mcs] < table[nprb][mcs - 1]) ||
+                (nprb > 0 && table[nprb][mcs] < table[nprb - 1][mcs]))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Uplink transport block size for each number of PRBs (minus one) and MCS
+ * index: each row is the inverse index of the transport block sizes reachable
+ * with that number of PRBs.
+ */
+static constexpr UlTbSizeTable_t UlTbSizeTable = BuildUlTbSizeTable();
+
+static_assert(IsSorted(UlTbSizeTable), "The uplink TBS must increase with the MCS and the PRBs");
+
 LteAmc::LteAmc()
 {
 }
@@ -552,25 +608,27 @@ LteAmc::GetUlMcsNprbInfoFromTbs(int tbs, int max_nprb, int max_mcs)
     NS_ASSERT_MSG(max_mcs < 29, "MCS=" << max_mcs);
 
     std::vector<LteAmc::McsPrbInfo> McsPrbVector;
-    int itbs = 0;
-    int grantTbs = 0; // The TBS obtained from MCS and PRB combination
-    // Find tbs >= in TransportBlockSizeTable
-    for (int inprb = 0; inprb < max_nprb; inprb++)
+    if (max_nprb <= 0)
     {
-        for (int mcs = 0; mcs <= max_mcs; mcs++)
-        {
-            itbs = McsToItbsUl[mcs];
-            grantTbs = TransportBlockSizeTable[inprb][itbs];
-            if (grantTbs >= tbs)
-            {
-                LteAmc::McsPrbInfo grantInfo;
-                grantInfo.mcs = mcs;
-                grantInfo.nbRb = inprb + 1;
-                grantInfo.tbs = grantTbs;
-                McsPrbVector.push_back(grantInfo);
-                break;
-            }
-        }
+        return McsPrbVector;
+    }
+    // The TBS increase with the MCS and the PRBs: find by bisection the first
+    // number of PRBs reaching tbs with max_mcs, and then the minimum MCS
+    // reaching tbs for each number of PRBs from there
+    auto firstRow = std::partition_point(UlTbSizeTable.begin(),
+                                         UlTbSizeTable.begin() + max_nprb,
+                                         [tbs, max_mcs](const std::array<int, 29>& row) {
+                                             return row[max_mcs] < tbs;
+                                         });
+    McsPrbVector.reserve(UlTbSizeTable.begin() + max_nprb - firstRow);
+    for (auto row = firstRow; row != UlTbSizeTable.begin() + max_nprb; row++)
+    {
+        auto grantTbs = std::lower_bound(row->begin(), row->begin() + max_mcs + 1, tbs);
+        LteAmc::McsPrbInfo grantInfo;
+        grantInfo.mcs = grantTbs - row->begin();
+        grantInfo.nbRb = row - UlTbSizeTable.begin() + 1;
+        grantInfo.tbs = *grantTbs;
+        McsPrbVector.push_back(grantInfo);
     }
     return McsPrbVector;
 }
@@ -108,10 +108,15 @@ class LteAmc : public Object
 
     /**
      * \brief Get vector of McsPrbInfo that can accommodate a transport block size.
+     *
+     * For each number of PRBs which can accommodate the transport block size,
+     * the minimum MCS is returned. The uplink transport block sizes are
+     * tabulated at compile time, and searched by bisection.
+     *
      * \param tbs the transport block size
      * \param max_prb maximum number of PRBs allowed
      * \param max_mcs maximum MCS value allowed
-     * @return a vector with all the resulting McsPrbInfo
+     * @return a vector with all the resulting McsPrbInfo, by increasing number of PRBs
      */
     std::vector<LteAmc::McsPrbInfo> GetUlMcsNprbInfoFromTbs(int tbs,
                                                             int max_prb = 110,
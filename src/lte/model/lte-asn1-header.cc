@@ -21,6 +21,7 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 
@@ -49,6 +50,8 @@ Asn1Header::Asn1Header()
     m_serializationPendingBits = 0x00;
     m_numSerializationPendingBits = 0;
     m_isDataSerialized = false;
+    m_serializationBits = 0;
+    m_numSerializationBits = 0;
 }
 
 Asn1Header::~Asn1Header()
@@ -78,96 +81,58 @@ Asn1Header::Serialize(Buffer::Iterator bIterator) const
 void
 Asn1Header::WriteOctet(uint8_t octet) const
 {
-    m_serializationResult.AddAtEnd(1);
-    Buffer::Iterator bIterator = m_serializationResult.End();
-    bIterator.Prev();
-    bIterator.WriteU8(octet);
+    WriteBits(octet, 8);
 }
 
-template <int N>
 void
-Asn1Header::SerializeBitset(std::bitset<N> data) const
+Asn1Header::WriteBits(uint64_t value, uint8_t numBits) const
 {
-    size_t dataSize = data.size();
-    uint8_t pendingBits = dataSize;
-    uint8_t mask = 1;
-    int j;
-
-    // No extension marker (Clause 16.7 ITU-T X.691),
-    // as 3GPP TS 36.331 does not use it in its IE's.
-
-    // Clause 16.8 ITU-T X.691
-    if (dataSize == 0)
+    NS_ASSERT_MSG(numBits <= 64, "Can't write " << (uint16_t)numBits << " bits at once");
+    if (numBits > 32)
+    {
+        WriteBits(value >> 32, numBits - 32);
+        numBits = 32;
+    }
+    if (numBits == 0)
     {
         return;
     }
 
-    // Clause 16.9 ITU-T X.691
-    // Clause 16.10 ITU-T X.691
-    if (dataSize <= 65536)
+    // Less than 32 bits are pending, so that at most 63 bits are accumulated
+    m_serializationBits = (m_serializationBits << numBits) | (value & ((1ULL << numBits) - 1));
+    m_numSerializationBits += numBits;
+    if (m_numSerializationBits >= 32)
     {
-        // If there are bits pending to be processed,
-        // append first bits in data to complete an octet.
-        if (m_numSerializationPendingBits > 0)
-        {
-            mask = 0x80 >> m_numSerializationPendingBits;
-            while (pendingBits > 0 && m_numSerializationPendingBits < 8)
-            {
-                m_serializationPendingBits |= (data[pendingBits - 1]) ? mask : 0;
-                pendingBits--;
-                m_numSerializationPendingBits++;
-                mask = (mask >> 1) & (~mask);
-            }
-
-            if (m_numSerializationPendingBits >= 8)
-            {
-                WriteOctet(m_serializationPendingBits);
-                m_numSerializationPendingBits = 0;
-                m_serializationPendingBits = 0;
-            }
-        }
-
-        while (pendingBits > 0)
-        {
-            mask = 1;
-            j = 8;
-
-            // If there are less than 8 remaining bits,
-            // store it to m_serializationPendingBits.
-            if (pendingBits < 8)
-            {
-                mask = 0x80;
-                m_numSerializationPendingBits = pendingBits;
-                while (pendingBits > 0)
-                {
-                    m_serializationPendingBits |= (data[pendingBits - 1]) ? mask : 0;
-                    mask = (mask >> 1) & (~mask);
-                    pendingBits--;
-                }
-            }
-
-            // Write the data to buffer
-            else
-            {
-                uint8_t octetToWrite = 0;
-                for (; j > 0; j--)
-                {
-                    octetToWrite |= (data[pendingBits - j]) ? mask : 0;
-                    mask = (mask << 1) & (~mask);
-                }
-                WriteOctet(octetToWrite);
-                pendingBits -= 8;
-            }
-        }
+        FlushSerializationBits();
     }
+}
 
-    // Clause 16.11 ITU-T X.691
-    else
+void
+Asn1Header::FlushSerializationBits() const
+{
+    while (m_numSerializationBits >= 8)
     {
-        NS_LOG_DEBUG("Fragmentation needed!");
+        m_numSerializationBits -= 8;
+        m_serializationOctets.push_back(
+            static_cast<uint8_t>(m_serializationBits >> m_numSerializationBits));
     }
 }
 
+template <int N>
+void
+Asn1Header::SerializeBitset(std::bitset<N> data) const
+{
+    // No extension marker (Clause 16.7 ITU-T X.691),
+    // as 3GPP TS 36.331 does not use it in its IE's.
+
+    // Clause 16.8 ITU-T X.691
+    // Clause 16.9 ITU-T X.691
+    // Clause 16.10 ITU-T X.691
+    // The bits are written from the most significant one, data[N - 1].
+    static_assert(N <= 64, "Bitsets longer than 64 bits are not supported");
+    WriteBits(data.to_ullong(), N);
+}
+
 template <int N>
 void
 Asn1Header::SerializeBitstring(std::bitset<N> data) const
@@ -227,9 +192,7 @@ void
 Asn1Header::SerializeBoolean(bool value) const
 {
     // Clause 12 ITU-T X.691
-    std::bitset<1> val;
-    (value) ? val.set() : val.reset();
-    SerializeBitset<1>(val);
+    WriteBits(value ? 1 : 0, 1);
 }
 
 template <int N>
@@ -380,74 +343,12 @@ Asn1Header::SerializeInteger(int n, int nmin, int nmax) const
 
     // Clause 11.5.6 ITU-T X.691
     int requiredBits = std::ceil(std::log(range) / std::log(2.0));
-
-    switch (requiredBits)
+    if (requiredBits > 20)
     {
-    case 1:
-        SerializeBitset<1>(std::bitset<1>(n));
-        break;
-    case 2:
-        SerializeBitset<2>(std::bitset<2>(n));
-        break;
-    case 3:
-        SerializeBitset<3>(std::bitset<3>(n));
-        break;
-    case 4:
-        SerializeBitset<4>(std::bitset<4>(n));
-        break;
-    case 5:
-        SerializeBitset<5>(std::bitset<5>(n));
-        break;
-    case 6:
-        SerializeBitset<6>(std::bitset<6>(n));
-        break;
-    case 7:
-        SerializeBitset<7>(std::bitset<7>(n));
-        break;
-    case 8:
-        SerializeBitset<8>(std::bitset<8>(n));
-        break;
-    case 9:
-        SerializeBitset<9>(std::bitset<9>(n));
-        break;
-    case 10:
-        SerializeBitset<10>(std::bitset<10>(n));
-        break;
-    case 11:
-        SerializeBitset<11>(std::bitset<11>(n));
-        break;
-    case 12:
-        SerializeBitset<12>(std::bitset<12>(n));
-        break;
-    case 13:
-        SerializeBitset<13>(std::bitset<13>(n));
-        break;
-    case 14:
-        SerializeBitset<14>(std::bitset<14>(n));
-        break;
-    case 15:
-        SerializeBitset<15>(std::bitset<15>(n));
-        break;
-    case 16:
-        SerializeBitset<16>(std::bitset<16>(n));
-        break;
-    case 17:
-        SerializeBitset<17>(std::bitset<17>(n));
-        break;
-    case 18:
-        SerializeBitset<18>(std::bitset<18>(n));
-        break;
-    case 19:
-        SerializeBitset<19>(std::bitset<19>(n));
-        break;
-    case 20:
-        SerializeBitset<20>(std::bitset<20>(n));
-        break;
-    default: {
         std::cout << "SerializeInteger " << requiredBits << " Out of range!!" << std::endl;
         exit(1);
     }
-    }
+    WriteBits(n, requiredBits);
 }
 
 void
@@ -459,64 +360,62 @@ Asn1Header::SerializeNull() const
 void
 Asn1Header::FinalizeSerialization() const
 {
-    if (m_numSerializationPendingBits > 0)
+    // Pad the last octet with zeros
+    if (m_numSerializationBits % 8 > 0)
     {
-        m_numSerializationPendingBits = 0;
-        SerializeBitset<8>(std::bitset<8>(m_serializationPendingBits));
+        WriteBits(0, 8 - m_numSerializationBits % 8);
     }
+    FlushSerializationBits();
+
+    // Copy the octets at once, keeping the array for the next serialization
+    uint32_t start = m_serializationResult.GetSize();
+    m_serializationResult.AddAtEnd(m_serializationOctets.size());
+    Buffer::Iterator bIterator = m_serializationResult.Begin();
+    bIterator.Next(start);
+    bIterator.Write(m_serializationOctets.data(), m_serializationOctets.size());
+    m_serializationOctets.clear();
     m_isDataSerialized = true;
 }
 
-template <int N>
-Buffer::Iterator
-Asn1Header::DeserializeBitset(std::bitset<N>* data, Buffer::Iterator bIterator)
+uint64_t
+Asn1Header::ReadBits(uint8_t numBits, Buffer::Iterator& bIterator)
 {
-    int bitsToRead = N;
-    uint8_t mask;
+    NS_ASSERT_MSG(numBits <= 64, "Can't read " << (uint16_t)numBits << " bits at once");
+    uint64_t value = 0;
 
     // Read bits from pending bits
-    if (m_numSerializationPendingBits > 0)
+    uint8_t pendingBits = std::min(numBits, m_numSerializationPendingBits);
+    if (pendingBits > 0)
     {
-        while (bitsToRead > 0 && m_numSerializationPendingBits > 0)
-        {
-            data->set(bitsToRead - 1, (m_serializationPendingBits & 0x80) ? 1 : 0);
-            bitsToRead--;
-            m_numSerializationPendingBits--;
-            m_serializationPendingBits = m_serializationPendingBits << 1;
-        }
+        value = m_serializationPendingBits >> (8 - pendingBits);
+        m_serializationPendingBits = m_serializationPendingBits << pendingBits;
+        m_numSerializationPendingBits -= pendingBits;
+        numBits -= pendingBits;
     }
 
-    // Read bits from buffer
-    while (bitsToRead > 0)
+    // Read the complete octets from buffer
+    for (; numBits >= 8; numBits -= 8)
+    {
+        value = (value << 8) | bIterator.ReadU8();
+    }
+
+    // Otherwise, we'll have to save the remaining bits
+    if (numBits > 0)
     {
         uint8_t octet = bIterator.ReadU8();
-        // If 8 bits can be allocated to the bitset, set the bits
-        if (bitsToRead >= 8)
-        {
-            mask = 0x80;
-            for (int j = 0; j < 8; j++)
-            {
-                data->set(bitsToRead - 1, (octet & mask) ? 1 : 0);
-                bitsToRead--;
-                mask = mask >> 1;
-            }
-        }
-
-        // Otherwise, we'll have to save the remaining bits
-        else
-        {
-            mask = 0x80;
-            m_numSerializationPendingBits = 8 - bitsToRead;
-            m_serializationPendingBits = octet << bitsToRead;
-            while (bitsToRead > 0)
-            {
-                data->set(bitsToRead - 1, (octet & mask) ? 1 : 0);
-                bitsToRead--;
-                mask = mask >> 1;
-            }
-        }
+        value = (value << numBits) | (octet >> (8 - numBits));
+        m_serializationPendingBits = octet << numBits;
+        m_numSerializationPendingBits = 8 - numBits;
     }
+    return value;
+}
 
+template <int N>
+Buffer::Iterator
+Asn1Header::DeserializeBitset(std::bitset<N>* data, Buffer::Iterator bIterator)
+{
+    static_assert(N <= 64, "Bitsets longer than 64 bits are not supported");
+    *data = std::bitset<N>(ReadBits(N, bIterator));
     return bIterator;
 }
 
@@ -578,9 +477,7 @@ Asn1Header::DeserializeBitstring(std::bitset<32>* data, Buffer::Iterator bIterat
 Buffer::Iterator
 Asn1Header::DeserializeBoolean(bool* value, Buffer::Iterator bIterator)
 {
-    std::bitset<1> readBit;
-    bIterator = DeserializeBitset<1>(&readBit, bIterator);
-    *value = (readBit[0] == 1);
+    *value = (ReadBits(1, bIterator) == 1);
     return bIterator;
 }
 
@@ -603,115 +500,12 @@ Asn1Header::DeserializeInteger(int* n, int nmin, int nmax, Buffer::Iterator bIte
     }
 
     int requiredBits = std::ceil(std::log(range) / std::log(2.0));
-
-    std::bitset<1> bitsRead1;
-    std::bitset<2> bitsRead2;
-    std::bitset<3> bitsRead3;
-    std::bitset<4> bitsRead4;
-    std::bitset<5> bitsRead5;
-    std::bitset<6> bitsRead6;
-    std::bitset<7> bitsRead7;
-    std::bitset<8> bitsRead8;
-    std::bitset<9> bitsRead9;
-    std::bitset<10> bitsRead10;
-    std::bitset<11> bitsRead11;
-    std::bitset<12> bitsRead12;
-    std::bitset<13> bitsRead13;
-    std::bitset<14> bitsRead14;
-    std::bitset<15> bitsRead15;
-    std::bitset<16> bitsRead16;
-    std::bitset<17> bitsRead17;
-    std::bitset<18> bitsRead18;
-    std::bitset<19> bitsRead19;
-    std::bitset<20> bitsRead20;
-
-    switch (requiredBits)
+    if (requiredBits > 20)
     {
-    case 1:
-        bIterator = DeserializeBitset<1>(&bitsRead1, bIterator);
-        *n = (int)bitsRead1.to_ulong();
-        break;
-    case 2:
-        bIterator = DeserializeBitset<2>(&bitsRead2, bIterator);
-        *n = (int)bitsRead2.to_ulong();
-        break;
-    case 3:
-        bIterator = DeserializeBitset<3>(&bitsRead3, bIterator);
-        *n = (int)bitsRead3.to_ulong();
-        break;
-    case 4:
-        bIterator = DeserializeBitset<4>(&bitsRead4, bIterator);
-        *n = (int)bitsRead4.to_ulong();
-        break;
-    case 5:
-        bIterator = DeserializeBitset<5>(&bitsRead5, bIterator);
-        *n = (int)bitsRead5.to_ulong();
-        break;
-    case 6:
-        bIterator = DeserializeBitset<6>(&bitsRead6, bIterator);
-        *n = (int)bitsRead6.to_ulong();
-        break;
-    case 7:
-        bIterator = DeserializeBitset<7>(&bitsRead7, bIterator);
-        *n = (int)bitsRead7.to_ulong();
-        break;
-    case 8:
-        bIterator = DeserializeBitset<8>(&bitsRead8, bIterator);
-        *n = (int)bitsRead8.to_ulong();
-        break;
-    case 9:
-        bIterator = DeserializeBitset<9>(&bitsRead9, bIterator);
-        *n = (int)bitsRead9.to_ulong();
-        break;
-    case 10:
-        bIterator = DeserializeBitset<10>(&bitsRead10, bIterator);
-        *n = (int)bitsRead10.to_ulong();
-        break;
-    case 11:
-        bIterator = DeserializeBitset<11>(&bitsRead11, bIterator);
-        *n = (int)bitsRead11.to_ulong();
-        break;
-    case 12:
-        bIterator = DeserializeBitset<12>(&bitsRead12, bIterator);
-        *n = (int)bitsRead12.to_ulong();
-        break;
-    case 13:
-        bIterator = DeserializeBitset<13>(&bitsRead13, bIterator);
-        *n = (int)bitsRead13.to_ulong();
-        break;
-    case 14:
-        bIterator = DeserializeBitset<14>(&bitsRead14, bIterator);
-        *n = (int)bitsRead14.to_ulong();
-        break;
-    case 15:
-        bIterator = DeserializeBitset<15>(&bitsRead15, bIterator);
-        *n = (int)bitsRead15.to_ulong();
-        break;
-    case 16:
-        bIterator = DeserializeBitset<16>(&bitsRead16, bIterator);
-        *n = (int)bitsRead16.to_ulong();
-        break;
-    case 17:
-        bIterator = DeserializeBitset<17>(&bitsRead17, bIterator);
-        *n = (int)bitsRead17.to_ulong();
-        break;
-    case 18:
-        bIterator = DeserializeBitset<18>(&bitsRead18, bIterator);
-        *n = (int)bitsRead18.to_ulong();
-        break;
-    case 19:
-        bIterator = DeserializeBitset<19>(&bitsRead19, bIterator);
-        *n = (int)bitsRead19.to_ulong();
-        break;
-    case 20:
-        bIterator = DeserializeBitset<20>(&bitsRead20, bIterator);
-        *n = (int)bitsRead20.to_ulong();
-        break;
-    default: {
         std::cout << "SerializeInteger Out of range!!" << std::endl;
         exit(1);
     }
-    }
+    *n = (int)ReadBits(requiredBits, bIterator);
 
     *n += nmin;
 
@@ -24,6 +24,7 @@
 
 #include <bitset>
 #include <string>
+#include <vector>
 
 namespace ns3
 {
@@ -32,6 +33,10 @@ namespace ns3
  * This class has the purpose to encode Information Elements according
  * to ASN.1 syntax, as defined in ITU-T  X-691.
  * IMPORTANT: The encoding is done following the UNALIGNED variant.
+ *
+ * The serialization accumulates the bits in a 64-bit word, which is
+ * written octet by octet into a contiguous array, and the array is copied
+ * into m_serializationResult once, by FinalizeSerialization.
  */
 class Asn1Header : public Header
 {
@@ -65,17 +70,33 @@ class Asn1Header : public Header
     virtual void PreSerialize() const = 0;
 
   protected:
-    mutable uint8_t m_serializationPendingBits;    //!< pending bits
+    mutable uint8_t m_serializationPendingBits;    //!< pending bits of the deserialization
     mutable uint8_t m_numSerializationPendingBits; //!< number of pending bits
     mutable bool m_isDataSerialized;               //!< true if data is serialized
     mutable Buffer m_serializationResult;          //!< serialization result
 
     /**
-     * Function to write in m_serializationResult, after resizing its size
+     * Function to write an octet in the serialization result
      * \param octet bits to write
      */
     void WriteOctet(uint8_t octet) const;
 
+    /**
+     * Function to write bits in the serialization result, most significant
+     * bit first
+     * \param value bits to write, in its numBits least significant bits
+     * \param numBits number of bits to write, at most 64
+     */
+    void WriteBits(uint64_t value, uint8_t numBits) const;
+
+    /**
+     * Function to read bits, most significant bit first
+     * \param numBits number of bits to read, at most 64
+     * \param bIterator buffer iterator, which is advanced past the octets read
+     * \returns the bits read, in the numBits least significant bits
+     */
+    uint64_t ReadBits(uint8_t numBits, Buffer::Iterator& bIterator);
+
     // Serialization functions
 
     /**
@@ -521,6 +542,16 @@ class Asn1Header : public Header
                                            int nMax,
                                            int nMin,
                                            Buffer::Iterator bIterator);
+
+  private:
+    /**
+     * Move the complete octets of m_serializationBits to m_serializationOctets
+     */
+    void FlushSerializationBits() const;
+
+    mutable std::vector<uint8_t> m_serializationOctets; //!< octets serialized so far
+    mutable uint64_t m_serializationBits; //!< bits not yet moved to m_serializationOctets
+    mutable uint8_t m_numSerializationBits; //!< number of bits in m_serializationBits
 };
 
 } // namespace ns3
@@ -645,7 +645,7 @@ LteNistErrorModel::GetPsschBler(LteFadingModel fadingChannel,
                                 LteTxMode txmode,
                                 uint16_t mcs,
                                 double sinr,
-                                HarqProcessInfoList_t harqHistory)
+                                const HarqProcessInfoList_t& harqHistory)
 {
     // Check mcs values
     if (mcs > 20)
@@ -741,7 +741,7 @@ TbErrorStats_t
 LteNistErrorModel::GetPsdchBler(LteFadingModel fadingChannel,
                                 LteTxMode txmode,
                                 double sinr,
-                                HarqProcessInfoList_t harqHistory)
+                                const HarqProcessInfoList_t& harqHistory)
 {
     // Find the table to use
     const double(*xtable)[XTABLE_SIZE];
@@ -821,7 +821,7 @@ LteNistErrorModel::GetPuschBler(LteFadingModel fadingChannel,
                                 LteTxMode txmode,
                                 uint16_t mcs,
                                 double sinr,
-                                HarqProcessInfoList_t harqHistory)
+                                const HarqProcessInfoList_t& harqHistory)
 {
     // Check mcs values
     if (mcs > 28)
@@ -113,7 +113,7 @@ class LteNistErrorModel
                                        LteTxMode txmode,
                                        uint16_t mcs,
                                        double sinr,
-                                       HarqProcessInfoList_t harqHistory);
+                                       const HarqProcessInfoList_t& harqHistory);
 
     /**
      * \brief Lookup the BLER for the given SINR
@@ -126,7 +126,7 @@ class LteNistErrorModel
     static TbErrorStats_t GetPsdchBler(LteFadingModel fadingChannel,
                                        LteTxMode txmode,
                                        double sinr,
-                                       HarqProcessInfoList_t harqHistory);
+                                       const HarqProcessInfoList_t& harqHistory);
 
     /**
      * \brief Lookup the BLER for the given SINR
@@ -165,7 +165,7 @@ class LteNistErrorModel
                                        LteTxMode txmode,
                                        uint16_t mcs,
                                        double sinr,
-                                       HarqProcessInfoList_t harqHistory);
+                                       const HarqProcessInfoList_t& harqHistory);
 
     /**
      * \brief Lookup the BLER for the given SINR
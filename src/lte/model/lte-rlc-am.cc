@@ -45,6 +45,7 @@ LteRlcAm::LteRlcAm()
     m_retxBufferSize = 0;
     m_txedBuffer.resize(1024);
     m_txedBufferSize = 0;
+    m_rxonBuffer.resize(1024);
 
     m_statusPduRequested = false;
     m_statusPduBufferSize = 0;
@@ -247,8 +248,7 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
                 NS_LOG_LOGIC("Can't fit more NACKs in STATUS PDU");
                 break;
             }
-            auto pduIt = m_rxonBuffer.find(sn.GetValue());
-            if (pduIt == m_rxonBuffer.end() || (!(pduIt->second.m_pduComplete)))
+            if (!m_rxonBuffer[sn.GetValue()])
             {
                 NS_LOG_LOGIC("adding NACK_SN " << sn.GetValue());
                 rlcAmHeader.PushNack(sn.GetValue());
@@ -258,13 +258,11 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
         // 3GPP TS 36.322 section 6.2.2.1.4 ACK SN
         // find the  SN of the next not received RLC Data PDU
         // which is not reported as missing in the STATUS PDU.
-        auto pduIt = m_rxonBuffer.find(sn.GetValue());
-        while ((sn < m_vrMs) && (pduIt != m_rxonBuffer.end()) && (pduIt->second.m_pduComplete))
+        while ((sn < m_vrMs) && m_rxonBuffer[sn.GetValue()])
         {
             NS_LOG_LOGIC("SN = " << sn << " < " << m_vrMs << " = " << (sn < m_vrMs));
             sn++;
             NS_LOG_LOGIC("SN = " << sn);
-            pduIt = m_rxonBuffer.find(sn.GetValue());
         }
 
         NS_ASSERT_MSG(sn <= m_vrMs,
@@ -493,7 +491,7 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
     Ptr<Packet> firstSegment = m_txonBuffer.begin()->m_pdu->Copy();
     m_txonBufferSize -= m_txonBuffer.begin()->m_pdu->GetSize();
     NS_LOG_LOGIC("txBufferSize      = " << m_txonBufferSize);
-    m_txonBuffer.erase(m_txonBuffer.begin());
+    m_txonBuffer.pop_front();
 
     while (firstSegment && (firstSegment->GetSize() > 0) && (nextSegmentSize > 0))
     {
@@ -543,7 +541,7 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
             {
                 firstSegment->AddPacketTag(oldTag);
 
-                m_txonBuffer.insert(m_txonBuffer.begin(), TxPdu(firstSegment, firstSegmentTime));
+                m_txonBuffer.emplace_front(firstSegment, firstSegmentTime);
                 m_txonBufferSize += m_txonBuffer.begin()->m_pdu->GetSize();
 
                 NS_LOG_LOGIC("    Txon buffer: Give back the remaining segment");
@@ -650,7 +648,7 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
             firstSegment = m_txonBuffer.begin()->m_pdu->Copy();
             firstSegmentTime = m_txonBuffer.begin()->m_waitingSince;
             m_txonBufferSize -= m_txonBuffer.begin()->m_pdu->GetSize();
-            m_txonBuffer.erase(m_txonBuffer.begin());
+            m_txonBuffer.pop_front();
             NS_LOG_LOGIC("        txBufferSize = " << m_txonBufferSize);
         }
     }
@@ -938,19 +936,14 @@ LteRlcAm::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
             //         - discard the duplicate byte segments.
             // note: re-segmentation of AMD PDU is currently not supported,
             // so we just check that the segment was not received before
-            auto it = m_rxonBuffer.find(seqNumber.GetValue());
-            if (it != m_rxonBuffer.end())
+            if (m_rxonBuffer[seqNumber.GetValue()])
             {
-                NS_ASSERT(!it->second.m_byteSegments.empty());
-                NS_ASSERT_MSG(it->second.m_byteSegments.size() == 1,
-                              "re-segmentation not supported");
                 NS_LOG_LOGIC("PDU segment already received, discarded");
             }
             else
             {
                 NS_LOG_LOGIC("Place PDU in the reception buffer ( SN = " << seqNumber << " )");
-                m_rxonBuffer[seqNumber.GetValue()].m_byteSegments.push_back(rxPduParams.p);
-                m_rxonBuffer[seqNumber.GetValue()].m_pduComplete = true;
+                m_rxonBuffer[seqNumber.GetValue()] = rxPduParams.p;
             }
         }
 
@@ -971,14 +964,12 @@ LteRlcAm::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
         //     - update VR(MS) to the SN of the first AMD PDU with SN > current VR(MS) for
         //       which not all byte segments have been received;
 
-        auto it = m_rxonBuffer.find(m_vrMs.GetValue());
-        if (it != m_rxonBuffer.end() && it->second.m_pduComplete)
+        if (m_rxonBuffer[m_vrMs.GetValue()])
         {
             int firstVrMs = m_vrMs.GetValue();
-            while (it != m_rxonBuffer.end() && it->second.m_pduComplete)
+            while (m_rxonBuffer[m_vrMs.GetValue()])
             {
                 m_vrMs++;
-                it = m_rxonBuffer.find(m_vrMs.GetValue());
                 NS_LOG_LOGIC("Incr VR(MS) = " << m_vrMs);
 
                 NS_ASSERT_MSG(firstVrMs != m_vrMs.GetValue(), "Infinite loop in RxonBuffer");
@@ -998,25 +989,21 @@ LteRlcAm::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
 
         if (seqNumber == m_vrR)
         {
-            auto it = m_rxonBuffer.find(seqNumber.GetValue());
-            if (it != m_rxonBuffer.end() && it->second.m_pduComplete)
+            if (m_rxonBuffer[seqNumber.GetValue()])
             {
-                it = m_rxonBuffer.find(m_vrR.GetValue());
                 int firstVrR = m_vrR.GetValue();
-                while (it != m_rxonBuffer.end() && it->second.m_pduComplete)
+                while (m_rxonBuffer[m_vrR.GetValue()])
                 {
                     NS_LOG_LOGIC("Reassemble and Deliver ( SN = " << m_vrR << " )");
-                    NS_ASSERT_MSG(it->second.m_byteSegments.size() == 1,
-                                  "Too many segments. PDU Reassembly process didn't work");
-                    ReassembleAndDeliver(it->second.m_byteSegments.front());
-                    m_rxonBuffer.erase(m_vrR.GetValue());
+                    Ptr<Packet> packet = m_rxonBuffer[m_vrR.GetValue()];
+                    m_rxonBuffer[m_vrR.GetValue()] = nullptr;
+                    ReassembleAndDeliver(packet);
 
                     m_vrR++;
                     m_vrR.SetModulusBase(m_vrR);
                     m_vrX.SetModulusBase(m_vrR);
                     m_vrMs.SetModulusBase(m_vrR);
                     m_vrH.SetModulusBase(m_vrR);
-                    it = m_rxonBuffer.find(m_vrR.GetValue());
 
                     NS_ASSERT_MSG(firstVrR != m_vrR.GetValue(), "Infinite loop in RxonBuffer");
                 }
@@ -1720,11 +1707,9 @@ LteRlcAm::ExpireReorderingTimer()
 
     m_vrMs = m_vrX;
     int firstVrMs = m_vrMs.GetValue();
-    auto it = m_rxonBuffer.find(m_vrMs.GetValue());
-    while (it != m_rxonBuffer.end() && it->second.m_pduComplete)
+    while (m_rxonBuffer[m_vrMs.GetValue()])
     {
         m_vrMs++;
-        it = m_rxonBuffer.find(m_vrMs.GetValue());
 
         NS_ASSERT_MSG(firstVrMs != m_vrMs.GetValue(), "Infinite loop in ExpireReorderingTimer");
     }
@@ -26,7 +26,8 @@
 
 #include <ns3/event-id.h>
 
-#include <map>
+#include <deque>
+#include <list>
 #include <vector>
 
 namespace ns3
@@ -131,7 +132,7 @@ class LteRlcAm : public LteRlc
         Time m_waitingSince; ///< Layer arrival time
     };
 
-    std::vector<TxPdu> m_txonBuffer; ///< Transmission buffer
+    std::deque<TxPdu> m_txonBuffer; ///< Transmission buffer
 
     /// RetxPdu structure
     struct RetxPdu
@@ -154,16 +155,12 @@ class LteRlcAm : public LteRlc
     bool m_statusPduRequested;      ///< status PDU requested
     uint32_t m_statusPduBufferSize; ///< status PDU buffer size
 
-    /// PduBuffer structure
-    struct PduBuffer
-    {
-        SequenceNumber10 m_seqNumber;          ///< sequence number
-        std::list<Ptr<Packet>> m_byteSegments; ///< byte segments
-
-        bool m_pduComplete; ///< PDU complete?
-    };
-
-    std::map<uint16_t, PduBuffer> m_rxonBuffer; ///< Reception buffer
+    /**
+     * Reception buffer, indexed by SN, with a null PDU for the SNs not received.
+     * Since re-segmentation is not supported, an AMD PDU is complete as soon as
+     * it is received.
+     */
+    std::vector<Ptr<Packet>> m_rxonBuffer;
 
     Ptr<Packet> m_controlPduBuffer; ///< Control PDU buffer (just one PDU)
 
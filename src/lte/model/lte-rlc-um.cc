@@ -47,6 +47,8 @@ LteRlcUm::LteRlcUm()
 {
     NS_LOG_FUNCTION(this);
     m_reassemblingState = WAITING_S0_FULL;
+    // one entry per value of the 10-bit SN
+    m_rxBuffer.resize(1024);
 }
 
 LteRlcUm::~LteRlcUm()
@@ -214,7 +216,7 @@ LteRlcUm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
     NS_LOG_LOGIC("Remove SDU from TxBuffer");
     m_txBufferSize -= firstSegment->GetSize();
     NS_LOG_LOGIC("txBufferSize      = " << m_txBufferSize);
-    m_txBuffer.erase(m_txBuffer.begin());
+    m_txBuffer.pop_front();
 
     while (firstSegment && (firstSegment->GetSize() > 0) && (nextSegmentSize > 0))
     {
@@ -264,7 +266,7 @@ LteRlcUm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
             {
                 firstSegment->AddPacketTag(oldTag);
 
-                m_txBuffer.insert(m_txBuffer.begin(), TxPdu(firstSegment, firstSegmentTime));
+                m_txBuffer.emplace_front(firstSegment, firstSegmentTime);
                 m_txBufferSize += m_txBuffer.begin()->m_pdu->GetSize();
 
                 NS_LOG_LOGIC("    TX buffer: Give back the remaining segment");
@@ -370,7 +372,7 @@ LteRlcUm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
             firstSegment = m_txBuffer.begin()->m_pdu->Copy();
             firstSegmentTime = m_txBuffer.begin()->m_waitingSince;
             m_txBufferSize -= firstSegment->GetSize();
-            m_txBuffer.erase(m_txBuffer.begin());
+            m_txBuffer.pop_front();
             NS_LOG_LOGIC("        txBufferSize = " << m_txBufferSize);
         }
     }
@@ -533,7 +535,7 @@ LteRlcUm::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
     seqNumber.SetModulusBase(m_vrUh - m_windowSize);
 
     if (((m_vrUr < seqNumber) && (seqNumber < m_vrUh) &&
-         (m_rxBuffer.count(seqNumber.GetValue()) > 0)) ||
+         m_rxBuffer[seqNumber.GetValue()]) ||
         (((m_vrUh - m_windowSize) <= seqNumber) && (seqNumber < m_vrUr)))
     {
         NS_LOG_LOGIC("PDU discarded");
@@ -563,10 +565,11 @@ LteRlcUm::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
     {
         NS_LOG_LOGIC("SN is outside the reordering window");
 
+        SequenceNumber10 oldVrUh = m_vrUh;
         m_vrUh = seqNumber + 1;
         NS_LOG_LOGIC("New VR(UH) = " << m_vrUh);
 
-        ReassembleOutsideWindow();
+        ReassembleOutsideWindow(oldVrUh);
 
         if (!IsInsideReorderingWindow(m_vrUr))
         {
@@ -584,16 +587,15 @@ LteRlcUm::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
     //      so and deliver the reassembled RLC SDUs to upper layer in ascending order of the RLC SN
     //      if not delivered before;
 
-    if (m_rxBuffer.count(m_vrUr.GetValue()) > 0)
+    if (m_rxBuffer[m_vrUr.GetValue()])
     {
         NS_LOG_LOGIC("Reception buffer contains SN = " << m_vrUr);
 
         uint16_t newVrUr;
         SequenceNumber10 oldVrUr = m_vrUr;
 
-        auto it = m_rxBuffer.find(m_vrUr.GetValue());
-        newVrUr = (it->first) + 1;
-        while (m_rxBuffer.count(newVrUr) > 0)
+        newVrUr = m_vrUr.GetValue() + 1;
+        while (newVrUr < m_rxBuffer.size() && m_rxBuffer[newVrUr])
         {
             newVrUr++;
         }
@@ -1149,27 +1151,27 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
 }
 
 void
-LteRlcUm::ReassembleOutsideWindow()
+LteRlcUm::ReassembleOutsideWindow(SequenceNumber10 oldVrUh)
 {
     NS_LOG_LOGIC("Reassemble Outside Window");
 
-    auto it = m_rxBuffer.begin();
-
-    while ((it != m_rxBuffer.end()) && !IsInsideReorderingWindow(SequenceNumber10(it->first)))
+    // the PDUs in the reception buffer are inside the previous window, so only the
+    // SNs between the lower edges of the previous and of the current window can
+    // have left it
+    SequenceNumber10 sn = oldVrUh - m_windowSize;
+    SequenceNumber10 lowerEdge = m_vrUh - m_windowSize;
+    for (; sn != lowerEdge; sn++)
     {
-        NS_LOG_LOGIC("SN = " << it->first);
+        Ptr<Packet> packet = m_rxBuffer[sn.GetValue()];
+        if (!packet)
+        {
+            continue;
+        }
+        NS_LOG_LOGIC("SN = " << sn);
 
         // Reassemble RLC SDUs and deliver the PDCP PDU to upper layer
-        ReassembleAndDeliver(it->second);
-
-        auto it_tmp = it;
-        ++it;
-        m_rxBuffer.erase(it_tmp);
-    }
-
-    if (it != m_rxBuffer.end())
-    {
-        NS_LOG_LOGIC("(SN = " << it->first << ") is inside the reordering window");
+        m_rxBuffer[sn.GetValue()] = nullptr;
+        ReassembleAndDeliver(packet);
     }
 }
 
@@ -1184,17 +1186,14 @@ LteRlcUm::ReassembleSnInterval(SequenceNumber10 lowSeqNumber, SequenceNumber10 h
     while (reassembleSn < highSeqNumber)
     {
         NS_LOG_LOGIC("reassembleSn < highSeqNumber");
-        auto it = m_rxBuffer.find(reassembleSn.GetValue());
-        NS_LOG_LOGIC("it->first  = " << it->first);
-        NS_LOG_LOGIC("it->second = " << it->second);
-        if (it != m_rxBuffer.end())
+        Ptr<Packet> packet = m_rxBuffer[reassembleSn.GetValue()];
+        if (packet)
         {
-            NS_LOG_LOGIC("SN = " << it->first);
+            NS_LOG_LOGIC("SN = " << reassembleSn);
 
             // Reassemble RLC SDUs and deliver the PDCP PDU to upper layer
-            ReassembleAndDeliver(it->second);
-
-            m_rxBuffer.erase(it);
+            m_rxBuffer[reassembleSn.GetValue()] = nullptr;
+            ReassembleAndDeliver(packet);
         }
 
         reassembleSn++;
@@ -1249,7 +1248,7 @@ LteRlcUm::ExpireReorderingTimer()
 
     SequenceNumber10 newVrUr = m_vrUx;
 
-    while (m_rxBuffer.find(newVrUr.GetValue()) != m_rxBuffer.end())
+    while (m_rxBuffer[newVrUr.GetValue()])
     {
         newVrUr++;
     }
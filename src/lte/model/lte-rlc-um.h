@@ -26,7 +26,9 @@
 
 #include <ns3/event-id.h>
 
-#include <map>
+#include <deque>
+#include <list>
+#include <vector>
 
 namespace ns3
 {
@@ -76,8 +78,13 @@ class LteRlcUm : public LteRlc
      */
     bool IsInsideReorderingWindow(SequenceNumber10 seqNumber);
 
-    /// Reassemble outside window
-    void ReassembleOutsideWindow();
+    /**
+     * Reassemble the PDUs which have left the reordering window when VR(UH) moved
+     * forward, in ascending order of SN
+     *
+     * \param oldVrUh the value of VR(UH) before it moved
+     */
+    void ReassembleOutsideWindow(SequenceNumber10 oldVrUh);
     /**
      * Reassemble SN interval function
      *
@@ -122,9 +129,12 @@ class LteRlcUm : public LteRlc
         Time m_waitingSince; ///< Layer arrival time
     };
 
-    std::vector<TxPdu> m_txBuffer;              ///< Transmission buffer
-    std::map<uint16_t, Ptr<Packet>> m_rxBuffer; ///< Reception buffer
-    std::vector<Ptr<Packet>> m_reasBuffer;      ///< Reassembling buffer
+    std::deque<TxPdu> m_txBuffer; ///< Transmission buffer
+    /**
+     * Reception buffer, indexed by SN, with a null PDU for the SNs not received
+     */
+    std::vector<Ptr<Packet>> m_rxBuffer;
+    std::vector<Ptr<Packet>> m_reasBuffer; ///< Reassembling buffer
 
     std::list<Ptr<Packet>> m_sdusBuffer; ///< List of SDUs in a packet
 
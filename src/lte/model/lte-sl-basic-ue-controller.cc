@@ -388,14 +388,19 @@ LteSlBasicUeController::DoRecvRemoteUeReport(uint64_t localImsi,
 }
 
 uint64_t
-LteSlBasicUeController::DoRelayUeSelection(std::map<uint64_t, double> validRelays,
+LteSlBasicUeController::DoRelayUeSelection(const LteSlRelayCandidateTable& validRelays,
                                            uint32_t serviceCode,
                                            uint64_t currentRelayId)
 {
     NS_LOG_FUNCTION(this);
     NS_LOG_DEBUG("UE IMSI " << m_netDevice->GetRrc()->GetImsi() << " Current Relay UE ID "
                             << currentRelayId << " for SC " << serviceCode);
-    NS_LOG_DEBUG("Number of valid Relay UEs available: " << validRelays.size());
+    NS_LOG_DEBUG("Number of valid Relay UEs available: " << validRelays.GetSize());
+    for (uint32_t i = 0; i < validRelays.GetSize(); i++)
+    {
+        NS_LOG_DEBUG("  Relay UE ID " << validRelays.GetRelayId(i) << " SD-RSRP "
+                                      << validRelays.GetSdRsrp(i));
+    }
 
     uint64_t selectedRelayId = 0;
 
@@ -410,8 +415,6 @@ LteSlBasicUeController::DoRelayUeSelection(std::map<uint64_t, double> validRelay
     else
     {
         // No: evaluate Relay UE (re)selection
-
-        std::map<uint64_t, double>::iterator vaReIt;
         switch (m_relayUeSelectionAlgorithm)
         {
         case LteSlBasicUeController::RelayUeSelectionAlgorithm::RANDOM_NO_RESELECTION:
@@ -422,17 +425,15 @@ LteSlBasicUeController::DoRelayUeSelection(std::map<uint64_t, double> validRelay
             {
                 NS_LOG_DEBUG("Selection algorithm: RandomNoReselection");
 
-                if (currentRelayId == 0 && !validRelays.empty())
+                if (currentRelayId == 0 && !validRelays.IsEmpty())
                 {
-                    // Select a random entry in the validRelays map
-                    //(advance iterator a random number of positions)
-                    vaReIt = validRelays.begin();
-                    uint32_t pos = m_relayDiscProbRndVar->GetInteger(0, (validRelays.size() - 1));
-                    std::advance(vaReIt, pos);
+                    // Select a random entry in the validRelays table
+                    uint32_t pos =
+                        m_relayDiscProbRndVar->GetInteger(0, (validRelays.GetSize() - 1));
+                    selectedRelayId = validRelays.GetRelayId(pos);
 
-                    NS_ASSERT_MSG(vaReIt->first != 0, "Unable to find a valid Relay UE ID");
+                    NS_ASSERT_MSG(selectedRelayId != 0, "Unable to find a valid Relay UE ID");
 
-                    selectedRelayId = vaReIt->first;
                     NS_LOG_DEBUG("UE IMSI " << m_netDevice->GetRrc()->GetImsi()
                                             << " selected Relay UE ID " << selectedRelayId
                                             << " for SC " << serviceCode);
@@ -454,25 +455,11 @@ LteSlBasicUeController::DoRelayUeSelection(std::map<uint64_t, double> validRelay
             {
                 NS_LOG_DEBUG("Selection algorithm: MaxSDRsrpNoReselection");
 
-                if (currentRelayId == 0 && !validRelays.empty())
+                if (currentRelayId == 0 && !validRelays.IsEmpty())
                 {
-                    uint64_t maxSDRsrpRelayId = 0;
-                    double maxSDRsrp = -std::numeric_limits<double>::infinity();
-
-                    for (vaReIt = validRelays.begin(); vaReIt != validRelays.end(); vaReIt++)
-                    {
-                        NS_LOG_DEBUG("  Relay UE ID " << vaReIt->first << " SD-RSRP "
-                                                      << vaReIt->second);
-
-                        if (maxSDRsrp < vaReIt->second)
-                        {
-                            maxSDRsrpRelayId = vaReIt->first;
-                            maxSDRsrp = vaReIt->second;
-                        }
-                    }
-                    NS_ASSERT_MSG(maxSDRsrpRelayId != 0, "Unable to find a valid Relay UE ID");
-
-                    selectedRelayId = maxSDRsrpRelayId;
+                    selectedRelayId = validRelays.GetBestRelayId();
+                    NS_ASSERT_MSG(selectedRelayId != 0, "Unable to find a valid Relay UE ID");
+
                     NS_LOG_DEBUG("UE IMSI " << m_netDevice->GetRrc()->GetImsi()
                                             << " selected Relay UE ID " << selectedRelayId
                                             << " for SC " << serviceCode);
@@ -492,7 +479,7 @@ LteSlBasicUeController::DoRelayUeSelection(std::map<uint64_t, double> validRelay
             {
                 NS_LOG_DEBUG("Selection algorithm: MaxSDRsrp");
 
-                if (validRelays.empty())
+                if (validRelays.IsEmpty())
                 {
                     NS_LOG_DEBUG("No valid Relay UEs available.");
                     selectedRelayId = 0;
@@ -500,23 +487,9 @@ LteSlBasicUeController::DoRelayUeSelection(std::map<uint64_t, double> validRelay
                 }
                 else
                 {
-                    uint64_t maxSDRsrpRelayId = 0;
-                    double maxSDRsrp = -std::numeric_limits<double>::infinity();
-                    for (vaReIt = validRelays.begin(); vaReIt != validRelays.end(); vaReIt++)
-                    {
-                        NS_LOG_DEBUG("  Relay UE ID " << vaReIt->first << " SD-RSRP "
-                                                      << vaReIt->second);
-
-                        if (maxSDRsrp < vaReIt->second)
-                        {
-                            maxSDRsrpRelayId = vaReIt->first;
-                            maxSDRsrp = vaReIt->second;
-                        }
-                    }
-
-                    NS_ASSERT_MSG(maxSDRsrpRelayId != 0, "Unable to find a valid Relay UE ID");
-
-                    selectedRelayId = maxSDRsrpRelayId;
+                    selectedRelayId = validRelays.GetBestRelayId();
+                    NS_ASSERT_MSG(selectedRelayId != 0, "Unable to find a valid Relay UE ID");
+
                     NS_LOG_DEBUG("UE IMSI " << m_netDevice->GetRrc()->GetImsi()
                                             << " selected Relay UE ID " << selectedRelayId
                                             << " for SC " << serviceCode);
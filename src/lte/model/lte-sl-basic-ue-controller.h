@@ -145,7 +145,7 @@ class LteSlBasicUeController : public LteSlUeController
                                 LteSlUeRrc::RelayRole role,
                                 LteSlO2oCommParams::UeO2ORejectReason reason) override;
     void DoRecvRemoteUeReport(uint64_t localImsi, uint32_t peerUeId, uint64_t remoteImsi) override;
-    uint64_t DoRelayUeSelection(std::map<uint64_t, double> validRelays,
+    uint64_t DoRelayUeSelection(const LteSlRelayCandidateTable& validRelays,
                                 uint32_t serviceCode,
                                 uint64_t currentRelayId) override;
 
@@ -0,0 +1,195 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#include "lte-sl-fading-trace-bank.h"
+
+#include <ns3/abort.h>
+#include <ns3/assert.h>
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/string.h>
+#include <ns3/uinteger.h>
+
+#include <cmath>
+#include <fstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LteSlFadingTraceBank");
+
+NS_OBJECT_ENSURE_REGISTERED(LteSlFadingTraceBank);
+
+/**
+ * Mix the bits of a 64-bit value (finalizer of the SplitMix64 generator)
+ * \param x the value
+ * \return the mixed value
+ */
+static uint64_t
+MixBits(uint64_t x)
+{
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+LteSlFadingTraceBank::LteSlFadingTraceBank()
+    : m_seed(0)
+{
+    NS_LOG_FUNCTION(this);
+    m_seedVariable = CreateObject<UniformRandomVariable>();
+}
+
+LteSlFadingTraceBank::~LteSlFadingTraceBank()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TypeId
+LteSlFadingTraceBank::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::LteSlFadingTraceBank")
+            .SetParent<Object>()
+            .SetGroupName("Lte")
+            .AddConstructor<LteSlFadingTraceBank>()
+            .AddAttribute("TraceFilename",
+                          "Name of file to load a trace from.",
+                          StringValue(""),
+                          MakeStringAccessor(&LteSlFadingTraceBank::m_traceFile),
+                          MakeStringChecker())
+            .AddAttribute("TraceLength",
+                          "The total length of the fading trace (default value 10 s.)",
+                          TimeValue(Seconds(10.0)),
+                          MakeTimeAccessor(&LteSlFadingTraceBank::m_traceLength),
+                          MakeTimeChecker())
+            .AddAttribute("SamplesNum",
+                          "The number of samples the trace is made of (default 10000)",
+                          UintegerValue(10000),
+                          MakeUintegerAccessor(&LteSlFadingTraceBank::m_samplesNum),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("WindowSize",
+                          "The time after which the position of each link in the trace is "
+                          "drawn again (default value 0.5 s.)",
+                          TimeValue(Seconds(0.5)),
+                          MakeTimeAccessor(&LteSlFadingTraceBank::m_windowSize),
+                          MakeTimeChecker())
+            .AddAttribute("RbNum",
+                          "The number of RB the trace is made of (default 100)",
+                          UintegerValue(100),
+                          MakeUintegerAccessor(&LteSlFadingTraceBank::m_rbNum),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+void
+LteSlFadingTraceBank::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_gains.clear();
+    m_seedVariable = nullptr;
+    Object::DoDispose();
+}
+
+void
+LteSlFadingTraceBank::LoadTrace()
+{
+    NS_LOG_FUNCTION(this << "Loading Fading Trace " << m_traceFile);
+    NS_ABORT_MSG_IF(m_windowSize.IsZero() || m_traceLength < m_windowSize,
+                    "The window must be shorter than the fading trace");
+    NS_ABORT_MSG_IF(m_traceLength.GetTimeStep() < m_samplesNum,
+                    "The fading trace is too short for its number of samples");
+    std::ifstream ifTraceFile(m_traceFile);
+    NS_ABORT_MSG_IF(!ifTraceFile.good(), "Fading trace file " << m_traceFile << " not found");
+
+    // the trace is written RB by RB, and stored sample by sample
+    m_gains.resize(static_cast<std::size_t>(m_samplesNum) * m_rbNum);
+    for (uint32_t rb = 0; rb < m_rbNum; rb++)
+    {
+        for (uint32_t sample = 0; sample < m_samplesNum; sample++)
+        {
+            double fadingDb;
+            ifTraceFile >> fadingDb;
+            NS_ABORT_MSG_IF(ifTraceFile.fail(),
+                            "Fading trace file " << m_traceFile << " is too short");
+            m_gains[static_cast<std::size_t>(sample) * m_rbNum + rb] =
+                static_cast<float>(std::pow(10.0, fadingDb / 10.0));
+        }
+    }
+    m_seed = m_seedVariable->GetInteger(0, UINT32_MAX);
+}
+
+const float*
+LteSlFadingTraceBank::GetGains(uint64_t linkId)
+{
+    if (m_gains.empty())
+    {
+        LoadTrace();
+    }
+
+    // random position of the link during the current window, then one
+    // sample per sample duration
+    Time now = Simulator::Now();
+    uint64_t window = now.GetTimeStep() / m_windowSize.GetTimeStep();
+    int64_t sampleDuration = m_traceLength.GetTimeStep() / m_samplesNum;
+    uint64_t elapsed = (now.GetTimeStep() - window * m_windowSize.GetTimeStep()) / sampleDuration;
+    uint64_t start = MixBits(MixBits(m_seed ^ linkId) + window) % m_samplesNum;
+    uint64_t sample = (start + elapsed) % m_samplesNum;
+    NS_LOG_LOGIC("Link " << linkId << " window " << window << " sample " << sample);
+    return &m_gains[sample * m_rbNum];
+}
+
+double
+LteSlFadingTraceBank::GetGain(uint64_t linkId, uint32_t rb)
+{
+    NS_ASSERT_MSG(rb < m_rbNum, "RB " << rb << " not in the fading trace");
+    return GetGains(linkId)[rb];
+}
+
+uint32_t
+LteSlFadingTraceBank::GetRbNum() const
+{
+    return m_rbNum;
+}
+
+int64_t
+LteSlFadingTraceBank::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    m_seedVariable->SetStream(stream);
+    return 1;
+}
+
+} // namespace ns3
@@ -0,0 +1,140 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#ifndef LTE_SL_FADING_TRACE_BANK_H
+#define LTE_SL_FADING_TRACE_BANK_H
+
+#include <ns3/nstime.h>
+#include <ns3/object.h>
+#include <ns3/random-variable-stream.h>
+
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lte
+ *
+ * \brief Bank of fading samples shared by all the Sidelink links, used to
+ * apply block fading to the SINR of the received transport blocks
+ *
+ * The bank loads a fading trace in the format of the TraceFadingLossModel
+ * (one line of samples in dB per RB, generated by
+ * src/lte/model/fading-traces/fading_trace_generator.m) once, and stores it
+ * as linear gains, with the gains of all the RBs of a sample next to each
+ * other. Unlike the TraceFadingLossModel, which multiplies the PSD of every
+ * signal on every link, the bank is looked up by the receiving PHY for the
+ * RBs of each transport block only, and it keeps no state per link: the
+ * position of a link in the trace is given by a hash of its identifier, of
+ * a random seed of the bank, and of the current window, so that, as with
+ * the TraceFadingLossModel, each link starts from a random position in the
+ * trace, which is drawn again at every window, and then follows the trace
+ * sample by sample.
+ *
+ * The same bank can be shared by all the LteSpectrumPhy instances, through
+ * their SlFadingTraceBank attribute.
+ */
+class LteSlFadingTraceBank : public Object
+{
+  public:
+    LteSlFadingTraceBank();
+    ~LteSlFadingTraceBank() override;
+
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    /**
+     * Get the linear fading gain of a link on a RB at the current time
+     *
+     * \param linkId the identifier of the link, e.g., the IDs of its
+     *        transmitting and receiving nodes
+     * \param rb the index of the RB
+     * \return the linear gain
+     */
+    double GetGain(uint64_t linkId, uint32_t rb);
+
+    /**
+     * Get the linear fading gains of a link on all the RBs at the current time
+     *
+     * \param linkId the identifier of the link
+     * \return a pointer to the gains of the RBs 0 to GetRbNum () - 1
+     */
+    const float* GetGains(uint64_t linkId);
+
+    /**
+     * \return the number of RBs of the trace
+     */
+    uint32_t GetRbNum() const;
+
+    /**
+     * Assign a fixed random variable stream number to the random variables
+     * used by this model.  Return the number of streams (possibly zero) that
+     * have been assigned.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned by this model
+     */
+    int64_t AssignStreams(int64_t stream);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /// Load the trace, if not yet loaded, and draw the seed of the links
+    void LoadTrace();
+
+    std::string m_traceFile; ///< the trace file name
+    Time m_traceLength;      ///< the trace time
+    uint32_t m_samplesNum;   ///< number of samples
+    Time m_windowSize;       ///< window size
+    uint32_t m_rbNum;        ///< RB number
+
+    /**
+     * Linear gains, the gain of the RB r of the sample s being at the
+     * index s * m_rbNum + r
+     */
+    std::vector<float> m_gains;
+    Ptr<UniformRandomVariable> m_seedVariable; ///< random variable of the seed
+    uint64_t m_seed;                           ///< seed of the positions of the links
+};
+
+} // namespace ns3
+
+#endif /* LTE_SL_FADING_TRACE_BANK_H */
@@ -24,6 +24,8 @@
 #include <ns3/assert.h>
 #include <ns3/log.h>
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -33,29 +35,67 @@ NS_LOG_COMPONENT_DEFINE("LteSlHarqPhy");
 //   ;
 
 LteSlHarqPhy::LteSlHarqPhy()
+    : m_discNumRetx(0)
 {
 }
 
 LteSlHarqPhy::~LteSlHarqPhy()
 {
-    m_miSlHarqProcessesInfoMap.clear();
+    m_slProcesses.clear();
+    m_discProcesses.clear();
 }
 
 uint32_t
-LteSlHarqPhy::GetTbIdx(uint16_t rnti, uint8_t l1dst)
+LteSlHarqPhy::GetProcessId(uint16_t rnti, uint8_t id)
 {
-    NS_LOG_FUNCTION(this << (uint32_t)rnti << (uint32_t)l1dst);
+    return (rnti << 8) + id;
+}
 
-    uint32_t idx = 0;
-    uint32_t tbIdxId = (rnti << 8) + l1dst;
-    auto it = this->m_tbIdx.find(tbIdxId);
+const LteSlHarqPhy::HarqProcess*
+LteSlHarqPhy::Find(const HarqProcessMap& processes, uint16_t rnti, uint8_t id)
+{
+    auto it = processes.find(GetProcessId(rnti, id));
+    return it != processes.end() ? &it->second : nullptr;
+}
 
-    if (it != this->m_tbIdx.end())
+void
+LteSlHarqPhy::AddHarqInfo(HarqProcessMap& processes,
+                          uint16_t rnti,
+                          uint8_t id,
+                          const HarqProcessInfoElement_t& el,
+                          uint8_t maxRetx)
+{
+    HarqProcessInfoList_t& history = processes[GetProcessId(rnti, id)].history;
+    if (history.empty())
+    {
+        // allocate the whole history once, it is reused by the retransmissions
+        history.reserve(std::max<uint8_t>(maxRetx, 1));
+    }
+    else if (history.size() >= maxRetx) // MAX HARQ RETX
     {
-        idx = it->second;
+        NS_LOG_DEBUG("numRetx = " << history.size() << " discard info");
+        // HARQ should be disabled -> discard info
+        return;
     }
+    history.push_back(el);
+}
 
-    return idx;
+void
+LteSlHarqPhy::RemoveIfIdle(HarqProcessMap& processes, HarqProcessMap::iterator it)
+{
+    if (!it->second.hasTbIdx && !it->second.decoded && it->second.history.empty())
+    {
+        processes.erase(it);
+    }
+}
+
+uint32_t
+LteSlHarqPhy::GetTbIdx(uint16_t rnti, uint8_t l1dst)
+{
+    NS_LOG_FUNCTION(this << (uint32_t)rnti << (uint32_t)l1dst);
+
+    const HarqProcess* process = Find(m_slProcesses, rnti, l1dst);
+    return process ? process->tbIdx : 0;
 }
 
 void
@@ -63,15 +103,15 @@ LteSlHarqPhy::IncreaseTbIdx(uint16_t rnti, uint8_t l1dst)
 {
     NS_LOG_FUNCTION(this << (uint32_t)rnti << (uint32_t)l1dst);
 
-    uint32_t tbIdxId = (rnti << 8) + l1dst;
-
-    if (this->m_tbIdx.find(tbIdxId) == this->m_tbIdx.end())
+    HarqProcess& process = m_slProcesses[GetProcessId(rnti, l1dst)];
+    if (process.hasTbIdx)
     {
-        this->m_tbIdx[tbIdxId] = 0;
+        process.tbIdx++;
     }
     else
     {
-        this->m_tbIdx[tbIdxId] = this->m_tbIdx[tbIdxId] + 1;
+        process.hasTbIdx = true;
+        process.tbIdx = 0;
     }
 }
 
@@ -80,12 +120,7 @@ LteSlHarqPhy::IndicatePrevDecoded(uint16_t rnti, uint8_t l1dst)
 {
     NS_LOG_FUNCTION(this << (uint32_t)rnti << (uint32_t)l1dst);
 
-    uint32_t decodedId = (rnti << 8) + l1dst;
-
-    if (this->m_decoded.find(decodedId) == this->m_decoded.end())
-    {
-        this->m_decoded.insert(decodedId);
-    }
+    m_slProcesses[GetProcessId(rnti, l1dst)].decoded = true;
 }
 
 bool
@@ -93,13 +128,8 @@ LteSlHarqPhy::IsPrevDecoded(uint16_t rnti, uint8_t l1dst)
 {
     NS_LOG_FUNCTION(this << (uint32_t)rnti << (uint32_t)l1dst);
 
-    uint32_t decodedId = (rnti << 8) + l1dst;
-
-    auto it = this->m_decoded.find(decodedId);
-
-    bool prevDecoded = (it != this->m_decoded.end());
-
-    return prevDecoded;
+    const HarqProcess* process = Find(m_slProcesses, rnti, l1dst);
+    return process && process->decoded;
 }
 
 void
@@ -107,13 +137,11 @@ LteSlHarqPhy::ResetPrevDecoded(uint16_t rnti, uint8_t l1dst)
 {
     NS_LOG_FUNCTION(this << (uint32_t)rnti << (uint32_t)l1dst);
 
-    uint32_t decodedId = (rnti << 8) + l1dst;
-
-    auto it = this->m_decoded.find(decodedId);
-
-    if (it != this->m_decoded.end())
+    auto it = m_slProcesses.find(GetProcessId(rnti, l1dst));
+    if (it != m_slProcesses.end())
     {
-        this->m_decoded.erase(it);
+        it->second.decoded = false;
+        RemoveIfIdle(m_slProcesses, it);
     }
 }
 
@@ -122,12 +150,7 @@ LteSlHarqPhy::IndicateDiscTbPrevDecoded(uint16_t rnti, uint8_t resPsdch)
 {
     NS_LOG_FUNCTION(this << (uint32_t)rnti << (uint32_t)resPsdch);
 
-    uint32_t decodedId = (rnti << 8) + resPsdch;
-
-    if (this->m_discDecoded.find(decodedId) == this->m_discDecoded.end())
-    {
-        this->m_discDecoded.insert(decodedId);
-    }
+    m_discProcesses[GetProcessId(rnti, resPsdch)].decoded = true;
 }
 
 bool
@@ -135,13 +158,8 @@ LteSlHarqPhy::IsDiscTbPrevDecoded(uint16_t rnti, uint8_t resPsdch)
 {
     NS_LOG_FUNCTION(this << (uint32_t)rnti << (uint32_t)resPsdch);
 
-    uint32_t decodedId = (rnti << 8) + resPsdch;
-
-    auto it = this->m_discDecoded.find(decodedId);
-
-    bool prevDecoded = (it != this->m_discDecoded.end());
-
-    return prevDecoded;
+    const HarqProcess* process = Find(m_discProcesses, rnti, resPsdch);
+    return process && process->decoded;
 }
 
 void
@@ -149,13 +167,11 @@ LteSlHarqPhy::ResetDiscTbPrevDecoded(uint16_t rnti, uint8_t resPsdch)
 {
     NS_LOG_FUNCTION(this << (uint32_t)rnti << (uint32_t)resPsdch);
 
-    uint32_t decodedId = (rnti << 8) + resPsdch;
-
-    auto it = this->m_discDecoded.find(decodedId);
-
-    if (it != this->m_discDecoded.end())
+    auto it = m_discProcesses.find(GetProcessId(rnti, resPsdch));
+    if (it != m_discProcesses.end())
     {
-        this->m_discDecoded.erase(it);
+        it->second.decoded = false;
+        RemoveIfIdle(m_discProcesses, it);
     }
 }
 
@@ -164,12 +180,12 @@ LteSlHarqPhy::ResetTbIdx(uint16_t rnti, uint8_t l1dst)
 {
     NS_LOG_FUNCTION(this << (uint32_t)rnti << (uint32_t)l1dst);
 
-    uint32_t tbIdxId = (rnti << 8) + l1dst;
-    auto it = this->m_tbIdx.find(tbIdxId);
-
-    if (it != this->m_tbIdx.end())
+    auto it = m_slProcesses.find(GetProcessId(rnti, l1dst));
+    if (it != m_slProcesses.end())
     {
-        this->m_tbIdx.erase(it);
+        it->second.hasTbIdx = false;
+        it->second.tbIdx = 0;
+        RemoveIfIdle(m_slProcesses, it);
     }
 }
 
@@ -178,89 +194,38 @@ LteSlHarqPhy::GetAccumulatedMiSl(uint16_t rnti, uint8_t l1dst)
 {
     NS_LOG_FUNCTION(this << rnti);
 
-    std::map<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>::iterator it;
-    it = m_miSlHarqProcessesInfoMap.find(rnti);
-    NS_ASSERT_MSG(it != m_miSlHarqProcessesInfoMap.end(), " Does not find MI for RNTI");
-    std::map<uint8_t, HarqProcessInfoList_t>::iterator it2;
-    it2 = it->second.find(l1dst);
-    NS_ASSERT_MSG(it2 != it->second.end(), " Does not find MI for l1dst ");
-    HarqProcessInfoList_t list = (*it2).second;
     double mi = 0.0;
-    for (uint32_t i = 0; i < list.size(); i++)
+    for (const auto& el : GetHarqProcessInfoSl(rnti, l1dst))
     {
-        mi += list.at(i).m_mi;
+        mi += el.m_mi;
     }
     return (mi);
 }
 
-HarqProcessInfoList_t
-LteSlHarqPhy::GetHarqProcessInfoSl(uint16_t rnti, uint8_t l1dst)
+const HarqProcessInfoList_t&
+LteSlHarqPhy::GetHarqProcessInfoSl(uint16_t rnti, uint8_t l1dst) const
 {
     NS_LOG_FUNCTION(this << rnti << (uint16_t)l1dst);
-    std::map<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>::iterator it;
-    it = m_miSlHarqProcessesInfoMap.find(rnti);
-    if (it == m_miSlHarqProcessesInfoMap.end())
-    {
-        // new entry
-        HarqProcessInfoList_t harqInfo;
-        std::map<uint8_t, HarqProcessInfoList_t> map;
-        map.insert(std::pair<uint8_t, HarqProcessInfoList_t>(l1dst, harqInfo));
-        m_miSlHarqProcessesInfoMap.insert(
-            std::pair<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>(rnti, map));
-        return (harqInfo);
-    }
-    else
-    {
-        // entry here, check ls1dst
-        std::map<uint8_t, HarqProcessInfoList_t>::iterator it2;
-        it2 = it->second.find(l1dst);
-        if (it2 == it->second.end())
-        {
-            HarqProcessInfoList_t harqInfo;
-            std::map<uint8_t, HarqProcessInfoList_t> map;
-            it->second.insert(std::pair<uint8_t, HarqProcessInfoList_t>(l1dst, harqInfo));
-            return (harqInfo);
-        }
-        else
-        {
-            return ((*it2).second);
-        }
-    }
+    static const HarqProcessInfoList_t empty;
+    const HarqProcess* process = Find(m_slProcesses, rnti, l1dst);
+    return process ? process->history : empty;
 }
 
-HarqProcessInfoList_t
-LteSlHarqPhy::GetHarqProcessInfoDisc(uint16_t rnti, uint8_t resPsdch)
+const HarqProcessInfoList_t&
+LteSlHarqPhy::GetHarqProcessInfoDisc(uint16_t rnti, uint8_t resPsdch) const
 {
     NS_LOG_FUNCTION(this << rnti << (uint16_t)resPsdch);
-    std::map<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>::iterator it;
-    it = m_miDiscHarqProcessesInfoMap.find(rnti);
-    if (it == m_miDiscHarqProcessesInfoMap.end())
-    {
-        // new entry
-        HarqProcessInfoList_t harqInfo;
-        std::map<uint8_t, HarqProcessInfoList_t> map;
-        map.insert(std::pair<uint8_t, HarqProcessInfoList_t>(resPsdch, harqInfo));
-        m_miDiscHarqProcessesInfoMap.insert(
-            std::pair<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>(rnti, map));
-        return (harqInfo);
-    }
-    else
-    {
-        // entry here, check ls1dst
-        std::map<uint8_t, HarqProcessInfoList_t>::iterator it2;
-        it2 = it->second.find(resPsdch);
-        if (it2 == it->second.end())
-        {
-            HarqProcessInfoList_t harqInfo;
-            std::map<uint8_t, HarqProcessInfoList_t> map;
-            it->second.insert(std::pair<uint8_t, HarqProcessInfoList_t>(resPsdch, harqInfo));
-            return (harqInfo);
-        }
-        else
-        {
-            return ((*it2).second);
-        }
-    }
+    static const HarqProcessInfoList_t empty;
+    const HarqProcess* process = Find(m_discProcesses, rnti, resPsdch);
+    return process ? process->history : empty;
+}
+
+const HarqProcessInfoList_t&
+LteSlHarqPhy::GetHarqProcessInfoDisc(uint16_t rnti, uint8_t resPsdch, uint8_t ndi) const
+{
+    NS_LOG_FUNCTION(this << rnti << (uint16_t)resPsdch << (uint16_t)ndi);
+    static const HarqProcessInfoList_t empty;
+    return ndi == 0 ? GetHarqProcessInfoDisc(rnti, resPsdch) : empty;
 }
 
 void
@@ -271,196 +236,48 @@ LteSlHarqPhy::UpdateSlHarqProcessStatus(uint16_t rnti,
                                         uint16_t codeBytes)
 {
     NS_LOG_FUNCTION(this << rnti << mi);
-    std::map<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>::iterator it;
-    std::map<uint8_t, HarqProcessInfoList_t>::iterator it2;
-
-    it = m_miSlHarqProcessesInfoMap.find(rnti);
-    if (it == m_miSlHarqProcessesInfoMap.end())
-    {
-        // new entry
-        HarqProcessInfoList_t harqInfo;
-        HarqProcessInfoElement_t el;
-        el.m_mi = mi;
-        el.m_infoBits = infoBytes * 8;
-        el.m_codeBits = codeBytes * 8;
-        harqInfo.push_back(el);
-        std::map<uint8_t, HarqProcessInfoList_t> map;
-        map.insert(std::pair<uint8_t, HarqProcessInfoList_t>(l1dst, harqInfo));
-        m_miSlHarqProcessesInfoMap.insert(
-            std::pair<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>(rnti, map));
-    }
-    else
-    {
-        it2 = it->second.find(l1dst);
-        if (it2 == it->second.end())
-        {
-            // new entry
-            HarqProcessInfoList_t harqInfo;
-            HarqProcessInfoElement_t el;
-            el.m_mi = mi;
-            el.m_infoBits = infoBytes * 8;
-            el.m_codeBits = codeBytes * 8;
-            harqInfo.push_back(el);
-            (*it).second.insert(std::pair<uint8_t, HarqProcessInfoList_t>(l1dst, harqInfo));
-        }
-        else
-        {
-            if ((*it2).second.size() == 3) // MAX HARQ RETX
-            {
-                NS_LOG_DEBUG("numRetx = " << (*it2).second.size() << " discard info");
-                // HARQ should be disabled -> discard info
-                return;
-            }
-            HarqProcessInfoElement_t el;
-            el.m_mi = mi;
-            el.m_infoBits = infoBytes * 8;
-            el.m_codeBits = codeBytes * 8;
-            (*it2).second.push_back(el);
-        }
-    }
+    HarqProcessInfoElement_t el;
+    el.m_mi = mi;
+    el.m_infoBits = infoBytes * 8;
+    el.m_codeBits = codeBytes * 8;
+    AddHarqInfo(m_slProcesses, rnti, l1dst, el, SL_MAX_HARQ_RETX);
 }
 
 void
 LteSlHarqPhy::UpdateSlHarqProcessStatus(uint16_t rnti, uint8_t l1dst, double sinr)
 {
     NS_LOG_FUNCTION(this << rnti << sinr);
-    std::map<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>::iterator it;
-    std::map<uint8_t, HarqProcessInfoList_t>::iterator it2;
-
-    it = m_miSlHarqProcessesInfoMap.find(rnti);
-    if (it == m_miSlHarqProcessesInfoMap.end())
-    {
-        // new entry
-        HarqProcessInfoList_t harqInfo;
-        HarqProcessInfoElement_t el;
-        el.m_mi = 0;
-        el.m_infoBits = 0;
-        el.m_codeBits = 0;
-        el.m_sinr = sinr;
-        harqInfo.push_back(el);
-        std::map<uint8_t, HarqProcessInfoList_t> map;
-        map.insert(std::pair<uint8_t, HarqProcessInfoList_t>(l1dst, harqInfo));
-        m_miSlHarqProcessesInfoMap.insert(
-            std::pair<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>(rnti, map));
-    }
-    else
-    {
-        it2 = it->second.find(l1dst);
-        if (it2 == it->second.end())
-        {
-            // new entry
-            HarqProcessInfoList_t harqInfo;
-            HarqProcessInfoElement_t el;
-            el.m_mi = 0;
-            el.m_infoBits = 0;
-            el.m_codeBits = 0;
-            el.m_sinr = sinr;
-            harqInfo.push_back(el);
-            (*it).second.insert(std::pair<uint8_t, HarqProcessInfoList_t>(l1dst, harqInfo));
-        }
-        else
-        {
-            if ((*it2).second.size() == 3) // MAX HARQ RETX
-            {
-                NS_LOG_DEBUG("numRetx = " << (*it2).second.size() << " discard info");
-                // HARQ should be disabled -> discard info
-                return;
-            }
-            HarqProcessInfoElement_t el;
-            el.m_mi = 0;
-            el.m_infoBits = 0;
-            el.m_codeBits = 0;
-            el.m_sinr = sinr;
-            (*it2).second.push_back(el);
-        }
-    }
+    HarqProcessInfoElement_t el;
+    el.m_mi = 0;
+    el.m_infoBits = 0;
+    el.m_codeBits = 0;
+    el.m_sinr = sinr;
+    AddHarqInfo(m_slProcesses, rnti, l1dst, el, SL_MAX_HARQ_RETX);
 }
 
 void
 LteSlHarqPhy::UpdateDiscHarqProcessStatus(uint16_t rnti, uint8_t resPsdch, double sinr)
 {
     NS_LOG_FUNCTION(this << rnti << sinr);
-    std::map<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>::iterator it;
-    std::map<uint8_t, HarqProcessInfoList_t>::iterator it2;
-
-    it = m_miDiscHarqProcessesInfoMap.find(rnti);
-    if (it == m_miDiscHarqProcessesInfoMap.end())
-    {
-        // new entry
-        HarqProcessInfoList_t harqInfo;
-        HarqProcessInfoElement_t el;
-        el.m_mi = 0;
-        el.m_infoBits = 0;
-        el.m_codeBits = 0;
-        el.m_sinr = sinr;
-        harqInfo.push_back(el);
-        std::map<uint8_t, HarqProcessInfoList_t> map;
-        map.insert(std::pair<uint8_t, HarqProcessInfoList_t>(resPsdch, harqInfo));
-        m_miDiscHarqProcessesInfoMap.insert(
-            std::pair<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>(rnti, map));
-    }
-    else
-    {
-        it2 = it->second.find(resPsdch);
-        if (it2 == it->second.end())
-        {
-            // new entry
-            HarqProcessInfoList_t harqInfo;
-            HarqProcessInfoElement_t el;
-            el.m_mi = 0;
-            el.m_infoBits = 0;
-            el.m_codeBits = 0;
-            el.m_sinr = sinr;
-            harqInfo.push_back(el);
-            (*it).second.insert(std::pair<uint8_t, HarqProcessInfoList_t>(resPsdch, harqInfo));
-        }
-        else
-        {
-            if ((*it2).second.size() == m_discNumRetx) // MAX HARQ RETX
-            {
-                NS_LOG_DEBUG("numRetx = " << (uint16_t)m_discNumRetx << " discard info");
-                // HARQ should be disabled -> discard info
-                return;
-            }
-            HarqProcessInfoElement_t el;
-            el.m_mi = 0;
-            el.m_infoBits = 0;
-            el.m_codeBits = 0;
-            el.m_sinr = sinr;
-            (*it2).second.push_back(el);
-        }
-    }
+    HarqProcessInfoElement_t el;
+    el.m_mi = 0;
+    el.m_infoBits = 0;
+    el.m_codeBits = 0;
+    el.m_sinr = sinr;
+    AddHarqInfo(m_discProcesses, rnti, resPsdch, el, m_discNumRetx);
 }
 
 void
 LteSlHarqPhy::ResetSlHarqProcessStatus(uint16_t rnti, uint8_t l1dst)
 {
     NS_LOG_FUNCTION(this << rnti << (uint16_t)l1dst);
-    std::map<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>::iterator it;
-    std::map<uint8_t, HarqProcessInfoList_t>::iterator it2;
-    it = m_miSlHarqProcessesInfoMap.find(rnti);
-    if (it == m_miSlHarqProcessesInfoMap.end())
+    auto it = m_slProcesses.find(GetProcessId(rnti, l1dst));
+    if (it != m_slProcesses.end())
     {
-        // new entry
-        HarqProcessInfoList_t harqInfo;
-        std::map<uint8_t, HarqProcessInfoList_t> map;
-        map.insert(std::pair<uint8_t, HarqProcessInfoList_t>(l1dst, harqInfo));
-        m_miSlHarqProcessesInfoMap.insert(
-            std::pair<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>(rnti, map));
-    }
-    else
-    {
-        it2 = (*it).second.find(l1dst);
-        if (it2 == (*it).second.end())
-        {
-            HarqProcessInfoList_t harqInfo;
-            std::map<uint8_t, HarqProcessInfoList_t> map;
-            it->second.insert(std::pair<uint8_t, HarqProcessInfoList_t>(l1dst, harqInfo));
-        }
-        else
-        {
-            (*it2).second.clear();
-        }
+        // release the history, the process is removed once its TB index and
+        // decoded flag are reset too
+        HarqProcessInfoList_t().swap(it->second.history);
+        RemoveIfIdle(m_slProcesses, it);
     }
 }
 
@@ -468,31 +285,11 @@ void
 LteSlHarqPhy::ResetDiscHarqProcessStatus(uint16_t rnti, uint8_t resPsdch)
 {
     NS_LOG_FUNCTION(this << rnti << (uint16_t)resPsdch);
-    std::map<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>::iterator it;
-    std::map<uint8_t, HarqProcessInfoList_t>::iterator it2;
-    it = m_miDiscHarqProcessesInfoMap.find(rnti);
-    if (it == m_miDiscHarqProcessesInfoMap.end())
-    {
-        // new entry
-        HarqProcessInfoList_t harqInfo;
-        std::map<uint8_t, HarqProcessInfoList_t> map;
-        map.insert(std::pair<uint8_t, HarqProcessInfoList_t>(resPsdch, harqInfo));
-        m_miDiscHarqProcessesInfoMap.insert(
-            std::pair<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>(rnti, map));
-    }
-    else
+    auto it = m_discProcesses.find(GetProcessId(rnti, resPsdch));
+    if (it != m_discProcesses.end())
     {
-        it2 = (*it).second.find(resPsdch);
-        if (it2 == (*it).second.end())
-        {
-            HarqProcessInfoList_t harqInfo;
-            std::map<uint8_t, HarqProcessInfoList_t> map;
-            it->second.insert(std::pair<uint8_t, HarqProcessInfoList_t>(resPsdch, harqInfo));
-        }
-        else
-        {
-            (*it2).second.clear();
-        }
+        HarqProcessInfoList_t().swap(it->second.history);
+        RemoveIfIdle(m_discProcesses, it);
     }
 }
 
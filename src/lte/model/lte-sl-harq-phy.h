@@ -28,9 +28,8 @@
 #include <ns3/log.h>
 #include <ns3/simple-ref-count.h>
 
-#include <map>
 #include <math.h>
-#include <set>
+#include <unordered_map>
 #include <vector>
 
 namespace ns3
@@ -133,18 +132,34 @@ class LteSlHarqPhy : public SimpleRefCount<LteSlHarqPhy>
      * for SL
      * \param rnti the RNTI of the transmitter
      * \param l1dst The layer 1 destination ID
-     * \return the vector of the info related to HARQ proc Id
+     * \return the vector of the info related to HARQ proc Id, which is valid
+     *         until the next update or reset of the HARQ process
      */
-    HarqProcessInfoList_t GetHarqProcessInfoSl(uint16_t rnti, uint8_t l1dst);
+    const HarqProcessInfoList_t& GetHarqProcessInfoSl(uint16_t rnti, uint8_t l1dst) const;
 
     /**
      * \brief Return the info of the HARQ procId in case of retransmissions
      * for d2d discovery
      * \param rnti the RNTI of the transmitter
      * \param resPsdch The resource used
-     * \return the vector of the info related to HARQ proc Id
+     * \return the vector of the info related to HARQ proc Id, which is valid
+     *         until the next update or reset of the HARQ process
      */
-    HarqProcessInfoList_t GetHarqProcessInfoDisc(uint16_t rnti, uint8_t resPsdch);
+    const HarqProcessInfoList_t& GetHarqProcessInfoDisc(uint16_t rnti, uint8_t resPsdch) const;
+
+    /**
+     * \brief Return the info of the HARQ procId to use when decoding a received
+     * d2d discovery TB: the previous transmissions of the TB for a
+     * retransmission, and none for a new transmission
+     * \param rnti the RNTI of the transmitter
+     * \param resPsdch The resource used
+     * \param ndi The new data indicator of the TB, 1 for a new transmission
+     * \return the vector of the info related to HARQ proc Id, which is valid
+     *         until the next update or reset of the HARQ process
+     */
+    const HarqProcessInfoList_t& GetHarqProcessInfoDisc(uint16_t rnti,
+                                                        uint8_t resPsdch,
+                                                        uint8_t ndi) const;
 
     /**
      * \brief Update the MI value associated to the decodification of an HARQ process
@@ -195,14 +210,65 @@ class LteSlHarqPhy : public SimpleRefCount<LteSlHarqPhy>
     void ResetDiscHarqProcessStatus(uint16_t rnti, uint8_t resPsdch);
 
   private:
-    std::set<uint32_t> m_decoded;         ///< Container to track Sidelink communication decoded TBs
-    std::set<uint32_t> m_discDecoded;     ///< Container to track Sidelink discovery decoded TBs
-    std::map<uint32_t, uint32_t> m_tbIdx; ///< map the TB id (formed by (rnti << 8) + l1dst) and the
-                                          ///< count of TB received for a particular TB id
-    std::map<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>
-        m_miSlHarqProcessesInfoMap; ///< Sidelink communication HARQ processes info map
-    std::map<uint16_t, std::map<uint8_t, HarqProcessInfoList_t>>
-        m_miDiscHarqProcessesInfoMap; ///< Sidelink discovery HARQ process info map
+    /**
+     * Maximum number of previous transmissions kept in the HARQ information
+     * of a Sidelink communication TB, i.e., the retransmissions of the 4
+     * transmissions of a PSSCH TB
+     */
+    static constexpr uint8_t SL_MAX_HARQ_RETX = 3;
+
+    /// State of the HARQ process of a transmitter and a destination (or a discovery resource)
+    struct HarqProcess
+    {
+        bool hasTbIdx{false};          ///< whether the TB index has been set
+        uint32_t tbIdx{0};             ///< count of TBs received
+        bool decoded{false};           ///< whether the current TB has already been decoded
+        HarqProcessInfoList_t history; ///< info of the previous transmissions of the current TB
+    };
+
+    /// HARQ processes indexed by their ID, formed by (rnti << 8) + l1dst (or resPsdch)
+    typedef std::unordered_map<uint32_t, HarqProcess> HarqProcessMap;
+
+    /**
+     * \param rnti The UE identifier
+     * \param id The group identifier or the discovery resource index
+     * \return the ID of the HARQ process
+     */
+    static uint32_t GetProcessId(uint16_t rnti, uint8_t id);
+
+    /**
+     * Find a HARQ process.
+     * \param processes The HARQ processes
+     * \param rnti The UE identifier
+     * \param id The group identifier or the discovery resource index
+     * \return the HARQ process, or nullptr if it has no state
+     */
+    static const HarqProcess* Find(const HarqProcessMap& processes, uint16_t rnti, uint8_t id);
+
+    /**
+     * Add the info of a transmission to the history of a HARQ process,
+     * unless the history is full.
+     * \param processes The HARQ processes
+     * \param rnti The UE identifier
+     * \param id The group identifier or the discovery resource index
+     * \param el The info of the transmission
+     * \param maxRetx The capacity of the history
+     */
+    static void AddHarqInfo(HarqProcessMap& processes,
+                            uint16_t rnti,
+                            uint8_t id,
+                            const HarqProcessInfoElement_t& el,
+                            uint8_t maxRetx);
+
+    /**
+     * Remove a HARQ process if it has no state left.
+     * \param processes The HARQ processes
+     * \param it The HARQ process
+     */
+    static void RemoveIfIdle(HarqProcessMap& processes, HarqProcessMap::iterator it);
+
+    HarqProcessMap m_slProcesses;   ///< Sidelink communication HARQ processes
+    HarqProcessMap m_discProcesses; ///< Sidelink discovery HARQ processes
 
     uint8_t m_discNumRetx; ///< Total number retransmissions configured for Sidelink discovery
                            ///< transmissions
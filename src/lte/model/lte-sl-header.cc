@@ -36,6 +36,7 @@
 #include "lte-sl-header.h"
 
 #include "ns3/log.h"
+#include "ns3/packet.h"
 
 namespace ns3
 {
@@ -287,6 +288,35 @@ LteSlDiscHeader::GetSerializedSize() const
     return 29;
 }
 
+bool
+LteSlDiscHeader::PeekMessageTypeAndCode(Ptr<const Packet> p, uint8_t& msgType, uint32_t& code)
+{
+    // message type followed by the first bytes of the code, which Serialize
+    // writes in little-endian order
+    uint8_t buffer[5];
+    if (p->CopyData(buffer, sizeof(buffer)) < sizeof(buffer))
+    {
+        return false;
+    }
+    msgType = buffer[0];
+    switch (msgType)
+    {
+    case DISC_OPEN_ANNOUNCEMENT:
+    case DISC_RESTRICTED_QUERY:
+    case DISC_RESTRICTED_RESPONSE:
+        code = buffer[1] | (buffer[2] << 8) | (buffer[3] << 16) |
+               (static_cast<uint32_t>(buffer[4]) << 24);
+        return true;
+    case DISC_RELAY_ANNOUNCEMENT:
+    case DISC_RELAY_RESPONSE:
+    case DISC_RELAY_SOLICITATION:
+        code = buffer[1] | (buffer[2] << 8) | (buffer[3] << 16);
+        return true;
+    default:
+        return false;
+    }
+}
+
 void
 LteSlDiscHeader::Serialize(Buffer::Iterator start) const
 {
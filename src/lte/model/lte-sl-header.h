@@ -39,12 +39,15 @@
 #include "ff-mac-common.h"
 
 #include "ns3/header.h"
+#include "ns3/ptr.h"
 
 #include <list>
 
 namespace ns3
 {
 
+class Packet;
+
 /**
  * \ingroup lte
  * \brief The packet header for the discovery packets
@@ -251,6 +254,21 @@ class LteSlDiscHeader : public Header
                                     uint32_t relayUeId,
                                     uint32_t status);
 
+    /**
+     * \brief Read the message type and the code of a discovery message
+     *
+     * Only the first bytes of the packet are read, without deserializing
+     * the header, so that the receivers can discard the messages they are
+     * not monitoring at a low cost.
+     *
+     * \param p the packet, starting with the discovery header
+     * \param msgType the discovery message type
+     * \param code the application code of the open and restricted messages,
+     *        or the relay service code of the relay messages
+     * \return false if the packet is too short or the message type is unknown
+     */
+    static bool PeekMessageTypeAndCode(Ptr<const Packet> p, uint8_t& msgType, uint32_t& code);
+
     /**
      * \brief Get the type ID.
      * \return the object TypeId
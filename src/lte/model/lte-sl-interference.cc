@@ -27,6 +27,8 @@
 #include <ns3/log.h>
 #include <ns3/simulator.h>
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -53,7 +55,11 @@ LteSlInterference::DoDispose()
     m_sinrChunkProcessorList.clear();
     m_interfChunkProcessorList.clear();
     m_rxSignal.clear();
+    m_rxSignalRbs.clear();
+    m_rxSignalLastEval.clear();
+    m_pendingSubtractions.clear();
     m_allSignals = nullptr;
+    m_allSignalsIntegral = nullptr;
     m_noise = nullptr;
     Object::DoDispose();
 }
@@ -76,6 +82,10 @@ LteSlInterference::StartRx(Ptr<const SpectrumValue> rxPsd)
         NS_LOG_LOGIC("first signal"); // Still check that receiving multiple simultaneous signals,
                                       // make sure they are synchronized
         m_rxSignal.clear();
+        m_rxSignalRbs.clear();
+        m_rxSignalLastEval.clear();
+        m_allSignalsIntegral = Create<SpectrumValue>(rxPsd->GetSpectrumModel());
+        m_rxStartTime = Now();
         m_receiving = true;
     }
     else
@@ -86,6 +96,8 @@ LteSlInterference::StartRx(Ptr<const SpectrumValue> rxPsd)
 
     // In Sidelink, each packet must be monitor separately
     m_rxSignal.push_back(rxPsd->Copy());
+    m_rxSignalRbs.push_back(GetRbRange(rxPsd));
+    m_rxSignalLastEval.push_back(Now());
     m_lastChangeTime = Now();
 
     // trigger the initialization of each chunk processor
@@ -114,7 +126,38 @@ LteSlInterference::EndRx()
     }
     else
     {
-        ConditionallyEvaluateChunk();
+        ConditionallyEvaluateChunk(RbRange(0, m_allSignals->GetValuesN() - 1));
+        // flush the SINR chunks deferred by the changes that did not overlap
+        for (uint32_t index = 0; index < m_rxSignal.size(); ++index)
+        {
+            EvaluateSinrChunk(index);
+        }
+        //
+        // The interference seen by each signal is the total power minus its
+        // own plus the noise, so its time average can be derived from the
+        // integral of the total power.  The RS power of a signal is constant.
+        //
+        Time duration = Now() - m_rxStartTime;
+        if (duration.IsStrictlyPositive())
+        {
+            SpectrumValue allSignalsAvg = (*m_allSignalsIntegral) / duration.GetSeconds();
+            for (uint32_t index = 0; index < m_rxSignal.size(); ++index)
+            {
+                SpectrumValue interf = allSignalsAvg - (*(m_rxSignal[index])) + (*m_noise);
+                for (auto it = m_interfChunkProcessorList.begin();
+                     it != m_interfChunkProcessorList.end();
+                     ++it)
+                {
+                    (*it)->EvaluateChunk(index, interf, duration);
+                }
+                for (auto it = m_rsPowerChunkProcessorList.begin();
+                     it != m_rsPowerChunkProcessorList.end();
+                     ++it)
+                {
+                    (*it)->EvaluateChunk(index, *(m_rxSignal[index]), duration);
+                }
+            }
+        }
         m_receiving = false;
         for (auto it = m_rsPowerChunkProcessorList.begin(); it != m_rsPowerChunkProcessorList.end();
              ++it)
@@ -148,37 +191,78 @@ LteSlInterference::AddSignal(Ptr<const SpectrumValue> spd, const Time duration)
         // boundary further.
         m_lastSignalIdBeforeReset += 0x10000000;
     }
-    Simulator::Schedule(duration, &LteSlInterference::DoSubtractSignal, this, spd, signalId);
+    // signals ending at the same time share a single subtraction event
+    auto& ending = m_pendingSubtractions[Now() + duration];
+    if (ending.empty())
+    {
+        Simulator::Schedule(duration, &LteSlInterference::DoSubtractSignals, this);
+    }
+    ending.emplace_back(spd, signalId);
 }
 
 void
 LteSlInterference::DoAddSignal(Ptr<const SpectrumValue> spd)
 {
     NS_LOG_FUNCTION(this << *spd);
-    ConditionallyEvaluateChunk();
+    ConditionallyEvaluateChunk(GetRbRange(spd));
     (*m_allSignals) += (*spd);
 }
 
 void
-LteSlInterference::DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalId)
+LteSlInterference::DoSubtractSignals()
 {
-    NS_LOG_FUNCTION(this << *spd);
-    ConditionallyEvaluateChunk();
-    int32_t deltaSignalId = signalId - m_lastSignalIdBeforeReset;
-    if (deltaSignalId > 0)
+    NS_LOG_FUNCTION(this);
+    auto ending = m_pendingSubtractions.begin();
+    NS_ASSERT(ending != m_pendingSubtractions.end() && ending->first == Now());
+
+    RbRange range(UINT32_MAX, 0);
+    for (const auto& signal : ending->second)
     {
-        (*m_allSignals) -= (*spd);
+        RbRange signalRange = GetRbRange(signal.first);
+        range.first = std::min(range.first, signalRange.first);
+        range.second = std::max(range.second, signalRange.second);
     }
-    else
+    ConditionallyEvaluateChunk(range);
+    for (const auto& signal : ending->second)
     {
-        NS_LOG_INFO("ignoring signal scheduled for subtraction before last reset");
+        int32_t deltaSignalId = signal.second - m_lastSignalIdBeforeReset;
+        if (deltaSignalId > 0)
+        {
+            (*m_allSignals) -= (*signal.first);
+        }
+        else
+        {
+            NS_LOG_INFO("ignoring signal scheduled for subtraction before last reset");
+        }
     }
+    m_pendingSubtractions.erase(ending);
+}
+
+LteSlInterference::RbRange
+LteSlInterference::GetRbRange(Ptr<const SpectrumValue> spd)
+{
+    uint32_t nRbs = spd->GetValuesN();
+    uint32_t first = 0;
+    while (first < nRbs && spd->ValuesAt(first) == 0)
+    {
+        ++first;
+    }
+    if (first == nRbs)
+    {
+        return RbRange(1, 0);
+    }
+    uint32_t last = nRbs - 1;
+    while (spd->ValuesAt(last) == 0)
+    {
+        --last;
+    }
+    return RbRange(first, last);
 }
 
 void
-LteSlInterference::ConditionallyEvaluateChunk()
+LteSlInterference::ConditionallyEvaluateChunk(RbRange range)
 {
-    NS_LOG_FUNCTION(this);
+    NS_LOG_FUNCTION(this << range.first << range.second);
     if (m_receiving)
     {
         NS_LOG_DEBUG(this << " Receiving");
@@ -186,43 +270,54 @@ LteSlInterference::ConditionallyEvaluateChunk()
     NS_LOG_DEBUG(this << " now " << Now() << " last " << m_lastChangeTime);
     if (m_receiving && (Now() > m_lastChangeTime))
     {
-        // compute values for each signal being received
+        (*m_allSignalsIntegral) += (*m_allSignals) * (Now() - m_lastChangeTime).GetSeconds();
+        //
+        // The SINR of a signal is zero outside of its RBs, and does not
+        // change within them unless the change overlaps them.  So only the
+        // signals overlapping the change need to be evaluated now.
+        //
         for (uint32_t index = 0; index < m_rxSignal.size(); ++index)
         {
-            NS_LOG_LOGIC(this << " signal = " << *(m_rxSignal[index])
-                              << " allSignals = " << *m_allSignals << " noise = " << *m_noise);
-
-            SpectrumValue interf = (*m_allSignals) - (*(m_rxSignal[index])) + (*m_noise);
-
-            SpectrumValue sinr = (*(m_rxSignal[index])) / interf;
-            Time duration = Now() - m_lastChangeTime;
-            for (auto it = m_sinrChunkProcessorList.begin(); it != m_sinrChunkProcessorList.end();
-                 ++it)
+            if (range.first <= m_rxSignalRbs[index].second &&
+                m_rxSignalRbs[index].first <= range.second)
             {
-                (*it)->EvaluateChunk(index, sinr, duration);
-            }
-            for (auto it = m_interfChunkProcessorList.begin();
-                 it != m_interfChunkProcessorList.end();
-                 ++it)
-            {
-                (*it)->EvaluateChunk(index, interf, duration);
-            }
-            for (auto it = m_rsPowerChunkProcessorList.begin();
-                 it != m_rsPowerChunkProcessorList.end();
-                 ++it)
-            {
-                (*it)->EvaluateChunk(index, *(m_rxSignal[index]), duration);
+                EvaluateSinrChunk(index);
             }
         }
         m_lastChangeTime = Now();
     }
 }
 
+void
+LteSlInterference::EvaluateSinrChunk(uint32_t index)
+{
+    NS_LOG_FUNCTION(this << index);
+    Time duration = Now() - m_rxSignalLastEval[index];
+    if (!duration.IsStrictlyPositive())
+    {
+        return;
+    }
+    NS_LOG_LOGIC(this << " signal = " << *(m_rxSignal[index]) << " allSignals = " << *m_allSignals
+                      << " noise = " << *m_noise);
+
+    SpectrumValue interf = (*m_allSignals) - (*(m_rxSignal[index])) + (*m_noise);
+
+    SpectrumValue sinr = (*(m_rxSignal[index])) / interf;
+    for (auto it = m_sinrChunkProcessorList.begin(); it != m_sinrChunkProcessorList.end(); ++it)
+    {
+        (*it)->EvaluateChunk(index, sinr, duration);
+    }
+    m_rxSignalLastEval[index] = Now();
+}
+
 void
 LteSlInterference::SetNoisePowerSpectralDensity(Ptr<const SpectrumValue> noisePsd)
 {
     NS_LOG_FUNCTION(this << *noisePsd);
-    ConditionallyEvaluateChunk();
+    if (m_allSignals)
+    {
+        ConditionallyEvaluateChunk(RbRange(0, m_allSignals->GetValuesN() - 1));
+    }
     m_noise = noisePsd;
     // reset m_allSignals (will reset if already set previously)
     // this is needed since this method can potentially change the SpectrumModel
@@ -29,6 +29,9 @@
 #include <ns3/spectrum-value.h>
 
 #include <list>
+#include <map>
+#include <utility>
+#include <vector>
 
 namespace ns3
 {
@@ -112,10 +115,34 @@ class LteSlInterference : public Object
     void SetNoisePowerSpectralDensity(Ptr<const SpectrumValue> noisePsd);
 
   private:
+    /// First and last RB (inclusive) with non-zero power in a PSD
+    typedef std::pair<uint32_t, uint32_t> RbRange;
+
+    /**
+     * Get the range of RBs occupied by a PSD
+     *
+     * \param spd The power spectral density
+     * \return The first and last RB with non-zero power; the range is empty
+     *         (first > last) if the PSD is all zero
+     */
+    static RbRange GetRbRange(Ptr<const SpectrumValue> spd);
     /**
      * Conditionally evaluate chunk
+     *
+     * Only the SINR of the signals being received whose RBs overlap the
+     * given range is evaluated; the SINR of the other signals is not affected
+     * by the change and their evaluation is deferred.
+     *
+     * \param range The range of RBs affected by the upcoming change
+     */
+    void ConditionallyEvaluateChunk(RbRange range);
+    /**
+     * Evaluate the SINR chunk of a signal being received, from the time of
+     * its last evaluation to now
+     *
+     * \param index The index of the signal
      */
-    void ConditionallyEvaluateChunk();
+    void EvaluateSinrChunk(uint32_t index);
     /**
      * Add signal function
      *
@@ -123,12 +150,10 @@ class LteSlInterference : public Object
      */
     void DoAddSignal(Ptr<const SpectrumValue> spd);
     /**
-     * Subtract signal
-     *
-     * \param spd The power spectral density of the new signal
-     * \param signalId The signal ID
+     * Subtract all the signals ending now, with a single evaluation of the
+     * chunks
      */
-    void DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalId);
+    void DoSubtractSignals();
 
     bool m_receiving; ///< are we receiving?
 
@@ -143,11 +168,26 @@ class LteSlInterference : public Object
                        * does not include noise, includes the SPD of the signal being RX
                        */
 
+    std::vector<RbRange> m_rxSignalRbs; ///< the RBs occupied by each signal being RX
+
+    std::vector<Time>
+        m_rxSignalLastEval; ///< the time up to which the SINR of each signal was evaluated
+
+    Ptr<SpectrumValue> m_allSignalsIntegral; /**< time integral of m_allSignals
+                                              * since the start of the RX attempt
+                                              */
+
+    Time m_rxStartTime; ///< the time the RX attempt started
+
     Ptr<const SpectrumValue> m_noise; ///< the noise value
 
     Time m_lastChangeTime; /**< the time of the last change in
                               m_TotalPower */
 
+    /// The signals to subtract, with their signal ID, indexed by end time
+    std::map<Time, std::vector<std::pair<Ptr<const SpectrumValue>, uint32_t>>>
+        m_pendingSubtractions;
+
     uint32_t m_lastSignalId;            ///< the last signal ID
     uint32_t m_lastSignalIdBeforeReset; ///< the last signal ID before reset
 
@@ -124,7 +124,8 @@ NS_OBJECT_ENSURE_REGISTERED(SidelinkCommResourcePool);
 
 ///// SidelinkCommResourcePool //////
 SidelinkCommResourcePool::SidelinkCommResourcePool()
-    : m_type(SidelinkCommResourcePool::UNKNOWN)
+    : m_type(SidelinkCommResourcePool::UNKNOWN),
+      m_psschTxCacheNext(0)
 {
     NS_LOG_FUNCTION(this);
     m_preconfigured = false;
@@ -225,6 +226,7 @@ SidelinkCommResourcePool::Initialize()
     NS_LOG_FUNCTION(this);
     ComputeNumberOfPscchResources();
     ComputeNumberOfPsschResources();
+    ClearPsschTransmissionCache();
 }
 
 SidelinkCommResourcePool::SlPoolType
@@ -402,6 +404,96 @@ SidelinkCommResourcePool::GetPsschTransmissions(SidelinkCommResourcePool::Subfra
                          << periodStart.frameNo << "subframe no. " << periodStart.subframeNo
                          << "itrp  " << (uint16_t)itrp << " rbStart " << (uint16_t)rbStart
                          << " rbLen " << (uint16_t)rbLen);
+    const std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>& txInfo =
+        GetCachedPsschTransmissions(periodStart, itrp, rbStart, rbLen);
+    return std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo>(txInfo.begin(),
+                                                                          txInfo.end());
+}
+
+const std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>&
+SidelinkCommResourcePool::GetCachedPsschTransmissions(
+    SidelinkCommResourcePool::SubframeInfo periodStart,
+    uint8_t itrp,
+    uint8_t rbStart,
+    uint8_t rbLen)
+{
+    NS_LOG_FUNCTION(this << periodStart.frameNo << periodStart.subframeNo << (uint16_t)itrp
+                         << (uint16_t)rbStart << (uint16_t)rbLen);
+    uint32_t periodSubframe = 10 * (periodStart.frameNo % 1024) + periodStart.subframeNo % 10;
+
+    PsschTransmissionCache* cache = nullptr;
+    for (auto& c : m_psschTxCache)
+    {
+        if (c.periodSubframe == periodSubframe)
+        {
+            cache = &c;
+            break;
+        }
+    }
+    if (cache == nullptr)
+    {
+        // new period: replace the transmissions of the oldest one
+        cache = &m_psschTxCache[m_psschTxCacheNext];
+        m_psschTxCacheNext = 1 - m_psschTxCacheNext;
+        cache->periodSubframe = periodSubframe;
+        cache->transmissions.clear();
+    }
+
+    auto key = std::make_tuple(itrp, rbStart, rbLen);
+    auto it = cache->transmissions.find(key);
+    if (it == cache->transmissions.end())
+    {
+        it = cache->transmissions
+                 .emplace(key, ComputePsschTransmissions(periodSubframe, itrp, rbStart, rbLen))
+                 .first;
+    }
+    return it->second;
+}
+
+void
+SidelinkCommResourcePool::ClearPsschTransmissionCache()
+{
+    NS_LOG_FUNCTION(this);
+    m_itrpSubframes.clear();
+    for (auto& c : m_psschTxCache)
+    {
+        c.periodSubframe = std::numeric_limits<uint32_t>::max();
+        c.transmissions.clear();
+    }
+}
+
+const std::vector<uint32_t>&
+SidelinkCommResourcePool::GetItrpSubframes(uint8_t itrp)
+{
+    auto it = m_itrpSubframes.find(itrp);
+    if (it == m_itrpSubframes.end())
+    {
+        // N_TRP and the bitmap b' as defined in TS 36.213 14.1.1.1.1
+        uint32_t ntrp = 8;
+        std::bitset<8> bitmap = ItrpToBitmap[itrp];
+
+        std::vector<uint32_t> subframes;
+        for (uint32_t i = 0; i < m_lpssch; i++)
+        {
+            // compute b_i = b'_(i mod N_TRP)
+            if (bitmap[7 - (i % ntrp)]) // reverse order because b0 is the msb in the bitmap
+            {
+                subframes.push_back(m_lpsschVector[i]);
+            }
+        }
+        it = m_itrpSubframes.emplace(itrp, std::move(subframes)).first;
+    }
+    return it->second;
+}
+
+std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>
+SidelinkCommResourcePool::ComputePsschTransmissions(uint32_t periodSubframe,
+                                                    uint8_t itrp,
+                                                    uint8_t rbStart,
+                                                    uint8_t rbLen)
+{
+    NS_LOG_FUNCTION(this << periodSubframe << (uint16_t)itrp << (uint16_t)rbStart
+                         << (uint16_t)rbLen);
 
     if (m_type == SidelinkCommResourcePool::UE_SELECTED)
     {
@@ -422,21 +514,12 @@ SidelinkCommResourcePool::GetPsschTransmissions(SidelinkCommResourcePool::Subfra
         }
     }
 
-    int32_t periodSubframe = 10 * (periodStart.frameNo % 1024) + periodStart.subframeNo % 10;
-
-    // N_TRP and the bitmap b' as defined in TS 36.213 14.1.1.1.1
-    uint32_t ntrp = 8;
-    std::bitset<8> bitmap = ItrpToBitmap[itrp];
-
     std::vector<uint32_t> psschsubframes;
-    for (uint32_t i = 0; i < m_lpssch; i++)
+    for (uint32_t subframe : GetItrpSubframes(itrp))
     {
-        // compute b_i = b'_(i mod N_TRP)
-        if (bitmap[7 - (i % ntrp)] &&
-            periodSubframe + m_lpsschVector[i] <
-                10240) // reverse order because b0 is the msb in the bitmap
+        if (periodSubframe + subframe < 10240)
         {
-            psschsubframes.push_back(periodSubframe + m_lpsschVector[i]);
+            psschsubframes.push_back(periodSubframe + subframe);
         }
     }
 
@@ -477,7 +560,8 @@ SidelinkCommResourcePool::GetPsschTransmissions(SidelinkCommResourcePool::Subfra
         }
     }
 
-    std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo> txInfo;
+    std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo> txInfo;
+    txInfo.reserve(psschsubframes.size());
     uint32_t tx_counter =
         1; // Transmission counter, used to keep track of parity when frequency hopping.
     for (auto it = psschsubframes.begin(); it != psschsubframes.end(); it++)
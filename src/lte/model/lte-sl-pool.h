@@ -42,6 +42,8 @@
 
 #include <map>
 #include <set>
+#include <tuple>
+#include <vector>
 
 namespace ns3
 {
@@ -253,6 +255,27 @@ class SidelinkCommResourcePool : public Object
         uint8_t rbStart,
         uint8_t rbLen);
 
+    /**
+     * Returns the subframes and RBs associated with the transmission on PSSCH,
+     * without copying them.
+     *
+     * The transmissions are computed once per Sidelink period and allocation,
+     * and kept for the last two periods requested.  The returned reference is
+     * valid until the transmissions of another period are requested, or the
+     * pool is reconfigured.
+     *
+     * \param periodStart The first subframe in the Sidelink period
+     * \param itrp The repetition pattern from the SCI format 0 message
+     * \param rbStart The index of the PRB where the transmission occurs
+     * \param rbLen The length of the transmission
+     * \return The subframes and RBs associated with the transmission on PSSCH
+     */
+    const std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>&
+    GetCachedPsschTransmissions(SubframeInfo periodStart,
+                                uint8_t itrp,
+                                uint8_t rbStart,
+                                uint8_t rbLen);
+
     /**
      * Returns all PSSCH subframe index relative to the start of SL period
      * \return A vector of subframe index relative to the start of SL period
@@ -376,6 +399,34 @@ class SidelinkCommResourcePool : public Object
      */
     void ComputeNumberOfPsschResources();
 
+    /**
+     * Computes the subframes and RBs associated with the transmission on PSSCH
+     * \param periodSubframe The first subframe in the Sidelink period (10 * frame + subframe)
+     * \param itrp The repetition pattern from the SCI format 0 message
+     * \param rbStart The index of the PRB where the transmission occurs
+     * \param rbLen The length of the transmission
+     * \return The subframes and RBs associated with the transmission on PSSCH
+     */
+    std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo> ComputePsschTransmissions(
+        uint32_t periodSubframe,
+        uint8_t itrp,
+        uint8_t rbStart,
+        uint8_t rbLen);
+
+    /**
+     * Returns the PSSCH subframes selected by a repetition pattern, relative
+     * to the start of the Sidelink period (i.e., the subframes of
+     * m_lpsschVector whose bit is set in the T-RPT bitmap)
+     * \param itrp The repetition pattern from the SCI format 0 message
+     * \return The PSSCH subframes of the repetition pattern
+     */
+    const std::vector<uint32_t>& GetItrpSubframes(uint8_t itrp);
+
+    /**
+     * Clears the PSSCH transmission caches, when the pool is (re)configured
+     */
+    void ClearPsschTransmissionCache();
+
     /**
      * The `ReportNextScPeriod` trace source. Fired upon when the next
      * Sidelink Control (SC) period is computed. Exporting FrameNo, SubframeNo
@@ -400,6 +451,21 @@ class SidelinkCommResourcePool : public Object
         m_goldSequence; ///< Pseudo random sequence used for frequency hopping Type 2.
 
     bool m_preconfigured; ///< Indicates if the pool is preconfigured
+
+    std::map<uint8_t, std::vector<uint32_t>>
+        m_itrpSubframes; ///< PSSCH subframes of each repetition pattern used, see GetItrpSubframes
+
+    /// PSSCH transmissions computed for a Sidelink period
+    struct PsschTransmissionCache
+    {
+        uint32_t periodSubframe{std::numeric_limits<uint32_t>::max()}; ///< start of the period
+        std::map<std::tuple<uint8_t, uint8_t, uint8_t>,
+                 std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>>
+            transmissions; ///< transmissions by (itrp, rbStart, rbLen)
+    };
+
+    PsschTransmissionCache m_psschTxCache[2]; ///< PSSCH transmissions of the last two periods
+    uint8_t m_psschTxCacheNext; ///< index of the cache replaced by the next period
 };
 
 /**
@@ -0,0 +1,173 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#include "lte-sl-relay-candidate-table.h"
+
+#include <ns3/abort.h>
+#include <ns3/assert.h>
+#include <ns3/log.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LteSlRelayCandidateTable");
+
+LteSlRelayCandidateTable::LteSlRelayCandidateTable(uint32_t capacity)
+    : m_capacity(0)
+{
+    SetCapacity(capacity);
+}
+
+void
+LteSlRelayCandidateTable::SetCapacity(uint32_t capacity)
+{
+    NS_LOG_FUNCTION(this << capacity);
+    NS_ABORT_MSG_IF(capacity == 0, "The capacity of the Relay UE candidate table must be positive");
+    NS_ABORT_MSG_IF(!m_candidates.empty(), "Can't change the capacity of a non-empty table");
+    m_capacity = capacity;
+    m_candidates.reserve(capacity);
+    m_positions.reserve(capacity);
+}
+
+uint32_t
+LteSlRelayCandidateTable::GetCapacity() const
+{
+    return m_capacity;
+}
+
+void
+LteSlRelayCandidateTable::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    m_candidates.clear();
+    m_positions.clear();
+    m_ranking.clear();
+}
+
+bool
+LteSlRelayCandidateTable::Update(uint64_t relayId, double sdRsrp)
+{
+    NS_LOG_FUNCTION(this << relayId << sdRsrp);
+
+    auto it = m_positions.find(relayId);
+    if (it != m_positions.end())
+    {
+        Candidate& candidate = m_candidates[it->second];
+        m_ranking.erase(std::make_pair(candidate.sdRsrp, relayId));
+        candidate.sdRsrp = sdRsrp;
+        m_ranking.emplace(sdRsrp, relayId);
+        return true;
+    }
+
+    if (m_candidates.size() >= m_capacity)
+    {
+        // the weakest Relay UE is the last one of the ranking
+        const std::pair<double, uint64_t>& weakest = *m_ranking.rbegin();
+        if (sdRsrp <= weakest.first)
+        {
+            NS_LOG_LOGIC("Table full, discarding Relay UE ID " << relayId);
+            return false;
+        }
+        NS_LOG_LOGIC("Table full, Relay UE ID " << relayId << " replaces Relay UE ID "
+                                                << weakest.second);
+        Remove(weakest.second);
+    }
+    m_positions.emplace(relayId, m_candidates.size());
+    m_candidates.push_back({relayId, sdRsrp});
+    m_ranking.emplace(sdRsrp, relayId);
+    return true;
+}
+
+bool
+LteSlRelayCandidateTable::Remove(uint64_t relayId)
+{
+    NS_LOG_FUNCTION(this << relayId);
+
+    auto it = m_positions.find(relayId);
+    if (it == m_positions.end())
+    {
+        return false;
+    }
+    uint32_t position = it->second;
+    m_ranking.erase(std::make_pair(m_candidates[position].sdRsrp, relayId));
+    m_positions.erase(it);
+    if (position + 1 < m_candidates.size())
+    {
+        m_candidates[position] = m_candidates.back();
+        m_positions[m_candidates[position].relayId] = position;
+    }
+    m_candidates.pop_back();
+    return true;
+}
+
+bool
+LteSlRelayCandidateTable::Contains(uint64_t relayId) const
+{
+    return m_positions.find(relayId) != m_positions.end();
+}
+
+uint32_t
+LteSlRelayCandidateTable::GetSize() const
+{
+    return m_candidates.size();
+}
+
+bool
+LteSlRelayCandidateTable::IsEmpty() const
+{
+    return m_candidates.empty();
+}
+
+uint64_t
+LteSlRelayCandidateTable::GetRelayId(uint32_t index) const
+{
+    NS_ASSERT_MSG(index < m_candidates.size(), "Invalid Relay UE position " << index);
+    return m_candidates[index].relayId;
+}
+
+double
+LteSlRelayCandidateTable::GetSdRsrp(uint32_t index) const
+{
+    NS_ASSERT_MSG(index < m_candidates.size(), "Invalid Relay UE position " << index);
+    return m_candidates[index].sdRsrp;
+}
+
+uint64_t
+LteSlRelayCandidateTable::GetBestRelayId() const
+{
+    return m_ranking.empty() ? 0 : m_ranking.begin()->second;
+}
+
+} // namespace ns3
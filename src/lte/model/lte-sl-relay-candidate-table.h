@@ -0,0 +1,169 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#ifndef LTE_SL_RELAY_CANDIDATE_TABLE_H
+#define LTE_SL_RELAY_CANDIDATE_TABLE_H
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lte
+ *
+ * \brief Table of the Relay UEs which can be selected by a Remote UE for a
+ * relay service code, with their (L3 filtered) SD-RSRP
+ *
+ * The table has a fixed capacity: when it is full, a new Relay UE replaces
+ * the Relay UE with the weakest SD-RSRP if its own SD-RSRP is stronger, and
+ * is discarded otherwise. The Relay UEs are stored in insertion order, as
+ * long as no Relay UE is removed, so that a random Relay UE is picked in
+ * constant time by its position, and they are also ranked by SD-RSRP, so
+ * that the strongest one is found in constant time and updated in
+ * logarithmic time.
+ */
+class LteSlRelayCandidateTable
+{
+  public:
+    /**
+     * Constructor
+     * \param capacity the maximum number of Relay UEs of the table
+     */
+    explicit LteSlRelayCandidateTable(uint32_t capacity = 64);
+
+    /**
+     * Set the maximum number of Relay UEs of the table. The table must be empty.
+     * \param capacity the maximum number of Relay UEs
+     */
+    void SetCapacity(uint32_t capacity);
+
+    /**
+     * \return the maximum number of Relay UEs of the table
+     */
+    uint32_t GetCapacity() const;
+
+    /**
+     * Remove all the Relay UEs, keeping the memory allocated for them
+     */
+    void Clear();
+
+    /**
+     * Add a Relay UE, or update its SD-RSRP if it is already in the table
+     * \param relayId the Relay UE ID
+     * \param sdRsrp the SD-RSRP in dBm
+     * \return false if the table is full and all its Relay UEs have a stronger
+     *         SD-RSRP, in which case the Relay UE is not added
+     */
+    bool Update(uint64_t relayId, double sdRsrp);
+
+    /**
+     * Remove a Relay UE. The last Relay UE of the table takes its position.
+     * \param relayId the Relay UE ID
+     * \return true if the Relay UE was in the table
+     */
+    bool Remove(uint64_t relayId);
+
+    /**
+     * \param relayId the Relay UE ID
+     * \return true if the Relay UE is in the table
+     */
+    bool Contains(uint64_t relayId) const;
+
+    /**
+     * \return the number of Relay UEs of the table
+     */
+    uint32_t GetSize() const;
+
+    /**
+     * \return true if the table has no Relay UE
+     */
+    bool IsEmpty() const;
+
+    /**
+     * \param index the position of the Relay UE, lower than GetSize ()
+     * \return the ID of the Relay UE
+     */
+    uint64_t GetRelayId(uint32_t index) const;
+
+    /**
+     * \param index the position of the Relay UE, lower than GetSize ()
+     * \return the SD-RSRP of the Relay UE in dBm
+     */
+    double GetSdRsrp(uint32_t index) const;
+
+    /**
+     * Get the Relay UE with the strongest SD-RSRP. Among the Relay UEs with
+     * the same SD-RSRP, the one with the lowest ID is returned.
+     * \return the Relay UE ID, or zero if the table is empty
+     */
+    uint64_t GetBestRelayId() const;
+
+  private:
+    /// Relay UE of the table
+    struct Candidate
+    {
+        uint64_t relayId; ///< Relay UE ID
+        double sdRsrp;    ///< SD-RSRP in dBm
+    };
+
+    /// Order of the Relay UEs by decreasing SD-RSRP, then increasing ID
+    struct RankingCompare
+    {
+        /**
+         * \param a the first Relay UE, as a pair of SD-RSRP and ID
+         * \param b the second Relay UE, as a pair of SD-RSRP and ID
+         * \return true if a is ranked before b
+         */
+        bool operator()(const std::pair<double, uint64_t>& a,
+                        const std::pair<double, uint64_t>& b) const
+        {
+            return a.first > b.first || (a.first == b.first && a.second < b.second);
+        }
+    };
+
+    uint32_t m_capacity;                                ///< maximum number of Relay UEs
+    std::vector<Candidate> m_candidates;                ///< Relay UEs, by position
+    std::unordered_map<uint64_t, uint32_t> m_positions; ///< position of each Relay UE
+    std::set<std::pair<double, uint64_t>, RankingCompare>
+        m_ranking; ///< Relay UEs, by decreasing SD-RSRP
+};
+
+} // namespace ns3
+
+#endif /* LTE_SL_RELAY_CANDIDATE_TABLE_H */
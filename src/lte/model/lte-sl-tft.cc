@@ -38,6 +38,8 @@
 #include "ns3/abort.h"
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -222,4 +224,147 @@ LteSlTft::isTransmit()
     return m_direction != LteSlTft::RECEIVE;
 }
 
+bool
+LteSlTft::GetRemoteHostAddress(Ipv4Address& addr) const
+{
+    if (m_hasRemoteAddress && m_remoteMask == Ipv4Mask::GetOnes())
+    {
+        addr = m_remoteAddress;
+        return true;
+    }
+    return false;
+}
+
+bool
+LteSlTft::GetRemoteHostAddress(Ipv6Address& addr) const
+{
+    if (m_hasRemoteAddress && m_remoteMask6 == Ipv6Prefix::GetOnes())
+    {
+        addr = m_remoteAddress6;
+        return true;
+    }
+    return false;
+}
+
+void
+LteSlTftClassifier::Add(Ptr<LteSlTft> tft)
+{
+    NS_LOG_FUNCTION(this << tft);
+    m_tfts.push_back(tft);
+    Compile();
+}
+
+bool
+LteSlTftClassifier::Remove(Ptr<LteSlTft> tft)
+{
+    NS_LOG_FUNCTION(this << tft);
+    auto it = std::find(m_tfts.begin(), m_tfts.end(), tft);
+    if (it == m_tfts.end())
+    {
+        return false;
+    }
+    m_tfts.erase(it);
+    Compile();
+    return true;
+}
+
+std::list<Ptr<LteSlTft>>
+LteSlTftClassifier::RemoveGroup(uint32_t remoteL2)
+{
+    NS_LOG_FUNCTION(this << remoteL2);
+    std::list<Ptr<LteSlTft>> removed;
+    auto it = m_tfts.begin();
+    while (it != m_tfts.end())
+    {
+        if ((*it)->GetRemoteL2Address() == remoteL2)
+        {
+            removed.push_back(*it);
+            it = m_tfts.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+    if (!removed.empty())
+    {
+        Compile();
+    }
+    return removed;
+}
+
+Ptr<LteSlTft>
+LteSlTftClassifier::Classify(Ipv4Address la, Ipv4Address ra) const
+{
+    NS_LOG_FUNCTION(this << la << ra);
+    auto host = m_hosts.find(ra);
+    std::size_t found = host != m_hosts.end() ? host->second : m_tfts.size();
+    // a TFT matching a range of addresses takes precedence if it comes first
+    for (std::size_t i : m_ranges)
+    {
+        if (i > found)
+        {
+            break;
+        }
+        if (m_tfts[i]->Matches(la, ra))
+        {
+            return m_tfts[i];
+        }
+    }
+    return found < m_tfts.size() ? m_tfts[found] : nullptr;
+}
+
+Ptr<LteSlTft>
+LteSlTftClassifier::Classify(Ipv6Address la, Ipv6Address ra) const
+{
+    NS_LOG_FUNCTION(this << la << ra);
+    auto host = m_hosts6.find(ra);
+    std::size_t found = host != m_hosts6.end() ? host->second : m_tfts.size();
+    // a TFT matching a range of addresses takes precedence if it comes first
+    for (std::size_t i : m_ranges6)
+    {
+        if (i > found)
+        {
+            break;
+        }
+        if (m_tfts[i]->Matches(la, ra))
+        {
+            return m_tfts[i];
+        }
+    }
+    return found < m_tfts.size() ? m_tfts[found] : nullptr;
+}
+
+void
+LteSlTftClassifier::Compile()
+{
+    NS_LOG_FUNCTION(this);
+    m_hosts.clear();
+    m_hosts6.clear();
+    m_ranges.clear();
+    m_ranges6.clear();
+    for (std::size_t i = 0; i < m_tfts.size(); i++)
+    {
+        Ipv4Address addr;
+        if (m_tfts[i]->GetRemoteHostAddress(addr))
+        {
+            // keep the position of the first TFT for the address
+            m_hosts.emplace(addr, i);
+        }
+        else
+        {
+            m_ranges.push_back(i);
+        }
+        Ipv6Address addr6;
+        if (m_tfts[i]->GetRemoteHostAddress(addr6))
+        {
+            m_hosts6.emplace(addr6, i);
+        }
+        else
+        {
+            m_ranges6.push_back(i);
+        }
+    }
+}
+
 } // namespace ns3
@@ -41,6 +41,8 @@
 #include <ns3/simple-ref-count.h>
 
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -181,6 +183,22 @@ class LteSlTft : public SimpleRefCount<LteSlTft>
      */
     bool isTransmit();
 
+    /**
+     * Gets the IPv4 address of the remote host, if the TFT matches a single
+     * remote IPv4 address (i.e., its remote mask is /32)
+     * \param [out] addr the IPv4 address of the remote host
+     * \return true if the TFT matches a single remote IPv4 address
+     */
+    bool GetRemoteHostAddress(Ipv4Address& addr) const;
+
+    /**
+     * Gets the IPv6 address of the remote host, if the TFT matches a single
+     * remote IPv6 address (i.e., its remote prefix is /128)
+     * \param [out] addr the IPv6 address of the remote host
+     * \return true if the TFT matches a single remote IPv6 address
+     */
+    bool GetRemoteHostAddress(Ipv6Address& addr) const;
+
   private:
     Direction m_direction; ///< whether the filter needs to be applied
     ///< to sending or receiving only, or in both cases*/
@@ -199,6 +217,73 @@ class LteSlTft : public SimpleRefCount<LteSlTft>
     uint32_t m_remoteL2Address; ///< 24 bit MAC address of remote entity
 };
 
+/**
+ *
+ * \brief Classifier of outgoing packets among a list of sidelink TFTs.
+ *
+ * The classifier returns the first TFT of the list matching a packet, as a
+ * linear scan of the list with LteSlTft::Matches would do.  The TFTs matching
+ * a single remote address, i.e., one per group for group communication, are
+ * indexed by that address in a hash table, which is rebuilt whenever a TFT is
+ * added or removed.  A packet is thus classified with a single lookup, plus a
+ * check of the TFTs matching a range of addresses, if any, which come before
+ * the TFT found in the list.
+ *
+ */
+class LteSlTftClassifier
+{
+  public:
+    /**
+     * Add a TFT at the end of the list
+     * \param tft the TFT
+     */
+    void Add(Ptr<LteSlTft> tft);
+
+    /**
+     * Remove a TFT from the list
+     * \param tft the TFT
+     * \return true if the TFT was found in the list
+     */
+    bool Remove(Ptr<LteSlTft> tft);
+
+    /**
+     * Remove the TFTs associated with a group from the list
+     * \param remoteL2 the group layer 2 address
+     * \return the TFTs removed, in list order
+     */
+    std::list<Ptr<LteSlTft>> RemoveGroup(uint32_t remoteL2);
+
+    /**
+     * Find the first TFT of the list matching IPv4 addresses
+     * \param la the local address
+     * \param ra the remote address
+     * \return the TFT, or nullptr if no TFT matches
+     */
+    Ptr<LteSlTft> Classify(Ipv4Address la, Ipv4Address ra) const;
+
+    /**
+     * Find the first TFT of the list matching IPv6 addresses
+     * \param la the local address
+     * \param ra the remote address
+     * \return the TFT, or nullptr if no TFT matches
+     */
+    Ptr<LteSlTft> Classify(Ipv6Address la, Ipv6Address ra) const;
+
+  private:
+    /**
+     * Rebuild the indexes of the TFTs of the list
+     */
+    void Compile();
+
+    std::vector<Ptr<LteSlTft>> m_tfts; ///< TFTs, in list order
+    std::unordered_map<Ipv4Address, std::size_t, Ipv4AddressHash>
+        m_hosts; ///< position of the first TFT matching a single remote IPv4 address
+    std::unordered_map<Ipv6Address, std::size_t, Ipv6AddressHash>
+        m_hosts6; ///< position of the first TFT matching a single remote IPv6 address
+    std::vector<std::size_t> m_ranges;  ///< positions of the other TFTs, for IPv4
+    std::vector<std::size_t> m_ranges6; ///< positions of the other TFTs, for IPv6
+};
+
 } // namespace ns3
 
 #endif /* LTE_SL_TFT_H */
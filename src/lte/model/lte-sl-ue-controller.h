@@ -37,6 +37,7 @@
 #define LTE_SL_UE_CONTROLLER_H
 
 #include "lte-sl-o2o-comm-params.h"
+#include "lte-sl-relay-candidate-table.h"
 #include "lte-sl-ue-rrc.h"
 
 #include <ns3/object.h>
@@ -159,7 +160,7 @@ class LteSlUeController : public Object
      * to which the UE is currently connected for the service code (Zero if none) \return
      * selectedRelayId the Id of the selected Realy UE
      */
-    virtual uint64_t DoRelayUeSelection(std::map<uint64_t, double> validRelays,
+    virtual uint64_t DoRelayUeSelection(const LteSlRelayCandidateTable& validRelays,
                                         uint32_t serviceCode,
                                         uint64_t currentRelayId) = 0;
 
@@ -37,6 +37,7 @@
 #define LTE_SL_UE_CTRL_SAP_H
 
 #include "lte-sl-o2o-comm-params.h"
+#include "lte-sl-relay-candidate-table.h"
 #include "lte-sl-ue-rrc.h"
 
 #include <ns3/object.h>
@@ -134,7 +135,7 @@ class LteSlUeCtrlSapProvider
      *
      * \return selectedRelayId the Id of the selected Realy UE
      */
-    virtual uint64_t RelayUeSelection(std::map<uint64_t, double> validRelays,
+    virtual uint64_t RelayUeSelection(const LteSlRelayCandidateTable& validRelays,
                                       uint32_t serviceCode,
                                       uint64_t currentRelayId) = 0;
 
@@ -189,7 +190,7 @@ class MemberLteSlUeCtrlSapProvider : public LteSlUeCtrlSapProvider
                               LteSlUeRrc::RelayRole role,
                               LteSlO2oCommParams::UeO2ORejectReason reason) override;
     void RecvRemoteUeReport(uint64_t localImsi, uint32_t peerUeId, uint64_t remoteImsi) override;
-    uint64_t RelayUeSelection(std::map<uint64_t, double> validRelays,
+    uint64_t RelayUeSelection(const LteSlRelayCandidateTable& validRelays,
                               uint32_t serviceCode,
                               uint64_t currentRelayId) override;
 
@@ -266,7 +267,7 @@ MemberLteSlUeCtrlSapProvider<C>::RecvRemoteUeReport(uint64_t localImsi,
 
 template <class C>
 uint64_t
-MemberLteSlUeCtrlSapProvider<C>::RelayUeSelection(std::map<uint64_t, double> validRelays,
+MemberLteSlUeCtrlSapProvider<C>::RelayUeSelection(const LteSlRelayCandidateTable& validRelays,
                                                   uint32_t serviceCode,
                                                   uint64_t currentRelayId)
 {
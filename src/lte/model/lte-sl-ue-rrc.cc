@@ -49,6 +49,7 @@
 #include <ns3/object-map.h>
 #include <ns3/pointer.h>
 #include <ns3/simulator.h>
+#include <ns3/uinteger.h>
 
 #include <algorithm>
 
@@ -86,6 +87,14 @@ LteSlUeRrc::GetTypeId()
                           BooleanValue(false),
                           MakeBooleanAccessor(&LteSlUeRrc::m_isRuirqEnabled),
                           MakeBooleanChecker())
+            .AddAttribute("RelayCandidateTableCapacity",
+                          "Maximum number of valid Relay UEs passed to the Relay UE (re)selection "
+                          "algorithm for a service code. When more Relay UEs are valid, the ones "
+                          "with the strongest SD-RSRP are kept",
+                          UintegerValue(64),
+                          MakeUintegerAccessor(&LteSlUeRrc::SetRelayCandidateTableCapacity,
+                                               &LteSlUeRrc::GetRelayCandidateTableCapacity),
+                          MakeUintegerChecker<uint32_t>(1))
             .AddTraceSource("PC5SignalingPacketTrace",
                             "The PC5 Signaling Packet Trace",
                             MakeTraceSourceAccessor(&LteSlUeRrc::m_pc5SignalingPacketTrace),
@@ -378,10 +387,10 @@ LteSlUeRrc::GetSidelinkRadioBearer(uint32_t src, uint32_t group)
     auto srcIt = m_slrbMap.find(src);
     if (srcIt != m_slrbMap.end())
     {
-        auto srcIt2 = (*srcIt).second.find(group);
-        if (srcIt2 != (*srcIt).second.end())
+        auto groupIt = srcIt->second.find(group);
+        if (groupIt != srcIt->second.end() && !groupIt->second.empty())
         {
-            slrb = *(m_slrbMap[src][group].begin());
+            slrb = groupIt->second.front();
         }
     }
     return slrb;
@@ -407,6 +416,7 @@ LteSlUeRrc::StartDiscoveryApps(std::list<uint32_t> appCodes, DiscoveryRole role)
         NS_LOG_DEBUG("Adding app code");
         m_appServicesMap.insert(std::pair<uint32_t, AppServiceInfo>(*it, info));
     }
+    UpdateMonitoredDiscoveryMessages();
 }
 
 void
@@ -425,6 +435,7 @@ LteSlUeRrc::StopDiscoveryApps(std::list<uint32_t> appCodes, DiscoveryRole role)
             break;
         }
     }
+    UpdateMonitoredDiscoveryMessages();
 }
 
 bool
@@ -460,6 +471,60 @@ LteSlUeRrc::IsAnnouncingApp(uint32_t appCode)
     return false;
 }
 
+bool
+LteSlUeRrc::IsMonitoringDiscoveryMessage(uint8_t msgType, uint32_t code) const
+{
+    return m_monitoredDiscoveryMessages.find((static_cast<uint64_t>(msgType) << 32) | code) !=
+           m_monitoredDiscoveryMessages.end();
+}
+
+void
+LteSlUeRrc::UpdateMonitoredDiscoveryMessages()
+{
+    NS_LOG_FUNCTION(this);
+    // same rules as IsMonitoringApp and IsMonitoringRelayServiceCode
+    m_monitoredDiscoveryMessages.clear();
+    for (const auto& app : m_appServicesMap)
+    {
+        uint64_t msgType;
+        switch (app.second.role)
+        {
+        case Monitoring:
+            msgType = LteSlDiscHeader::DISC_OPEN_ANNOUNCEMENT;
+            break;
+        case Discoveree:
+            msgType = LteSlDiscHeader::DISC_RESTRICTED_QUERY;
+            break;
+        case Discoverer:
+            msgType = LteSlDiscHeader::DISC_RESTRICTED_RESPONSE;
+            break;
+        default:
+            // an announcing UE does not monitor
+            continue;
+        }
+        m_monitoredDiscoveryMessages.insert((msgType << 32) | app.first);
+    }
+    for (const auto& service : m_relayServicesMap)
+    {
+        uint64_t msgType;
+        if (service.second.role == RemoteUE)
+        {
+            msgType = service.second.model == ModelA ? LteSlDiscHeader::DISC_RELAY_ANNOUNCEMENT
+                                                     : LteSlDiscHeader::DISC_RELAY_RESPONSE;
+        }
+        else if (service.second.model == ModelB)
+        {
+            msgType = LteSlDiscHeader::DISC_RELAY_SOLICITATION;
+        }
+        else
+        {
+            // a relay UE in model A only announces
+            continue;
+        }
+        m_monitoredDiscoveryMessages.insert((msgType << 32) | service.first);
+    }
+}
+
 void
 LteSlUeRrc::RecvApplicationServiceDiscovery(uint8_t msgType, uint32_t appCode)
 {
@@ -657,6 +722,7 @@ LteSlUeRrc::StartRelayService(uint32_t serviceCode,
     info.lastRspTimestamp = Seconds(0);
 
     m_relayServicesMap.insert(std::pair<uint32_t, RelayServiceInfo>(serviceCode, info));
+    UpdateMonitoredDiscoveryMessages();
 }
 
 void
@@ -673,6 +739,7 @@ LteSlUeRrc::StopRelayService(uint32_t serviceCode)
             it->second.txTimer.Cancel();
         }
         m_relayServicesMap.erase(it);
+        UpdateMonitoredDiscoveryMessages();
     }
 
     // The following code is used to implement "Rx Upper, Tx DCR" type scenarios in the One-to-One
@@ -2187,7 +2254,21 @@ LteSlUeRrc::AssignStreams(int64_t stream)
 }
 
 void
-LteSlUeRrc::RelayUeSelection(std::map<std::pair<uint64_t, uint32_t>, double> validRelays)
+LteSlUeRrc::SetRelayCandidateTableCapacity(uint32_t capacity)
+{
+    NS_LOG_FUNCTION(this << capacity);
+    m_relayCandidates.Clear();
+    m_relayCandidates.SetCapacity(capacity);
+}
+
+uint32_t
+LteSlUeRrc::GetRelayCandidateTableCapacity() const
+{
+    return m_relayCandidates.GetCapacity();
+}
+
+void
+LteSlUeRrc::RelayUeSelection(const std::map<std::pair<uint64_t, uint32_t>, double>& validRelays)
 {
     NS_LOG_FUNCTION(this << m_sourceL2Id);
 
@@ -2254,18 +2335,16 @@ LteSlUeRrc::RelayUeSelection(std::map<std::pair<uint64_t, uint32_t>, double> val
             //- return: the Relay ID of the selected Relay,
             //        (Relay ID = Zero if not suitable relay available)
             uint64_t selectedRelayId = 0;
-            std::map<uint64_t, double> validRelaysForSc;
-            std::map<std::pair<uint64_t, uint32_t>, double>::iterator vaReIt;
-            for (vaReIt = validRelays.begin(); vaReIt != validRelays.end(); vaReIt++)
+            m_relayCandidates.Clear();
+            for (const auto& validRelay : validRelays)
             {
-                if (vaReIt->first.second == serviceCode)
+                if (validRelay.first.second == serviceCode)
                 {
-                    validRelaysForSc.insert(
-                        std::pair<uint64_t, double>(vaReIt->first.first, vaReIt->second));
+                    m_relayCandidates.Update(validRelay.first.first, validRelay.second);
                 }
             }
 
-            selectedRelayId = m_slUeCtrlSapProvider->RelayUeSelection(validRelaysForSc,
+            selectedRelayId = m_slUeCtrlSapProvider->RelayUeSelection(m_relayCandidates,
                                                                       serviceCode,
                                                                       currentRelayId);
 
@@ -41,6 +41,7 @@
 #include "lte-sl-header.h"
 #include "lte-sl-o2o-comm-params.h"
 #include "lte-sl-pool.h"
+#include "lte-sl-relay-candidate-table.h"
 
 #include <ns3/event-id.h>
 #include <ns3/nstime.h>
@@ -50,6 +51,7 @@
 
 #include <map>
 #include <set>
+#include <unordered_set>
 #include <vector>
 
 namespace ns3
@@ -355,6 +357,17 @@ class LteSlUeRrc : public Object
      */
     bool IsAnnouncingApp(uint32_t appCode);
 
+    /**
+     * Checks if a discovery message must be processed, i.e., if
+     * IsMonitoringApp or IsMonitoringRelayServiceCode would accept it, with
+     * a single lookup in the set of the monitored message types and codes
+     * \param msgType The message type
+     * \param code The application code or the relay service code, depending
+     *        on the message type
+     * \return true if the UE is monitoring for this message type and code
+     */
+    bool IsMonitoringDiscoveryMessage(uint8_t msgType, uint32_t code) const;
+
     /**
      * Set active discovery pool
      * \param pool transmission pool
@@ -426,7 +439,7 @@ class LteSlUeRrc : public Object
      * \param validRelays the list of valid detected Relay UEs and their respective SD-RSRP values
      * indexed by the Relay UE Ids and the service code
      */
-    void RelayUeSelection(std::map<std::pair<uint64_t, uint32_t>, double> validRelays);
+    void RelayUeSelection(const std::map<std::pair<uint64_t, uint32_t>, double>& validRelays);
 
   protected:
     /**
@@ -661,6 +674,12 @@ class LteSlUeRrc : public Object
     int64_t AssignStreams(int64_t stream);
 
   private:
+    /**
+     * Rebuild the set of the monitored discovery message types and codes
+     * from the application and relay services
+     */
+    void UpdateMonitoredDiscoveryMessages();
+
     /**
      * Reference to the RRC layer
      */
@@ -715,6 +734,11 @@ class LteSlUeRrc : public Object
      * list of relay services used by this device
      */
     std::map<uint32_t, RelayServiceInfo> m_relayServicesMap;
+    /**
+     * Monitored discovery messages, each one identified by its message type
+     * (upper 32 bits) and its application or relay service code (lower 32 bits)
+     */
+    std::unordered_set<uint64_t> m_monitoredDiscoveryMessages;
     /**
      * Active Tx pool for discovery
      */
@@ -774,6 +798,25 @@ class LteSlUeRrc : public Object
      */
     bool m_isRuirqEnabled;
 
+    /**
+     * Valid Relay UEs offering the service code being evaluated by the Relay UE
+     * (re)selection, reused for each measurement report
+     */
+    LteSlRelayCandidateTable m_relayCandidates;
+
+    /**
+     * Set the maximum number of valid Relay UEs passed to the Relay UE
+     * (re)selection algorithm for a service code
+     * \param capacity the maximum number of Relay UEs
+     */
+    void SetRelayCandidateTableCapacity(uint32_t capacity);
+
+    /**
+     * \return the maximum number of valid Relay UEs passed to the Relay UE
+     * (re)selection algorithm for a service code
+     */
+    uint32_t GetRelayCandidateTableCapacity() const;
+
     LteSlUeCtrlSapUser* m_slUeCtrlSapUser;         ///< Controller SAP user
     LteSlUeCtrlSapProvider* m_slUeCtrlSapProvider; ///< Controller SAP provider
 
@@ -405,6 +405,13 @@ LteSpectrumPhy::GetTypeId()
                           EnumValue(LteNistErrorModel::AWGN),
                           MakeEnumAccessor(&LteSpectrumPhy::m_fadingModel),
                           MakeEnumChecker(LteNistErrorModel::AWGN, "AWGN"))
+            .AddAttribute("SlFadingTraceBank",
+                          "The fading trace bank applied to the SINR of the Sidelink "
+                          "transport blocks, which can be shared by all the PHYs; no "
+                          "fading is applied if not set.",
+                          PointerValue(),
+                          MakePointerAccessor(&LteSpectrumPhy::m_slFadingTraceBank),
+                          MakePointerChecker<LteSlFadingTraceBank>())
             .AddAttribute("HalfDuplexPhy",
                           "A pointer to a UL LteSpectrumPhy object",
                           PointerValue(),
@@ -2328,8 +2335,7 @@ LteSpectrumPhy::RxSlPscch(std::vector<uint32_t> pktIndexes)
                 errorRate = LteNistErrorModel::GetPscchBler(
                                 m_fadingModel,
                                 LteNistErrorModel::SISO,
-                                GetMeanSinr(m_slSinrPerceived[pktIndex] * m_slRxGain,
-                                            m_rxPacketInfo.at(pktIndex).rbBitmap))
+                                GetSlMeanSinr(pktIndex, m_rxPacketInfo.at(pktIndex).rbBitmap))
                                 .tbler;
                 corrupt = !(m_random->GetValue() > errorRate);
                 NS_LOG_DEBUG(this << " PSCCH Decoding, errorRate " << errorRate << " error "
@@ -2497,17 +2503,17 @@ LteSpectrumPhy::RxSlPssch(std::vector<uint32_t> pktIndexes)
         // avoid to check for errors and collisions when there is no actual data transmitted
         if ((!m_rxPacketInfo.empty()) && (itSinr != expectedTbToSinrIndex.end()))
         {
-            HarqProcessInfoList_t harqInfoList;
+            // retrieve HARQ info, without copying it
+            static const HarqProcessInfoList_t noHarqInfo;
+            const HarqProcessInfoList_t& harqInfoList =
+                m_slDataErrorModelEnabled && (*itTb).second.ndi == 0
+                    ? m_slHarqPhyModule->GetHarqProcessInfoSl((*itTb).first.m_rnti,
+                                                              (*itTb).first.m_l1dst)
+                    : noHarqInfo;
             bool rbCollided = false;
             if (m_slDataErrorModelEnabled)
             {
-                // retrieve HARQ info
-                if ((*itTb).second.ndi == 0)
-                {
-                    harqInfoList = m_slHarqPhyModule->GetHarqProcessInfoSl((*itTb).first.m_rnti,
-                                                                           (*itTb).first.m_l1dst);
-                    NS_LOG_DEBUG("Nb Retx=" << harqInfoList.size());
-                }
+                NS_LOG_DEBUG("Nb Retx=" << harqInfoList.size());
 
                 NS_LOG_DEBUG("Time: " << Simulator::Now().GetMilliSeconds()
                                       << "msec From: " << (*itTb).first.m_rnti
@@ -2537,8 +2543,7 @@ LteSpectrumPhy::RxSlPssch(std::vector<uint32_t> pktIndexes)
                     m_fadingModel,
                     LteNistErrorModel::SISO,
                     (*itTb).second.mcs,
-                    GetMeanSinr(m_slSinrPerceived[(*itSinr).second] * m_slRxGain,
-                                (*itTb).second.rbBitmap),
+                    GetSlMeanSinr((*itSinr).second, (*itTb).second.rbBitmap),
                     harqInfoList);
                 (*itTb).second.sinr = tbStats.sinr;
                 if (!rbCollided)
@@ -2609,8 +2614,7 @@ LteSpectrumPhy::RxSlPssch(std::vector<uint32_t> pktIndexes)
             params.m_ndi = (*itTb).second.ndi;
             params.m_ccId = m_componentCarrierId;
             params.m_correctness = (uint8_t) !(*itTb).second.corrupt;
-            params.m_sinrPerRb = GetMeanSinr(m_slSinrPerceived[(*itSinr).second] * m_slRxGain,
-                                             (*itTb).second.rbBitmap);
+            params.m_sinrPerRb = GetSlMeanSinr((*itSinr).second, (*itTb).second.rbBitmap);
             m_slPhyReception(params);
         }
 
@@ -2779,7 +2783,6 @@ LteSpectrumPhy::RxSlPsdch(std::vector<uint32_t> pktIndexes)
 
     std::list<Ptr<Packet>> rxDiscMessageOkList;
     auto itTbDisc = m_expectedDiscTbs.begin();
-    HarqProcessInfoList_t harqInfoList;
 
     for (auto it = sortedDiscMessages.begin(); it != sortedDiscMessages.end(); it++)
     {
@@ -2803,14 +2806,12 @@ LteSpectrumPhy::RxSlPsdch(std::vector<uint32_t> pktIndexes)
         // avoid to check for errors when error model is not enabled
         if (m_slDiscoveryErrorModelEnabled)
         {
-            // retrieve HARQ info
-            if ((*itTbDisc).second.ndi == 0)
-            {
-                harqInfoList =
-                    m_slHarqPhyModule->GetHarqProcessInfoDisc((*itTbDisc).first.m_rnti,
-                                                              (*itTbDisc).first.m_resPsdch);
-                NS_LOG_DEBUG(this << " Number of Retx =" << harqInfoList.size());
-            }
+            // retrieve HARQ info, without copying it
+            const HarqProcessInfoList_t& harqInfoList =
+                m_slHarqPhyModule->GetHarqProcessInfoDisc((*itTbDisc).first.m_rnti,
+                                                          (*itTbDisc).first.m_resPsdch,
+                                                          (*itTbDisc).second.ndi);
+            NS_LOG_DEBUG(this << " Number of Retx =" << harqInfoList.size());
 
             // Check if any of the RBs in this TB have been collided
             for (auto rbIt = (*itTbDisc).second.rbBitmap.begin();
@@ -2839,8 +2840,7 @@ LteSpectrumPhy::RxSlPsdch(std::vector<uint32_t> pktIndexes)
             TbErrorStats_t tbStats = LteNistErrorModel::GetPsdchBler(
                 m_fadingModel,
                 LteNistErrorModel::SISO,
-                GetMeanSinr(m_slSinrPerceived[(*itTbDisc).second.index] * m_slRxGain,
-                            (*itTbDisc).second.rbBitmap),
+                GetSlMeanSinr((*itTbDisc).second.index, (*itTbDisc).second.rbBitmap),
                 harqInfoList);
             (*itTbDisc).second.sinr = tbStats.sinr;
 
@@ -2983,8 +2983,7 @@ LteSpectrumPhy::RxSlPsdch(std::vector<uint32_t> pktIndexes)
         prsparams.m_ccId = m_componentCarrierId;
         prsparams.m_correctness = (uint8_t) !(*itTbDisc).second.corrupt;
         prsparams.m_sinrPerRb =
-            GetMeanSinr(m_slSinrPerceived[(*itTbDisc).second.index] * m_slRxGain,
-                        (*itTbDisc).second.rbBitmap);
+            GetSlMeanSinr((*itTbDisc).second.index, (*itTbDisc).second.rbBitmap);
         prsparams.m_rv = (*itTbDisc).second.rv;
         m_slPhyReception(prsparams);
     }
@@ -3138,8 +3137,7 @@ LteSpectrumPhy::RxSlPsbch(std::vector<uint32_t> pktIndexes)
                 errorRate = LteNistErrorModel::GetPsbchBler(
                                 m_fadingModel,
                                 LteNistErrorModel::SISO,
-                                GetMeanSinr(m_slSinrPerceived[pktIndex] * m_slRxGain,
-                                            m_rxPacketInfo[pktIndex].rbBitmap))
+                                GetSlMeanSinr(pktIndex, m_rxPacketInfo[pktIndex].rbBitmap))
                                 .tbler;
                 corrupt = !(m_random->GetValue() > errorRate);
                 NS_LOG_DEBUG(this << " PSBCH Decoding, errorRate " << errorRate << " error "
@@ -3195,8 +3193,7 @@ LteSpectrumPhy::RxSlPsbch(std::vector<uint32_t> pktIndexes)
         prsparams.m_ndi = 1;
         prsparams.m_ccId = m_componentCarrierId;
         prsparams.m_correctness = !corrupt;
-        prsparams.m_sinrPerRb = GetMeanSinr(m_slSinrPerceived[pktIndex] * m_slRxGain,
-                                            m_rxPacketInfo.at(pktIndex).rbBitmap);
+        prsparams.m_sinrPerRb = GetSlMeanSinr(pktIndex, m_rxPacketInfo.at(pktIndex).rbBitmap);
         m_slPhyReception(prsparams);
     }
 
@@ -3404,6 +3401,38 @@ LteSpectrumPhy::GetMeanSinr(const SpectrumValue& sinr, const std::vector<int>& m
     return sinrLin / map.size();
 }
 
+double
+LteSpectrumPhy::GetSlMeanSinr(uint32_t pktIndex, const std::vector<int>& map)
+{
+    NS_LOG_FUNCTION(this << pktIndex);
+    if (!m_slFadingTraceBank)
+    {
+        return GetMeanSinr(m_slSinrPerceived[pktIndex] * m_slRxGain, map);
+    }
+
+    // the link is identified by the IDs of the transmitting and receiving nodes
+    uint64_t linkId = 0;
+    Ptr<SpectrumPhy> txPhy = m_rxPacketInfo.at(pktIndex).params->txPhy;
+    if (txPhy && txPhy->GetDevice())
+    {
+        linkId = static_cast<uint64_t>(txPhy->GetDevice()->GetNode()->GetId()) << 32;
+    }
+    if (m_device)
+    {
+        linkId |= m_device->GetNode()->GetId();
+    }
+    const float* gains = m_slFadingTraceBank->GetGains(linkId);
+    const SpectrumValue& sinr = m_slSinrPerceived[pktIndex];
+    double sinrLin = 0;
+    for (int rb : map)
+    {
+        NS_ASSERT_MSG(static_cast<uint32_t>(rb) < m_slFadingTraceBank->GetRbNum(),
+                      "RB " << rb << " not in the fading trace");
+        sinrLin += sinr[rb] * m_slRxGain * gains[rb];
+    }
+    return sinrLin / map.size();
+}
+
 LteSpectrumPhy::State
 LteSpectrumPhy::GetState()
 {
@@ -3442,6 +3471,12 @@ LteSpectrumPhy::SetSlRxGain(double gain)
     m_slRxGain = gain;
 }
 
+Ptr<LteSlFadingTraceBank>
+LteSpectrumPhy::GetSlFadingTraceBank() const
+{
+    return m_slFadingTraceBank;
+}
+
 int64_t
 LteSpectrumPhy::AssignStreams(int64_t stream)
 {
@@ -28,6 +28,7 @@
 #include "lte-harq-phy.h"
 #include "lte-interference.h"
 #include "lte-nist-error-model.h"
+#include "lte-sl-fading-trace-bank.h"
 #include "lte-sl-harq-phy.h"
 #include "lte-sl-interference.h"
 #include "lte-sl-pool.h"
@@ -860,6 +861,15 @@ class LteSpectrumPhy : public SpectrumPhy
      */
     int64_t AssignStreams(int64_t stream);
 
+    /**
+     * Get the Sidelink fading trace bank, whose random variable stream is
+     * not assigned by AssignStreams, since the bank is usually shared by
+     * all the PHYs
+     *
+     * \return The Sidelink fading trace bank, or nullptr if none is set
+     */
+    Ptr<LteSlFadingTraceBank> GetSlFadingTraceBank() const;
+
     /**
      *
      * \return The state of the PHY
@@ -942,6 +952,17 @@ class LteSpectrumPhy : public SpectrumPhy
      */
     double GetMeanSinr(const SpectrumValue& sinr, const std::vector<int>& rbBitMap);
 
+    /**
+     * \brief Get the mean SINR of a received Sidelink transport block, including
+     * the Sidelink Rx gain and, if a fading trace bank is set, the fading of
+     * the link on each RB
+     *
+     * \param pktIndex The index of the packet in the reception buffer
+     * \param rbBitMap The vector whose size is equal to the number active RBs
+     * \return The average SINR per RB in linear scale
+     */
+    double GetSlMeanSinr(uint32_t pktIndex, const std::vector<int>& rbBitMap);
+
     /**
      * \brief Process received PSCCH messages function
      * \param pktIndexes Indexes of PSCCH messages received
@@ -1069,6 +1090,7 @@ class LteSpectrumPhy : public SpectrumPhy
     uint64_t m_slssId; ///< the Sidelink Synchronization Signal Identifier (SLSSID)
 
     double m_slRxGain; ///< Sidelink Rx gain (Linear units)
+    Ptr<LteSlFadingTraceBank> m_slFadingTraceBank; ///< Sidelink fading trace bank, if any
     std::map<uint16_t, uint16_t>
         m_slDiscTxCount; ///< Map to store the count of discovery transmissions
     ///< by a UE. The RNTI of a UE is used as the key of this map
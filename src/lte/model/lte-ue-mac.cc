@@ -1481,22 +1481,22 @@ LteUeMac::DoReceiveSlSciPhyPdu(Ptr<Packet> p)
                 (*poolIt)->GetCurrentScPeriod(m_slSchedTime.frameNo - 1,
                                               m_slSchedTime.subframeNo - 1);
 
-            std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo> psschTx =
-                (*poolIt)->GetPsschTransmissions(tmp,
-                                                 sciHeader.GetTrp(),
-                                                 sciHeader.GetRbStart(),
-                                                 sciHeader.GetRbLen());
-            std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo>::iterator rxIt;
-            for (rxIt = psschTx.begin(); rxIt != psschTx.end(); rxIt++)
+            // the transmissions are cached by the pool for the period, and are not copied
+            const std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>& psschTx =
+                (*poolIt)->GetCachedPsschTransmissions(tmp,
+                                                       sciHeader.GetTrp(),
+                                                       sciHeader.GetRbStart(),
+                                                       sciHeader.GetRbLen());
+            for (const auto& rx : psschTx)
             {
                 // adjust for index starting at 1
-                rxIt->subframe.frameNo++;
-                rxIt->subframe.subframeNo++;
-                NS_LOG_INFO("Subframe Rx " << rxIt->subframe.frameNo << "/"
-                                           << rxIt->subframe.subframeNo);
-                if (m_slSchedTime < rxIt->subframe)
+                SidelinkCommResourcePool::SubframeInfo subframe = rx.subframe;
+                subframe.frameNo++;
+                subframe.subframeNo++;
+                NS_LOG_INFO("Subframe Rx " << subframe.frameNo << "/" << subframe.subframeNo);
+                if (m_slSchedTime < subframe)
                 {
-                    m_psschRxSet.insert(rxIt->subframe);
+                    m_psschRxSet.insert(subframe);
                 }
                 else
                 {
@@ -2754,7 +2754,7 @@ LteUeMac::GetSlUeSelectedGrant(std::list<PoolInfo>::iterator poolIt)
                     if (!ktrpMcsPrbInfoPair.second.empty())
                     {
                         noAvailablePairForTbs = false;
-                        kMcsPrbPairList.push_back(ktrpMcsPrbInfoPair);
+                        kMcsPrbPairList.push_back(std::move(ktrpMcsPrbInfoPair));
                     }
                 }
             }
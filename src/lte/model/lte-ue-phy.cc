@@ -46,8 +46,10 @@
 #include <ns3/pointer.h>
 #include <ns3/simulator.h>
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <tuple>
 
 namespace ns3
 {
@@ -784,15 +786,17 @@ LteUePhy::PhyPsbchPduReceived(Ptr<Packet> p, uint16_t slssid)
     // Store the received MIB-SL during the SyncRef search
     if (m_ueSlssScanningInProgress)
     {
-        MasterInformationBlockSlHeader mibSlHeader;
-        p->PeekHeader(mibSlHeader);
-        LteRrcSap::MasterInformationBlockSL mibSl = mibSlHeader.GetMessage();
-
         uint16_t rxOffset = Simulator::Now().GetMilliSeconds() % 40;
-        m_detectedMibSl.insert(
-            std::pair<std::pair<uint16_t, uint16_t>, LteRrcSap::MasterInformationBlockSL>(
-                std::pair<uint16_t, uint16_t>(slssid, rxOffset),
-                mibSl));
+        uint32_t syncRefId = GetSyncRefId(slssid, rxOffset);
+        if (m_detectedMibSl.insert(syncRefId).second)
+        {
+            // The SyncRef is detected if its S-RSRP was already measured
+            auto it = m_ueSlssScanningSrsrp.find(syncRefId);
+            if (it != m_ueSlssScanningSrsrp.end())
+            {
+                DetectSyncRef(slssid, rxOffset, it->second);
+            }
+        }
     }
 
     // Pass the message to the RRC
@@ -2681,50 +2685,50 @@ LteUePhy::ReceiveSlss(uint16_t slssid, Ptr<SpectrumValue> p)
         // Note that a SyncRef is identified by SLSSID and reception offset.
         // SLSSs coming from different UEs, but having the same SyncRef info (same SLSSID and
         // reception offset) are considered as different S-RSRP samples of the same SyncRef
-        auto itMeasMap =
-            m_ueSlssMeasurementsMap.find(std::pair<uint16_t, uint16_t>(slssid, offset));
+        auto itMeas = std::find_if(m_ueSlssMeasurements.begin(),
+                                   m_ueSlssMeasurements.end(),
+                                   [slssid, offset](const UeSlssMeasurementsElement& el) {
+                                       return el.slssid == slssid && el.offset == offset;
+                                   });
 
-        if (itMeasMap == m_ueSlssMeasurementsMap.end()) // First entry
+        if (itMeas != m_ueSlssMeasurements.end())
         {
-            UeSlssMeasurementsElement newEl;
-            newEl.srsrpSum = s_rsrp_W;
-            newEl.srsrpNum = 1;
+            NS_LOG_LOGIC("Measurement entry found... Adding values");
 
-            if (m_ueSlssScanningInProgress)
+            itMeas->srsrpSum += s_rsrp_W;
+            itMeas->srsrpNum++;
+        }
+        else if (m_ueSlssScanningInProgress)
+        {
+            // Only the first sample of each SyncRef is kept during the scanning
+            uint32_t syncRefId = GetSyncRefId(slssid, offset);
+            if (m_ueSlssScanningSrsrp.emplace(syncRefId, s_rsrp_W).second)
             {
                 NS_LOG_LOGIC("SyncRef scan in progress, first detected entry");
-                m_ueSlssDetectionMap.insert(
-                    std::pair<std::pair<uint16_t, uint16_t>, UeSlssMeasurementsElement>(
-                        std::pair<uint16_t, uint16_t>(slssid, offset),
-                        newEl));
-            }
-            else if (m_ueSlssMeasurementInProgress)
-            {
-                NS_LOG_LOGIC("S-RSRP measurement in progress, first measurement entry");
-                // Insert new measurement only if it was already detected
-                auto itDetectionMap =
-                    m_ueSlssDetectionMap.find(std::pair<uint16_t, uint16_t>(slssid, offset));
-                if (itDetectionMap != m_ueSlssDetectionMap.end())
+                if (m_detectedMibSl.find(syncRefId) != m_detectedMibSl.end())
                 {
-                    NS_LOG_LOGIC("SyncRef already detected, storing measurement");
-                    m_ueSlssMeasurementsMap.insert(
-                        std::pair<std::pair<uint16_t, uint16_t>, UeSlssMeasurementsElement>(
-                            std::pair<uint16_t, uint16_t>(slssid, offset),
-                            newEl));
-                }
-                else
-                {
-                    NS_LOG_LOGIC(
-                        "SyncRef was not detected during SyncRef search/scanning... Ignoring");
+                    DetectSyncRef(slssid, offset, s_rsrp_W);
                 }
             }
         }
-        else
+        else if (m_ueSlssMeasurementInProgress)
         {
-            NS_LOG_LOGIC("Measurement entry found... Adding values");
-
-            (*itMeasMap).second.srsrpSum += s_rsrp_W;
-            (*itMeasMap).second.srsrpNum++;
+            NS_LOG_LOGIC("S-RSRP measurement in progress, first measurement entry");
+            // Insert new measurement only if it was already detected
+            auto itDetected = std::find_if(m_ueSlssDetected.begin(),
+                                           m_ueSlssDetected.end(),
+                                           [slssid, offset](const UeSlssMeasurementsElement& el) {
+                                               return el.slssid == slssid && el.offset == offset;
+                                           });
+            if (itDetected != m_ueSlssDetected.end())
+            {
+                NS_LOG_LOGIC("SyncRef already detected, storing measurement");
+                m_ueSlssMeasurements.push_back({slssid, offset, s_rsrp_W, 1});
+            }
+            else
+            {
+                NS_LOG_LOGIC("SyncRef was not detected during SyncRef search/scanning... Ignoring");
+            }
         }
     }
     else
@@ -2754,103 +2758,92 @@ LteUePhy::StartSlssScanning()
     NS_LOG_FUNCTION(this);
     m_ueSlssScanningInProgress = true;
     m_detectedMibSl.clear();
+    m_ueSlssScanningSrsrp.clear();
+    m_ueSlssDetected.clear();
+    m_ueSlssDetected.reserve(MAX_DETECTED_SYNC_REFS);
     Simulator::Schedule(m_ueSlssScanningPeriod, &LteUePhy::EndSlssScanning, this);
 }
 
+uint32_t
+LteUePhy::GetSyncRefId(uint16_t slssid, uint16_t offset)
+{
+    return (static_cast<uint32_t>(slssid) << 16) + offset;
+}
+
 void
-LteUePhy::EndSlssScanning()
+LteUePhy::DetectSyncRef(uint16_t slssid, uint16_t offset, double srsrp)
 {
-    NS_LOG_FUNCTION(this);
-    m_ueSlssScanningInProgress = false;
+    NS_LOG_FUNCTION(this << slssid << offset << srsrp);
+    NS_LOG_LOGIC("UE RNTI " << m_rnti << " detected SyncRef with SLSSID " << slssid << " offset "
+                            << offset << " S-RSRP " << srsrp);
 
-    // Filter to keep only the SyncRefs with received MIB-SL
-    std::map<std::pair<uint16_t, uint16_t>, UeSlssMeasurementsElement>::iterator itDetectionMap;
-    for (itDetectionMap = m_ueSlssDetectionMap.begin();
-         itDetectionMap != m_ueSlssDetectionMap.end();
-         itDetectionMap++)
+    // Min-heap on the S-RSRP: the front is the detected SyncRef with lowest S-RSRP
+    auto higherSrsrp = [](const UeSlssMeasurementsElement& a, const UeSlssMeasurementsElement& b) {
+        return a.srsrpSum / a.srsrpNum > b.srsrpSum / b.srsrpNum;
+    };
+    if (m_ueSlssDetected.size() == MAX_DETECTED_SYNC_REFS)
     {
-        NS_LOG_LOGIC(
-            "UE RNTI " << m_rnti << " detected SyncRef with SLSSID " << itDetectionMap->first.first
-                       << " offset " << itDetectionMap->first.second << " S-RSRP "
-                       << itDetectionMap->second.srsrpSum / itDetectionMap->second.srsrpNum);
-        auto itMap =
-            m_detectedMibSl.find(std::pair<uint16_t, uint16_t>(itDetectionMap->first.first,
-                                                               itDetectionMap->first.second));
-        // If the MIB-SL wasn't received, erase it from the detection map
-        if (itMap == m_detectedMibSl.end())
+        const UeSlssMeasurementsElement& lowest = m_ueSlssDetected.front();
+        if (srsrp <= lowest.srsrpSum / lowest.srsrpNum)
         {
-            NS_LOG_LOGIC("MIB-SL was not found... Removing from detection list");
-            m_ueSlssDetectionMap.erase(itDetectionMap);
+            NS_LOG_LOGIC("The UE detected more than 6 SyncRefs... Ignoring lower S-RSRP SyncRef");
+            return;
         }
+        NS_LOG_LOGIC("The UE detected more than 6 SyncRefs... Removing lowest S-RSRP SyncRef: "
+                     << "SLSSID " << lowest.slssid << " offset " << lowest.offset);
+        std::pop_heap(m_ueSlssDetected.begin(), m_ueSlssDetected.end(), higherSrsrp);
+        m_ueSlssDetected.pop_back();
     }
+    m_ueSlssDetected.push_back({slssid, offset, srsrp, 1});
+    std::push_heap(m_ueSlssDetected.begin(), m_ueSlssDetected.end(), higherSrsrp);
+}
 
-    // Select the 6 SyncRefs with higher S-RSRP. Remove the others form the detected list
-    std::map<double, std::pair<uint16_t, uint16_t>> tmp;
-    for (itDetectionMap = m_ueSlssDetectionMap.begin();
-         itDetectionMap != m_ueSlssDetectionMap.end();
-         itDetectionMap++)
-    {
-        tmp.insert(std::pair<double, std::pair<uint16_t, uint16_t>>(
-            itDetectionMap->second.srsrpSum / itDetectionMap->second.srsrpNum,
-            itDetectionMap->first));
-    }
-    while (tmp.size() > 6)
-    {
-        NS_LOG_LOGIC(
-            "The UE detected more than 6 SyncRefs... Removing lowest S-RSRP SyncRef: SLSSID"
-            << tmp.begin()->second.first << "ofset " << tmp.begin()->second.second << "S-RSRP "
-            << tmp.begin()->first);
-        tmp.erase(tmp.begin()->first);
-    }
-    std::map<std::pair<uint16_t, uint16_t>, UeSlssMeasurementsElement> ret;
-    std::map<double, std::pair<uint16_t, uint16_t>>::iterator itTmp;
-    for (itTmp = tmp.begin(); itTmp != tmp.end(); itTmp++)
-    {
-        auto itDetectionMapTwo = m_ueSlssDetectionMap.find(itTmp->second);
-        if (itDetectionMapTwo != m_ueSlssDetectionMap.end())
-        {
-            ret.insert(std::pair<std::pair<uint16_t, uint16_t>, UeSlssMeasurementsElement>(
-                itDetectionMapTwo->first,
-                itDetectionMapTwo->second));
-        }
-    }
+void
+LteUePhy::EndSlssScanning()
+{
+    NS_LOG_FUNCTION(this);
+    m_ueSlssScanningInProgress = false;
 
-    m_ueSlssDetectionMap = ret;    // It contains now only the 6 SyncRefs with higher S-RSRP
-    m_ueSlssMeasurementsMap = ret; // It contains now only the 6 SyncRefs with higher S-RSRP (we use
-                                   // the S-RSRP measurements during scanning as first measurements)
+    // The detected SyncRefs are the 6 SyncRefs with received MIB-SL and higher S-RSRP,
+    // sorted by SLSSID and offset
+    std::sort(m_ueSlssDetected.begin(),
+              m_ueSlssDetected.end(),
+              [](const UeSlssMeasurementsElement& a, const UeSlssMeasurementsElement& b) {
+                  return std::tie(a.slssid, a.offset) < std::tie(b.slssid, b.offset);
+              });
+    m_ueSlssScanningSrsrp.clear();
+    // We use the S-RSRP measurements during scanning as first measurements
+    m_ueSlssMeasurements = m_ueSlssDetected;
 
-    uint32_t nDetectedSyncRef = m_ueSlssDetectionMap.size();
+    uint32_t nDetectedSyncRef = m_ueSlssDetected.size();
 
     if (nDetectedSyncRef > 0)
     {
         NS_LOG_LOGIC("At least one SyncRef detected, creating measurement schedule and starting "
                      "measurement sub-process");
         // Create measurement schedule
-        std::map<std::pair<uint16_t, uint16_t>, UeSlssMeasurementsElement>::iterator itMeasMap;
-        for (itMeasMap = m_ueSlssMeasurementsMap.begin();
-             itMeasMap != m_ueSlssMeasurementsMap.end();
-             itMeasMap++)
+        for (const auto& meas : m_ueSlssMeasurements)
         {
             uint16_t currOffset = Simulator::Now().GetMilliSeconds() % 40;
             int64_t t;
-            if (currOffset < itMeasMap->first.second)
+            if (currOffset < meas.offset)
             {
-                t = Simulator::Now().GetMilliSeconds() + (itMeasMap->first.second - currOffset);
+                t = Simulator::Now().GetMilliSeconds() + (meas.offset - currOffset);
             }
             else
             {
-                t = Simulator::Now().GetMilliSeconds() +
-                    (40 - currOffset + itMeasMap->first.second);
+                t = Simulator::Now().GetMilliSeconds() + (40 - currOffset + meas.offset);
             }
             uint16_t count = 1;
             while (t < (Simulator::Now().GetMilliSeconds() +
                         m_ueSlssMeasurementPeriod.GetMilliSeconds() - 40))
             {
                 NS_LOG_INFO("UE RNTI " << m_rnti << " will measure S-RSRP of SyncRef SLSSID "
-                                       << itMeasMap->first.first << " offset "
-                                       << itMeasMap->first.second << " at t:" << t << " ms");
-                m_ueSlssMeasurementsSched.insert(
-                    std::pair<int64_t, std::pair<uint16_t, uint16_t>>(t, itMeasMap->first));
+                                       << meas.slssid << " offset " << meas.offset
+                                       << " at t:" << t << " ms");
+                m_ueSlssMeasurementsSched.insert(std::pair<int64_t, std::pair<uint16_t, uint16_t>>(
+                    t,
+                    std::pair<uint16_t, uint16_t>(meas.slssid, meas.offset)));
                 count++;
                 if (count > m_nSamplesSrsrpMeas)
                 {
@@ -2899,67 +2892,47 @@ LteUePhy::ReportSlssMeasurements(uint64_t slssid, uint16_t offset)
     NS_LOG_FUNCTION(this);
 
     LteUeCphySapUser::UeSlssMeasurementsParameters ret;
-    std::map<std::pair<uint16_t, uint16_t>, UeSlssMeasurementsElement>::iterator it;
 
     if (slssid == 0) // Report all
     {
         NS_LOG_LOGIC("End of S-RSRP measurement corresponding to the measurement sub-process... "
                      "Reporting L1 filtered S-RSRP values of detected SyncRefs");
-
-        for (it = m_ueSlssMeasurementsMap.begin(); it != m_ueSlssMeasurementsMap.end(); it++)
-        {
-            // L1 filtering: linear average
-            double avg_s_rsrp_W =
-                (*it).second.srsrpSum / static_cast<double>((*it).second.srsrpNum);
-            // The stored values are in W, the report to the RRC should be in dBm
-            double avg_s_rsrp_dBm = 10 * log10(1000 * (avg_s_rsrp_W));
-
-            NS_LOG_INFO("UE RNTI " << m_rnti << " report SyncRef with SLSSID " << (*it).first.first
-                                   << " offset " << (*it).first.second << " L1 filtered S-RSRP "
-                                   << avg_s_rsrp_dBm << " from " << (double)(*it).second.srsrpNum
-                                   << " samples");
-
-            LteUeCphySapUser::UeSlssMeasurementsElement newEl;
-            newEl.m_slssid = (*it).first.first;
-            newEl.m_srsrp = avg_s_rsrp_dBm;
-            newEl.m_offset = (*it).first.second;
-            ret.m_ueSlssMeasurementsList.push_back(newEl);
-        }
     }
     else // Report only of the selected SyncRef
     {
         NS_LOG_LOGIC("End of S-RSRP measurement corresponding to the evaluation sub-process");
         NS_LOG_LOGIC("Reporting L1 filtered S-RSRP values of the SyncRef SLSSID "
                      << slssid << " offset " << offset);
+    }
 
-        it = m_ueSlssMeasurementsMap.find(std::pair<uint16_t, uint16_t>(slssid, offset));
-        if (it != m_ueSlssMeasurementsMap.end())
+    for (const auto& meas : m_ueSlssMeasurements)
+    {
+        if (slssid != 0 && (meas.slssid != slssid || meas.offset != offset))
         {
-            // L1 filtering: linear average
-            double avg_s_rsrp_W =
-                (*it).second.srsrpSum / static_cast<double>((*it).second.srsrpNum);
-            // The stored values are in W, the report to the RRC should be in dBm
-            double avg_s_rsrp_dBm = 10 * log10(1000 * (avg_s_rsrp_W));
-
-            NS_LOG_INFO(Simulator::Now().GetMilliSeconds()
-                        << " UE RNTI " << m_rnti << " Report SyncRef with SLSSID "
-                        << (*it).first.first << " offset " << (*it).first.second
-                        << " L1 filtered S-RSRP " << avg_s_rsrp_dBm << " from "
-                        << (double)(*it).second.srsrpNum << " samples");
-
-            LteUeCphySapUser::UeSlssMeasurementsElement newEl;
-            newEl.m_slssid = (*it).first.first;
-            newEl.m_srsrp = avg_s_rsrp_dBm;
-            newEl.m_offset = (*it).first.second;
-            ret.m_ueSlssMeasurementsList.push_back(newEl);
+            continue;
         }
+        // L1 filtering: linear average
+        double avg_s_rsrp_W = meas.srsrpSum / static_cast<double>(meas.srsrpNum);
+        // The stored values are in W, the report to the RRC should be in dBm
+        double avg_s_rsrp_dBm = 10 * log10(1000 * (avg_s_rsrp_W));
+
+        NS_LOG_INFO("UE RNTI " << m_rnti << " report SyncRef with SLSSID " << meas.slssid
+                               << " offset " << meas.offset << " L1 filtered S-RSRP "
+                               << avg_s_rsrp_dBm << " from " << (double)meas.srsrpNum
+                               << " samples");
+
+        LteUeCphySapUser::UeSlssMeasurementsElement newEl;
+        newEl.m_slssid = meas.slssid;
+        newEl.m_srsrp = avg_s_rsrp_dBm;
+        newEl.m_offset = meas.offset;
+        ret.m_ueSlssMeasurementsList.push_back(newEl);
     }
 
     // Report to RRC
     m_ueCphySapUser->ReportSlssMeasurements(ret, slssid, offset);
 
     // Cleaning for next process
-    m_ueSlssMeasurementsMap.clear();
+    m_ueSlssMeasurements.clear();
     m_ueSlssMeasurementsSched.clear();
     m_ueSlssMeasurementInProgress = false;
 
@@ -3014,7 +2987,7 @@ LteUePhy::ReportSlssMeasurements(uint64_t slssid, uint16_t offset)
     {
         // End of the selection+evaluation process, reinitialize variables for next process and
         // schedule it
-        m_ueSlssDetectionMap.clear();
+        m_ueSlssDetected.clear();
 
         if (m_currNMeasPeriods == 1)
         {
@@ -3284,15 +3257,18 @@ LteUePhy::ReceivePsdchSdRsrp(Ptr<Packet> p, Ptr<SpectrumValue> psd, const std::v
 {
     NS_LOG_FUNCTION(this << m_rnti);
 
-    LteSlDiscHeader discHeader;
-    p->PeekHeader(discHeader);
-    uint8_t msgType = discHeader.GetDiscoveryMsgType();
-
     // We only monitor SD-RSRP for Relay Announcements (Discovery Model A)
-    // or Relay Responses (Discovery Model B)
-    if (msgType == LteSlDiscHeader::DISC_RELAY_ANNOUNCEMENT ||
-        msgType == LteSlDiscHeader::DISC_RELAY_RESPONSE)
+    // or Relay Responses (Discovery Model B): the other messages are not
+    // deserialized
+    uint8_t msgType;
+    uint32_t code;
+    if (LteSlDiscHeader::PeekMessageTypeAndCode(p, msgType, code) &&
+        (msgType == LteSlDiscHeader::DISC_RELAY_ANNOUNCEMENT ||
+         msgType == LteSlDiscHeader::DISC_RELAY_RESPONSE))
     {
+        LteSlDiscHeader discHeader;
+        p->PeekHeader(discHeader);
+
         // Get indexes
         uint64_t relayUeId = discHeader.GetRelayUeId();
         uint32_t serviceCode = discHeader.GetRelayServiceCode();
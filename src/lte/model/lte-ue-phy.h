@@ -36,6 +36,8 @@
 #include <ns3/ptr.h>
 
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace ns3
 {
@@ -1142,15 +1144,27 @@ class LteUePhy : public LtePhy
      */
     struct UeSlssMeasurementsElement
     {
+        uint16_t slssid;  ///< SLSSID of the SyncRef
+        uint16_t offset;  ///< Offset the SyncRef uses for transmitting the SLSSs
         double srsrpSum;  ///< Sum of S-RSRP sample values in linear unit.
         uint8_t srsrpNum; ///< Number of S-RSRP samples.
     };
 
+    /// Maximum number of detected SyncRefs kept for the S-RSRP measurements
+    static constexpr uint32_t MAX_DETECTED_SYNC_REFS = 6;
+
+    /**
+     * Stores the first S-RSRP sample (in W) of the SyncRefs detected during the scanning
+     * process, indexed by the SLSSID of the SyncRef and the offset it uses for transmitting the
+     * SLSSs (see GetSyncRefId)
+     */
+    std::unordered_map<uint32_t, double> m_ueSlssScanningSrsrp;
     /**
-     * Stores the S-RSRP information of the SyncRefs detected during the scanning process,
-     * indexed by the SLSSID of the SyncRef and the offset it uses for transmitting the SLSSs
+     * The detected SyncRefs (with received MIB-SL) with highest S-RSRP, at most
+     * MAX_DETECTED_SYNC_REFS. During the scanning process it is a min-heap on the S-RSRP,
+     * updated as the SyncRefs are detected; afterwards it is sorted by SLSSID and offset
      */
-    std::map<std::pair<uint16_t, uint16_t>, UeSlssMeasurementsElement> m_ueSlssDetectionMap;
+    std::vector<UeSlssMeasurementsElement> m_ueSlssDetected;
     /**
      * Represents the S-RSRP measurement schedule for the current measurement process.
      * It is used for knowing when the UE needs to take samples of the detected SyncRefs S-RSRP.
@@ -1159,10 +1173,10 @@ class LteUePhy : public LtePhy
      */
     std::map<int64_t, std::pair<uint16_t, uint16_t>> m_ueSlssMeasurementsSched;
     /**
-     * Stores the S-RSRP information of the SyncRefs in measurement during the measurement process
-     * indexed by the SLSSID of the SyncRef and the offset it uses for transmitting the SLSSs
+     * Stores the S-RSRP information of the SyncRefs in measurement during the measurement process,
+     * sorted by SLSSID and offset
      */
-    std::map<std::pair<uint16_t, uint16_t>, UeSlssMeasurementsElement> m_ueSlssMeasurementsMap;
+    std::vector<UeSlssMeasurementsElement> m_ueSlssMeasurements;
     /**
      * Time period for searching/scanning to detect available SyncRefs (supporting SyncRef
      * selection)
@@ -1210,11 +1224,12 @@ class LteUePhy : public LtePhy
      */
     double m_minSrsrp;
     /**
-     * Stores the received MIB-SL during the SyncRef search/scanning.
+     * Stores the SyncRefs (see GetSyncRefId) whose MIB-SL was received during the SyncRef
+     * search/scanning.
      * Used to determine the detected SyncRefs, as SyncRefs with valid S-RSRP but without
      * successfully decoded/received MIB-SL are not considered detected
      */
-    std::map<std::pair<uint16_t, uint16_t>, LteRrcSap::MasterInformationBlockSL> m_detectedMibSl;
+    std::unordered_set<uint32_t> m_detectedMibSl;
     /**
      * Current frame number
      */
@@ -1258,6 +1273,21 @@ class LteUePhy : public LtePhy
      * SyncRef search/scanning
      */
     void StartSlssScanning();
+    /**
+     * \param slssid The SLSSID of the SyncRef
+     * \param offset The offset the SyncRef uses for transmitting the SLSSs
+     * \return the identifier of the SyncRef, formed by (slssid << 16) + offset
+     */
+    static uint32_t GetSyncRefId(uint16_t slssid, uint16_t offset);
+    /**
+     * Add a SyncRef detected during the SyncRef search/scanning, i.e., with valid S-RSRP
+     * and received MIB-SL, to the detected SyncRefs if it is one of the six with highest
+     * S-RSRP
+     * \param slssid The SLSSID of the SyncRef
+     * \param offset The offset the SyncRef uses for transmitting the SLSSs
+     * \param srsrp The S-RSRP of the SyncRef in W
+     */
+    void DetectSyncRef(uint16_t slssid, uint16_t offset, double srsrp);
     /**
      * Notify the end of the SyncRef search/scanning,
      * keep only the six detected SyncRef (with received MIB-SL) with highest S-RSRP,
@@ -325,6 +325,13 @@ LteUeRrc::GetTypeId()
                           DoubleValue(-125),
                           MakeDoubleAccessor(&LteUeRrc::m_minSdRsrp),
                           MakeDoubleChecker<double>())
+            .AddAttribute("SdRsrpMeasurementsMaxAge",
+                          "The time after which the SD-RSRP stored for a Relay UE is discarded "
+                          "if it has not been updated. Zero keeps the SD-RSRP of all the Relay "
+                          "UEs ever measured",
+                          TimeValue(Seconds(60)),
+                          MakeTimeAccessor(&LteUeRrc::m_sdRsrpMeasMaxAge),
+                          MakeTimeChecker())
             .AddTraceSource("ChangeOfSyncRef",
                             "trace fired upon report of a change of SyncRef",
                             MakeTraceSourceAccessor(&LteUeRrc::m_changeOfSyncRefTrace),
@@ -4587,49 +4594,48 @@ LteUeRrc::DoNotifyDiscoveryReception(Ptr<Packet> p)
 {
     NS_LOG_FUNCTION(this << p);
 
+    // discard the messages this UE is not monitoring before deserializing them
+    uint8_t msgType = 0;
+    uint32_t code = 0;
+    if (!LteSlDiscHeader::PeekMessageTypeAndCode(p, msgType, code) ||
+        !m_sidelinkConfiguration->IsMonitoringDiscoveryMessage(msgType, code))
+    {
+        NS_LOG_LOGIC("Discovery message type " << (uint16_t)msgType << " code " << code
+                                               << " not monitored by " << m_rnti);
+        return;
+    }
+
     LteSlDiscHeader discHeader;
     p->RemoveHeader(discHeader);
 
-    uint8_t msgType = discHeader.GetDiscoveryMsgType();
     if (msgType == LteSlDiscHeader::DISC_OPEN_ANNOUNCEMENT ||
         msgType == LteSlDiscHeader::DISC_RESTRICTED_QUERY ||
         msgType == LteSlDiscHeader::DISC_RESTRICTED_RESPONSE)
     { // open or restricted announcement
-        if (m_sidelinkConfiguration->IsMonitoringApp(msgType, discHeader.GetApplicationCode()))
-        {
-            NS_LOG_INFO("discovery message received by " << m_rnti);
-            m_discoveryMonitoringTrace(m_imsi, m_cellId, m_rnti, discHeader);
-            m_sidelinkConfiguration->RecvApplicationServiceDiscovery(
-                msgType,
-                discHeader.GetApplicationCode());
-        }
+        NS_LOG_INFO("discovery message received by " << m_rnti);
+        m_discoveryMonitoringTrace(m_imsi, m_cellId, m_rnti, discHeader);
+        m_sidelinkConfiguration->RecvApplicationServiceDiscovery(msgType,
+                                                                 discHeader.GetApplicationCode());
     }
     else if (msgType == LteSlDiscHeader::DISC_RELAY_ANNOUNCEMENT ||
              msgType == LteSlDiscHeader::DISC_RELAY_RESPONSE)
     {
-        if (m_sidelinkConfiguration->IsMonitoringRelayServiceCode(msgType,
-                                                                  discHeader.GetRelayServiceCode()))
-        {
-            NS_LOG_INFO("Relay announcement message received by " << m_rnti);
-            m_discoveryMonitoringTrace(m_imsi, m_cellId, m_rnti, discHeader);
-            m_sidelinkConfiguration->RecvRelayServiceDiscovery(discHeader.GetRelayServiceCode(),
-                                                               discHeader.GetInfo(),
-                                                               discHeader.GetRelayUeId(),
-                                                               discHeader.GetStatusIndicator());
-        }
+        NS_LOG_INFO("Relay announcement message received by " << m_rnti);
+        m_discoveryMonitoringTrace(m_imsi, m_cellId, m_rnti, discHeader);
+        m_sidelinkConfiguration->RecvRelayServiceDiscovery(discHeader.GetRelayServiceCode(),
+                                                           discHeader.GetInfo(),
+                                                           discHeader.GetRelayUeId(),
+                                                           discHeader.GetStatusIndicator());
     }
-    else if (msgType == LteSlDiscHeader::DISC_RELAY_SOLICITATION)
+    else
     {
-        if (m_sidelinkConfiguration->IsMonitoringRelayServiceCode(msgType,
-                                                                  discHeader.GetRelayServiceCode()))
-        {
-            NS_LOG_INFO("Relay request message received by " << m_rnti);
-            m_discoveryMonitoringTrace(m_imsi, m_cellId, m_rnti, discHeader);
-            m_sidelinkConfiguration->RecvRelayServiceDiscovery(discHeader.GetRelayServiceCode(),
-                                                               discHeader.GetInfo(),
-                                                               discHeader.GetURDSComposition(),
-                                                               discHeader.GetRelayUeId());
-        }
+        NS_ASSERT(msgType == LteSlDiscHeader::DISC_RELAY_SOLICITATION);
+        NS_LOG_INFO("Relay request message received by " << m_rnti);
+        m_discoveryMonitoringTrace(m_imsi, m_cellId, m_rnti, discHeader);
+        m_sidelinkConfiguration->RecvRelayServiceDiscovery(discHeader.GetRelayServiceCode(),
+                                                           discHeader.GetInfo(),
+                                                           discHeader.GetURDSComposition(),
+                                                           discHeader.GetRelayUeId());
     }
 }
 
@@ -5662,6 +5668,8 @@ LteUeRrc::DoReportUeSdRsrpMeasurements(LteUeCphySapUser::UeSdRsrpMeasurementsPar
                      << " filterCoefficient " << layer3FilterCoefficient << " qRxLevMin "
                      << qRxLevMin << " minHyst " << minHyst);
 
+    PurgeSdRsrpMeasurements();
+
     // Store values (Applying L3 filter if needed)
     std::vector<LteUeCphySapUser::UeSdRsrpMeasurementsElement>::iterator newMeasIt;
     for (newMeasIt = params.m_ueSdRsrpMeasurementsList.begin();
@@ -5703,6 +5711,35 @@ LteUeRrc::DoReportUeSdRsrpMeasurements(LteUeCphySapUser::UeSdRsrpMeasurementsPar
     m_sidelinkConfiguration->RelayUeSelection(validRelays);
 }
 
+void
+LteUeRrc::PurgeSdRsrpMeasurements()
+{
+    NS_LOG_FUNCTION(this);
+
+    // The stored values are checked at most once per maximum age, so that a
+    // value is discarded at most twice the maximum age after its last update
+    if (m_sdRsrpMeasMaxAge.IsZero() || Simulator::Now() < m_nextSdRsrpMeasPurge)
+    {
+        return;
+    }
+    m_nextSdRsrpMeasPurge = Simulator::Now() + m_sdRsrpMeasMaxAge;
+
+    for (auto it = m_storedSdRsrpMeasValues.begin(); it != m_storedSdRsrpMeasValues.end();)
+    {
+        if (Simulator::Now() - it->second.timestamp > m_sdRsrpMeasMaxAge)
+        {
+            NS_LOG_LOGIC(this << " Discarding the SD-RSRP of Relay UE ID " << it->first.first
+                              << " Service Code " << it->first.second << " measured at "
+                              << it->second.timestamp.As(Time::S));
+            it = m_storedSdRsrpMeasValues.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
 void
 LteUeRrc::SaveSdRsrpMeasurements(uint64_t relayId,
                                  uint32_t serviceCode,
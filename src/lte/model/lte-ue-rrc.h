@@ -1835,6 +1835,23 @@ class LteUeRrc : public Object
      */
     std::map<std::pair<uint64_t, uint32_t>, SdRsrpMeasValue> m_storedSdRsrpMeasValues;
 
+    /**
+     * The time after which a stored SD-RSRP which has not been updated is discarded
+     */
+    Time m_sdRsrpMeasMaxAge;
+
+    /**
+     * The time of the next check of the age of the stored SD-RSRP values
+     */
+    Time m_nextSdRsrpMeasPurge;
+
+    /**
+     * Discard the stored SD-RSRP values which have not been updated for more than
+     * the maximum age, so that the Relay UEs which are no longer detected do not
+     * accumulate in long simulations. Checked at most once per maximum age.
+     */
+    void PurgeSdRsrpMeasurements();
+
     /**
      * The minimum value of SD-RSRP to consider a Relay UE detected
      */
@@ -0,0 +1,146 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "ns3/lte-amc.h"
+#include "ns3/test.h"
+
+#include <set>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LteTestAmc");
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test case checking LteAmc::GetUlMcsNprbInfoFromTbs, which searches
+ * the uplink TBS table by bisection, against a linear scan of the table: for
+ * each number of PRBs up to the maximum, the lowest MCS up to the maximum
+ * reaching the requested TBS.
+ *
+ * Every combination of maximum number of PRBs and maximum MCS is checked,
+ * with every TBS of the uplink table, the TBS values between the entries of
+ * the table, and TBS values above the largest entry.
+ */
+class LteAmcUlMcsNprbTestCase : public TestCase
+{
+  public:
+    LteAmcUlMcsNprbTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LteAmcUlMcsNprbTestCase::LteAmcUlMcsNprbTestCase()
+    : TestCase("Uplink MCS and number of PRBs reaching a TBS")
+{
+}
+
+void
+LteAmcUlMcsNprbTestCase::DoRun()
+{
+    Ptr<LteAmc> amc = CreateObject<LteAmc>();
+
+    std::set<int> tbsValues;
+    for (int nprb = 1; nprb <= 110; nprb++)
+    {
+        for (int mcs = 0; mcs < 29; mcs++)
+        {
+            int tbs = amc->GetUlTbSizeFromMcs(mcs, nprb);
+            tbsValues.insert(tbs - 1);
+            tbsValues.insert(tbs);
+            tbsValues.insert(tbs + 1);
+        }
+    }
+    int maxTbs = *tbsValues.rbegin();
+    tbsValues.insert(0);
+    tbsValues.insert(maxTbs + 1000);
+
+    for (int tbs : tbsValues)
+    {
+        for (int maxMcs = 0; maxMcs < 29; maxMcs++)
+        {
+            // reference linear scan over all the PRBs; the result for fewer
+            // PRBs is the prefix of this one
+            std::vector<LteAmc::McsPrbInfo> reference;
+            for (int nprb = 1; nprb <= 110; nprb++)
+            {
+                for (int mcs = 0; mcs <= maxMcs; mcs++)
+                {
+                    int grantTbs = amc->GetUlTbSizeFromMcs(mcs, nprb);
+                    if (grantTbs >= tbs)
+                    {
+                        reference.push_back({static_cast<uint8_t>(mcs),
+                                             static_cast<uint8_t>(nprb),
+                                             static_cast<int32_t>(grantTbs)});
+                        break;
+                    }
+                }
+            }
+
+            auto expected = reference.begin();
+            for (int maxNprb = 0; maxNprb <= 110; maxNprb++)
+            {
+                while (expected != reference.end() && expected->nbRb <= maxNprb)
+                {
+                    expected++;
+                }
+                std::vector<LteAmc::McsPrbInfo> result =
+                    amc->GetUlMcsNprbInfoFromTbs(tbs, maxNprb, maxMcs);
+                NS_TEST_ASSERT_MSG_EQ(result.size(),
+                                      static_cast<std::size_t>(expected - reference.begin()),
+                                      "Wrong number of grants for TBS "
+                                          << tbs << ", " << maxNprb << " PRBs, MCS " << maxMcs);
+                for (std::size_t i = 0; i < result.size(); i++)
+                {
+                    bool same = result[i].mcs == reference[i].mcs &&
+                                result[i].nbRb == reference[i].nbRb &&
+                                result[i].tbs == reference[i].tbs;
+                    NS_TEST_ASSERT_MSG_EQ(same,
+                                          true,
+                                          "Wrong grant " << i << " for TBS " << tbs << ", "
+                                                         << maxNprb << " PRBs, MCS " << maxMcs);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief LteAmc test suite.
+ */
+class LteAmcTestSuite : public TestSuite
+{
+  public:
+    LteAmcTestSuite();
+};
+
+/**
+ * \ingroup lte-test
+ * Static variable for test initialization
+ */
+static LteAmcTestSuite g_lteAmcTestSuite;
+
+LteAmcTestSuite::LteAmcTestSuite()
+    : TestSuite("lte-amc", UNIT)
+{
+    NS_LOG_FUNCTION(this);
+
+    AddTestCase(new LteAmcUlMcsNprbTestCase(), TestCase::QUICK);
+}
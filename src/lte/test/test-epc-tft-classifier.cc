@@ -1014,5 +1014,49 @@ EpcTftClassifierTestSuite::EpcTftClassifierTestSuite()
                                                  2,
                                                  useIpv6),
                     TestCase::QUICK);
+
+        ///////////////////////////////////////////
+        // check default TFT after deleting a dedicated one
+        ///////////////////////////////////////////
+
+        Ptr<EpcTftClassifier> c5 = Create<EpcTftClassifier>();
+        c5->Add(EpcTft::Default(), 1);
+        c5->Add(tft1_2, 2);
+        c5->Add(tft4_1, 3);
+        c5->Delete(2);
+        AddTestCase(new EpcTftClassifierTestCase(c5,
+                                                 EpcTft::UPLINK,
+                                                 "9.1.1.1",
+                                                 "8.1.1.1",
+                                                 4,
+                                                 1024,
+                                                 0,
+                                                 1,
+                                                 useIpv6),
+                    TestCase::QUICK);
+        AddTestCase(new EpcTftClassifierTestCase(c5,
+                                                 EpcTft::DOWNLINK,
+                                                 "9.1.1.1",
+                                                 "8.1.1.1",
+                                                 9,
+                                                 7895,
+                                                 0,
+                                                 3,
+                                                 useIpv6),
+                    TestCase::QUICK);
+        Ptr<EpcTftClassifier> c6 = Create<EpcTftClassifier>();
+        c6->Add(EpcTft::Default(), 1);
+        c6->Add(tft4_1, 2);
+        c6->Delete(2);
+        AddTestCase(new EpcTftClassifierTestCase(c6,
+                                                 EpcTft::DOWNLINK,
+                                                 "9.1.1.1",
+                                                 "8.1.1.1",
+                                                 9,
+                                                 7895,
+                                                 0,
+                                                 1,
+                                                 useIpv6),
+                    TestCase::QUICK);
     }
 }
@@ -597,6 +597,38 @@ SidelinkCommPoolPsschTestCase::DoRun()
 
     NS_LOG_INFO("PSSCH transmissions = " << txInfo.size());
 
+    // the cached transmissions, read again after the ones of the following period
+    // are requested, must be the same as the ones computed by a new pool, whose
+    // cache is empty
+    SidelinkCommResourcePool::SubframeInfo followingScPeriod =
+        txpool->GetNextScPeriod(nextScPeriod.frameNo, nextScPeriod.subframeNo);
+    txpool->GetCachedPsschTransmissions(followingScPeriod, m_iTrp, m_rbStart, m_rbLen);
+    const std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>& cachedTxInfo =
+        txpool->GetCachedPsschTransmissions(nextScPeriod, m_iTrp, m_rbStart, m_rbLen);
+    Ptr<SidelinkTxCommResourcePool> newTxpool = CreateObject<SidelinkTxCommResourcePool>();
+    newTxpool->SetPool(pool);
+    std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo> computedTxInfo =
+        newTxpool->GetPsschTransmissions(nextScPeriod, m_iTrp, m_rbStart, m_rbLen);
+    NS_TEST_ASSERT_MSG_EQ(cachedTxInfo.size(),
+                          computedTxInfo.size(),
+                          "Wrong number of transmissions");
+    NS_TEST_ASSERT_MSG_EQ(txInfo.size(), computedTxInfo.size(), "Wrong number of transmissions");
+    auto cachedIt = cachedTxInfo.begin();
+    auto txIt = txInfo.begin();
+    for (const auto& info : computedTxInfo)
+    {
+        NS_TEST_EXPECT_MSG_EQ((cachedIt->subframe == info.subframe &&
+                               cachedIt->rbStart == info.rbStart && cachedIt->nbRb == info.nbRb),
+                              true,
+                              "Cached and computed PSSCH transmissions are not equal");
+        NS_TEST_EXPECT_MSG_EQ((txIt->subframe == info.subframe && txIt->rbStart == info.rbStart &&
+                               txIt->nbRb == info.nbRb),
+                              true,
+                              "Returned and computed PSSCH transmissions are not equal");
+        cachedIt++;
+        txIt++;
+    }
+
     uint32_t ctr = 0;
     uint32_t actualFrameNo = 0;
     uint32_t actualSubframeNo = 0;
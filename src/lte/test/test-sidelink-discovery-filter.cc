@@ -0,0 +1,178 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#include "ns3/lte-sl-header.h"
+#include "ns3/lte-sl-ue-rrc.h"
+#include <ns3/log.h>
+#include <ns3/packet.h>
+#include <ns3/test.h>
+
+NS_LOG_COMPONENT_DEFINE("TestSidelinkDiscoveryFilter");
+
+using namespace ns3;
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Discovery message filter test case: the message type and code read
+ * from the first bytes of a discovery message must match the deserialized
+ * header, and the monitored messages of a UE must be the ones accepted by
+ * IsMonitoringApp and IsMonitoringRelayServiceCode.
+ */
+class SidelinkDiscoveryFilterTestCase : public TestCase
+{
+  public:
+    SidelinkDiscoveryFilterTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+SidelinkDiscoveryFilterTestCase::SidelinkDiscoveryFilterTestCase()
+    : TestCase("Discovery message filter")
+{
+}
+
+void
+SidelinkDiscoveryFilterTestCase::DoRun()
+{
+    // codes using all their bytes, to check the byte order
+    const uint32_t appCode = 0xA1B2C3D4;
+    const uint32_t serviceCode = 0xE5F607;
+
+    std::vector<LteSlDiscHeader> headers(6);
+    headers[0].SetOpenDiscoveryAnnounceParameters(appCode);
+    headers[1].SetRestrictedDiscoveryQueryParameters(appCode);
+    headers[2].SetRestrictedDiscoveryResponseParameters(appCode);
+    headers[3].SetRelayAnnouncementParameters(serviceCode, 0x123456789A, 0x10203, 1);
+    headers[4].SetRelaySoliciationParameters(serviceCode, 0x123456789A, 0x10203);
+    headers[5].SetRelayResponseParameters(serviceCode, 0x123456789A, 0x10203, 1);
+    for (const auto& header : headers)
+    {
+        Ptr<Packet> p = Create<Packet>();
+        p->AddHeader(header);
+        uint8_t msgType;
+        uint32_t code;
+        NS_TEST_ASSERT_MSG_EQ(LteSlDiscHeader::PeekMessageTypeAndCode(p, msgType, code),
+                              true,
+                              "Message type and code should be read");
+        LteSlDiscHeader rxHeader;
+        p->RemoveHeader(rxHeader);
+        NS_TEST_EXPECT_MSG_EQ((uint16_t)msgType,
+                              (uint16_t)rxHeader.GetDiscoveryMsgType(),
+                              "Wrong message type");
+        bool relay = msgType == LteSlDiscHeader::DISC_RELAY_ANNOUNCEMENT ||
+                     msgType == LteSlDiscHeader::DISC_RELAY_SOLICITATION ||
+                     msgType == LteSlDiscHeader::DISC_RELAY_RESPONSE;
+        NS_TEST_EXPECT_MSG_EQ(code,
+                              relay ? rxHeader.GetRelayServiceCode()
+                                    : rxHeader.GetApplicationCode(),
+                              "Wrong code for message type " << (uint16_t)msgType);
+    }
+    uint8_t msgType;
+    uint32_t code;
+    NS_TEST_EXPECT_MSG_EQ(LteSlDiscHeader::PeekMessageTypeAndCode(Create<Packet>(3), msgType, code),
+                          false,
+                          "Too short packet should not be read");
+
+    // one application and one relay service per role
+    Ptr<LteSlUeRrc> rrc = CreateObject<LteSlUeRrc>();
+    rrc->StartDiscoveryApps({1}, LteSlUeRrc::Monitoring);
+    rrc->StartDiscoveryApps({2}, LteSlUeRrc::Announcing);
+    rrc->StartDiscoveryApps({3}, LteSlUeRrc::Discoveree);
+    rrc->StartDiscoveryApps({4}, LteSlUeRrc::Discoverer);
+    rrc->StartRelayService(5, LteSlUeRrc::ModelA, LteSlUeRrc::RemoteUE);
+    rrc->StartRelayService(6, LteSlUeRrc::ModelA, LteSlUeRrc::RelayUE);
+    rrc->StartRelayService(7, LteSlUeRrc::ModelB, LteSlUeRrc::RemoteUE);
+    rrc->StartRelayService(8, LteSlUeRrc::ModelB, LteSlUeRrc::RelayUE);
+
+    const std::vector<uint8_t> appMsgTypes = {LteSlDiscHeader::DISC_OPEN_ANNOUNCEMENT,
+                                              LteSlDiscHeader::DISC_RESTRICTED_QUERY,
+                                              LteSlDiscHeader::DISC_RESTRICTED_RESPONSE};
+    const std::vector<uint8_t> relayMsgTypes = {LteSlDiscHeader::DISC_RELAY_ANNOUNCEMENT,
+                                                LteSlDiscHeader::DISC_RELAY_SOLICITATION,
+                                                LteSlDiscHeader::DISC_RELAY_RESPONSE};
+    for (bool stopped : {false, true})
+    {
+        for (uint32_t code = 0; code <= 9; code++)
+        {
+            for (uint8_t type : appMsgTypes)
+            {
+                NS_TEST_EXPECT_MSG_EQ(rrc->IsMonitoringDiscoveryMessage(type, code),
+                                      rrc->IsMonitoringApp(type, code),
+                                      "Wrong filter for message type " << (uint16_t)type
+                                                                       << " app code " << code);
+            }
+            for (uint8_t type : relayMsgTypes)
+            {
+                NS_TEST_EXPECT_MSG_EQ(rrc->IsMonitoringDiscoveryMessage(type, code),
+                                      rrc->IsMonitoringRelayServiceCode(type, code),
+                                      "Wrong filter for message type "
+                                          << (uint16_t)type << " service code " << code);
+            }
+        }
+        if (!stopped)
+        {
+            rrc->StopDiscoveryApps({1}, LteSlUeRrc::Monitoring);
+            rrc->StopRelayService(5);
+            NS_TEST_EXPECT_MSG_EQ(
+                rrc->IsMonitoringDiscoveryMessage(LteSlDiscHeader::DISC_OPEN_ANNOUNCEMENT, 1),
+                false,
+                "Stopped application should not be monitored");
+        }
+    }
+    rrc->Dispose();
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Discovery message filter test suite.
+ */
+class SidelinkDiscoveryFilterTestSuite : public TestSuite
+{
+  public:
+    SidelinkDiscoveryFilterTestSuite();
+};
+
+SidelinkDiscoveryFilterTestSuite::SidelinkDiscoveryFilterTestSuite()
+    : TestSuite("sidelink-discovery-filter", UNIT)
+{
+    AddTestCase(new SidelinkDiscoveryFilterTestCase(), TestCase::QUICK);
+}
+
+static SidelinkDiscoveryFilterTestSuite staticSidelinkDiscoveryFilterTestSuite;
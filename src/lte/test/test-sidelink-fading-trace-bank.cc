@@ -0,0 +1,195 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#include "ns3/lte-sl-fading-trace-bank.h"
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/string.h>
+#include <ns3/test.h>
+#include <ns3/uinteger.h>
+
+#include <cmath>
+#include <fstream>
+#include <set>
+
+NS_LOG_COMPONENT_DEFINE("TestSidelinkFadingTraceBank");
+
+using namespace ns3;
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Sidelink fading trace bank test case: each link must follow the
+ * trace sample by sample from its own position, which changes at every
+ * window, and get the gains of the trace RBs of that sample.
+ */
+class SidelinkFadingTraceBankTestCase : public TestCase
+{
+  public:
+    SidelinkFadingTraceBankTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Get the sample of the trace used by a link at the current time, and
+     * check the gains of all the RBs of that sample
+     * \param linkId the link identifier
+     * \return the index of the sample
+     */
+    uint32_t GetSample(uint64_t linkId);
+
+    /**
+     * Store the samples used by the links at the current time
+     * \param samples the container of the samples
+     */
+    void StoreSamples(std::vector<uint32_t>* samples);
+
+    static constexpr uint32_t RB_NUM = 4;      ///< number of RBs of the trace
+    static constexpr uint32_t SAMPLES_NUM = 50; ///< number of samples of the trace
+    static constexpr uint32_t LINKS_NUM = 10;   ///< number of links
+    Ptr<LteSlFadingTraceBank> m_bank;           ///< the bank
+};
+
+SidelinkFadingTraceBankTestCase::SidelinkFadingTraceBankTestCase()
+    : TestCase("Sidelink fading trace bank")
+{
+}
+
+uint32_t
+SidelinkFadingTraceBankTestCase::GetSample(uint64_t linkId)
+{
+    // the fading of the RB r of the sample s is s - 25 + 0.01 * r dB
+    double sample = 10 * std::log10(m_bank->GetGain(linkId, 0)) + 25;
+    for (uint32_t rb = 1; rb < RB_NUM; rb++)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(10 * std::log10(m_bank->GetGain(linkId, rb)) + 25 - 0.01 * rb,
+                                  sample,
+                                  1e-4,
+                                  "RBs of link " << linkId << " not in the same sample");
+    }
+    return static_cast<uint32_t>(std::round(sample));
+}
+
+void
+SidelinkFadingTraceBankTestCase::StoreSamples(std::vector<uint32_t>* samples)
+{
+    for (uint64_t linkId = 0; linkId < LINKS_NUM; linkId++)
+    {
+        samples->push_back(GetSample((linkId << 32) | (linkId + 1)));
+    }
+}
+
+void
+SidelinkFadingTraceBankTestCase::DoRun()
+{
+    std::string traceFile = CreateTempDirFilename("sidelink-fading-trace.fad");
+    std::ofstream os(traceFile);
+    for (uint32_t rb = 0; rb < RB_NUM; rb++)
+    {
+        for (uint32_t sample = 0; sample < SAMPLES_NUM; sample++)
+        {
+            os << (sample - 25.0 + 0.01 * rb) << " ";
+        }
+        os << std::endl;
+    }
+    os.close();
+
+    m_bank = CreateObject<LteSlFadingTraceBank>();
+    m_bank->SetAttribute("TraceFilename", StringValue(traceFile));
+    m_bank->SetAttribute("TraceLength", TimeValue(MilliSeconds(SAMPLES_NUM)));
+    m_bank->SetAttribute("SamplesNum", UintegerValue(SAMPLES_NUM));
+    m_bank->SetAttribute("WindowSize", TimeValue(MilliSeconds(20)));
+    m_bank->SetAttribute("RbNum", UintegerValue(RB_NUM));
+    m_bank->AssignStreams(1);
+
+    // two consecutive samples in the first window, and one in the second one
+    std::vector<uint32_t> first;
+    std::vector<uint32_t> second;
+    std::vector<uint32_t> third;
+    Simulator::Schedule(MilliSeconds(5),
+                        &SidelinkFadingTraceBankTestCase::StoreSamples,
+                        this,
+                        &first);
+    Simulator::Schedule(MilliSeconds(6),
+                        &SidelinkFadingTraceBankTestCase::StoreSamples,
+                        this,
+                        &second);
+    Simulator::Schedule(MilliSeconds(25),
+                        &SidelinkFadingTraceBankTestCase::StoreSamples,
+                        this,
+                        &third);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(first.size(), LINKS_NUM, "Missing samples");
+    std::set<uint32_t> starts;
+    uint32_t moved = 0;
+    for (uint32_t i = 0; i < LINKS_NUM; i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(second[i],
+                              (first[i] + 1) % SAMPLES_NUM,
+                              "Link " << i << " should move to the next sample");
+        starts.insert(first[i]);
+        // without a new position in the new window, the link would be 20
+        // samples further in the trace
+        moved += (third[i] != (first[i] + 20) % SAMPLES_NUM);
+    }
+    NS_TEST_EXPECT_MSG_GT(starts.size(), 1, "The links should start from different samples");
+    NS_TEST_EXPECT_MSG_GT(moved, 0, "The links should get new positions in a new window");
+    m_bank->Dispose();
+    m_bank = nullptr;
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Sidelink fading trace bank test suite.
+ */
+class SidelinkFadingTraceBankTestSuite : public TestSuite
+{
+  public:
+    SidelinkFadingTraceBankTestSuite();
+};
+
+SidelinkFadingTraceBankTestSuite::SidelinkFadingTraceBankTestSuite()
+    : TestSuite("sidelink-fading-trace-bank", UNIT)
+{
+    AddTestCase(new SidelinkFadingTraceBankTestCase(), TestCase::QUICK);
+}
+
+static SidelinkFadingTraceBankTestSuite staticSidelinkFadingTraceBankTestSuite;
@@ -0,0 +1,157 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#include "ns3/lte-sl-harq-phy.h"
+#include <ns3/log.h>
+#include <ns3/ptr.h>
+#include <ns3/test.h>
+
+NS_LOG_COMPONENT_DEFINE("TestSidelinkHarqPhy");
+
+using namespace ns3;
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Sidelink discovery HARQ history test case: the retransmissions of a
+ * discovery TB must be decoded with the SINR of the previous transmissions
+ * of that TB, and a new transmission must be decoded without history, even
+ * if it is received after a retransmission of another TB in the same
+ * subframe.
+ */
+class SidelinkDiscHarqHistoryTestCase : public TestCase
+{
+  public:
+    SidelinkDiscHarqHistoryTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Receive a discovery TB: reset the HARQ process if the TB is new, as done
+     * by LteSpectrumPhy::AddExpectedTb, check the history used to decode the
+     * TB, and add the transmission of the TB to it, as done by
+     * LteSpectrumPhy::RxSlPsdch
+     * \param rnti the RNTI of the transmitter
+     * \param resPsdch the resource used
+     * \param ndi the new data indicator of the TB
+     * \param sinrs the SINR of the expected previous transmissions
+     * \param sinr the SINR of the transmission
+     */
+    void Receive(uint16_t rnti,
+                 uint8_t resPsdch,
+                 uint8_t ndi,
+                 const std::vector<double>& sinrs,
+                 double sinr);
+
+    Ptr<LteSlHarqPhy> m_harq; ///< the HARQ module
+};
+
+SidelinkDiscHarqHistoryTestCase::SidelinkDiscHarqHistoryTestCase()
+    : TestCase("Sidelink discovery HARQ history")
+{
+}
+
+void
+SidelinkDiscHarqHistoryTestCase::Receive(uint16_t rnti,
+                                         uint8_t resPsdch,
+                                         uint8_t ndi,
+                                         const std::vector<double>& sinrs,
+                                         double sinr)
+{
+    if (ndi)
+    {
+        m_harq->ResetDiscHarqProcessStatus(rnti, resPsdch);
+        m_harq->ResetDiscTbPrevDecoded(rnti, resPsdch);
+    }
+    const HarqProcessInfoList_t& history = m_harq->GetHarqProcessInfoDisc(rnti, resPsdch, ndi);
+    NS_TEST_ASSERT_MSG_EQ(history.size(),
+                          sinrs.size(),
+                          "Wrong number of previous transmissions for RNTI " << rnti);
+    for (std::size_t i = 0; i < sinrs.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(history[i].m_sinr,
+                              sinrs[i],
+                              "Wrong previous transmission " << i << " for RNTI " << rnti);
+    }
+    m_harq->UpdateDiscHarqProcessStatus(rnti, resPsdch, sinr);
+}
+
+void
+SidelinkDiscHarqHistoryTestCase::DoRun()
+{
+    m_harq = Create<LteSlHarqPhy>();
+    m_harq->SetDiscNumRetx(3);
+
+    // first period: RNTI 1 sends a TB and 3 retransmissions on resource 0,
+    // and RNTI 2 a new TB on resource 1 after the first retransmission of
+    // RNTI 1, in the same subframe
+    Receive(1, 0, 1, {}, 1.0);
+    Receive(1, 0, 0, {1.0}, 2.0);
+    Receive(2, 1, 1, {}, 5.0);
+    Receive(1, 0, 0, {1.0, 2.0}, 3.0);
+    Receive(2, 1, 0, {5.0}, 6.0);
+    Receive(1, 0, 0, {1.0, 2.0, 3.0}, 4.0);
+
+    // second period: the new TB of RNTI 1 on resource 0 has no history, and
+    // its retransmissions only the transmissions of the new TB
+    Receive(1, 0, 1, {}, 7.0);
+    Receive(1, 0, 0, {7.0}, 8.0);
+
+    // the retransmission of a TB whose first transmission was not received
+    // has no history
+    Receive(3, 2, 0, {}, 9.0);
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Sidelink HARQ PHY test suite.
+ */
+class SidelinkHarqPhyTestSuite : public TestSuite
+{
+  public:
+    SidelinkHarqPhyTestSuite();
+};
+
+SidelinkHarqPhyTestSuite::SidelinkHarqPhyTestSuite()
+    : TestSuite("sidelink-harq-phy", UNIT)
+{
+    AddTestCase(new SidelinkDiscHarqHistoryTestCase(), TestCase::QUICK);
+}
+
+static SidelinkHarqPhyTestSuite staticSidelinkHarqPhyTestSuite;
@@ -0,0 +1,361 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#include "ns3/lte-sl-chunk-processor.h"
+#include "ns3/lte-sl-interference.h"
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/test.h>
+
+#include <cmath>
+#include <set>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("TestSidelinkInterference");
+
+using namespace ns3;
+
+/// Number of RBs of the spectrum model of the tests
+static const uint32_t SL_INTERFERENCE_TEST_RBS = 10;
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Signal of the Sidelink interference test, with a constant PSD over
+ * a range of RBs
+ */
+struct SlInterferenceTestSignal
+{
+    uint32_t firstRb; ///< first RB of the signal
+    uint32_t lastRb;  ///< last RB of the signal (inclusive)
+    double power;     ///< PSD over the RBs of the signal
+    Time start;       ///< start time
+    Time duration;    ///< duration
+    bool rx;          ///< whether the signal is received, or is only interference
+};
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Sidelink interference test case: the SINR, interference and RS power
+ * chunks computed by LteSlInterference, which defers the evaluation of the
+ * SINR of the signals not overlapping a change of the received power, must be
+ * the ones of the eager evaluation of every signal at every change.
+ *
+ * The signals received start at time 0 and end at the same time, and the
+ * interfering signals may start and end at any time.
+ */
+class SidelinkInterferenceTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param name the name of the test case
+     * \param signals the signals
+     * \param rxDuration the duration of the reception
+     */
+    SidelinkInterferenceTestCase(std::string name,
+                                 std::vector<SlInterferenceTestSignal> signals,
+                                 Time rxDuration);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \param signal the signal
+     * \return the PSD of the signal
+     */
+    Ptr<SpectrumValue> GetPsd(const SlInterferenceTestSignal& signal) const;
+
+    /**
+     * Add the signals starting now to the interference, and start the
+     * reception of the signals received
+     * \param interference the interference
+     */
+    void StartSignals(Ptr<LteSlInterference> interference);
+
+    /**
+     * Compare the chunks reported for each signal received with the expected
+     * ones
+     * \param what the name of the chunks
+     * \param actual the chunks reported
+     * \param expected the expected chunks
+     */
+    void CheckChunks(std::string what,
+                     const std::vector<SpectrumValue>& actual,
+                     const std::vector<SpectrumValue>& expected);
+
+    /**
+     * Store the SINR chunks
+     * \param sinr the SINR chunks
+     */
+    void ReportSinr(std::vector<SpectrumValue> sinr);
+    /**
+     * Store the interference chunks
+     * \param interf the interference chunks
+     */
+    void ReportInterf(std::vector<SpectrumValue> interf);
+    /**
+     * Store the RS power chunks
+     * \param rsPower the RS power chunks
+     */
+    void ReportRsPower(std::vector<SpectrumValue> rsPower);
+
+    std::vector<SlInterferenceTestSignal> m_signals; ///< the signals
+    Time m_rxDuration;                               ///< the duration of the reception
+    Ptr<SpectrumModel> m_spectrumModel;              ///< the spectrum model
+    Ptr<SpectrumValue> m_noise;                      ///< the noise PSD
+    std::vector<SpectrumValue> m_sinr;               ///< the SINR chunks reported
+    std::vector<SpectrumValue> m_interf;             ///< the interference chunks reported
+    std::vector<SpectrumValue> m_rsPower;            ///< the RS power chunks reported
+};
+
+SidelinkInterferenceTestCase::SidelinkInterferenceTestCase(
+    std::string name,
+    std::vector<SlInterferenceTestSignal> signals,
+    Time rxDuration)
+    : TestCase(name),
+      m_signals(signals),
+      m_rxDuration(rxDuration)
+{
+}
+
+Ptr<SpectrumValue>
+SidelinkInterferenceTestCase::GetPsd(const SlInterferenceTestSignal& signal) const
+{
+    Ptr<SpectrumValue> psd = Create<SpectrumValue>(m_spectrumModel);
+    for (uint32_t rb = signal.firstRb; rb <= signal.lastRb; rb++)
+    {
+        (*psd)[rb] = signal.power;
+    }
+    return psd;
+}
+
+void
+SidelinkInterferenceTestCase::StartSignals(Ptr<LteSlInterference> interference)
+{
+    // as done by LteSpectrumPhy, all the signals are added before the
+    // reception of the ones of interest starts
+    for (const auto& signal : m_signals)
+    {
+        if (signal.start == Simulator::Now())
+        {
+            interference->AddSignal(GetPsd(signal), signal.duration);
+        }
+    }
+    if (Simulator::Now().IsZero())
+    {
+        for (const auto& signal : m_signals)
+        {
+            if (signal.rx)
+            {
+                interference->StartRx(GetPsd(signal));
+            }
+        }
+        Simulator::Schedule(m_rxDuration, &LteSlInterference::EndRx, interference);
+    }
+}
+
+void
+SidelinkInterferenceTestCase::ReportSinr(std::vector<SpectrumValue> sinr)
+{
+    m_sinr = sinr;
+}
+
+void
+SidelinkInterferenceTestCase::ReportInterf(std::vector<SpectrumValue> interf)
+{
+    m_interf = interf;
+}
+
+void
+SidelinkInterferenceTestCase::ReportRsPower(std::vector<SpectrumValue> rsPower)
+{
+    m_rsPower = rsPower;
+}
+
+void
+SidelinkInterferenceTestCase::CheckChunks(std::string what,
+                                          const std::vector<SpectrumValue>& actual,
+                                          const std::vector<SpectrumValue>& expected)
+{
+    NS_TEST_ASSERT_MSG_EQ(actual.size(), expected.size(), "Wrong number of " << what << " chunks");
+    for (std::size_t index = 0; index < expected.size(); index++)
+    {
+        for (uint32_t rb = 0; rb < SL_INTERFERENCE_TEST_RBS; rb++)
+        {
+            double tolerance = 1e-9 * std::abs(expected[index][rb]) + 1e-15;
+            NS_TEST_EXPECT_MSG_EQ_TOL(actual[index][rb],
+                                      expected[index][rb],
+                                      tolerance,
+                                      "Wrong " << what << " of signal " << index << " in RB "
+                                               << rb);
+        }
+    }
+}
+
+void
+SidelinkInterferenceTestCase::DoRun()
+{
+    std::vector<double> frequencies;
+    for (uint32_t rb = 0; rb < SL_INTERFERENCE_TEST_RBS; rb++)
+    {
+        frequencies.push_back(2.0e9 + rb * 180e3);
+    }
+    m_spectrumModel = Create<SpectrumModel>(frequencies);
+    m_noise = Create<SpectrumValue>(m_spectrumModel);
+    (*m_noise) = 0.1;
+
+    Ptr<LteSlInterference> interference = CreateObject<LteSlInterference>();
+    interference->SetNoisePowerSpectralDensity(m_noise);
+    Ptr<LteSlChunkProcessor> sinrProcessor = Create<LteSlChunkProcessor>();
+    sinrProcessor->AddCallback(MakeCallback(&SidelinkInterferenceTestCase::ReportSinr, this));
+    interference->AddSinrChunkProcessor(sinrProcessor);
+    Ptr<LteSlChunkProcessor> interfProcessor = Create<LteSlChunkProcessor>();
+    interfProcessor->AddCallback(MakeCallback(&SidelinkInterferenceTestCase::ReportInterf, this));
+    interference->AddInterferenceChunkProcessor(interfProcessor);
+    Ptr<LteSlChunkProcessor> rsPowerProcessor = Create<LteSlChunkProcessor>();
+    rsPowerProcessor->AddCallback(MakeCallback(&SidelinkInterferenceTestCase::ReportRsPower, this));
+    interference->AddRsPowerChunkProcessor(rsPowerProcessor);
+
+    std::set<Time> changes = {Seconds(0), m_rxDuration};
+    for (const auto& signal : m_signals)
+    {
+        NS_ASSERT(!signal.rx || (signal.start.IsZero() && signal.duration == m_rxDuration));
+        if (changes.insert(signal.start).second)
+        {
+            Simulator::Schedule(signal.start,
+                                &SidelinkInterferenceTestCase::StartSignals,
+                                this,
+                                interference);
+        }
+        changes.insert(signal.start + signal.duration);
+    }
+    Simulator::Schedule(Seconds(0), &SidelinkInterferenceTestCase::StartSignals, this, interference);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    // eager evaluation of the chunks of every signal received, between every
+    // two changes of the received power during the reception
+    std::vector<SpectrumValue> expectedSinr;
+    std::vector<SpectrumValue> expectedInterf;
+    std::vector<SpectrumValue> expectedRsPower;
+    for (const auto& signal : m_signals)
+    {
+        if (!signal.rx)
+        {
+            continue;
+        }
+        Ptr<SpectrumValue> psd = GetPsd(signal);
+        SpectrumValue sinrSum(m_spectrumModel);
+        SpectrumValue interfSum(m_spectrumModel);
+        for (auto change = changes.begin(); *change < m_rxDuration; change++)
+        {
+            Time start = *change;
+            Time end = *std::next(change);
+            SpectrumValue allSignals(m_spectrumModel);
+            for (const auto& other : m_signals)
+            {
+                if (other.start <= start && start < other.start + other.duration)
+                {
+                    allSignals += *GetPsd(other);
+                }
+            }
+            SpectrumValue interf = allSignals - (*psd) + (*m_noise);
+            sinrSum += (*psd) / interf * (end - start).GetSeconds();
+            interfSum += interf * (end - start).GetSeconds();
+        }
+        expectedSinr.push_back(sinrSum / m_rxDuration.GetSeconds());
+        expectedInterf.push_back(interfSum / m_rxDuration.GetSeconds());
+        expectedRsPower.push_back(*psd);
+    }
+
+    CheckChunks("SINR", m_sinr, expectedSinr);
+    CheckChunks("interference", m_interf, expectedInterf);
+    CheckChunks("RS power", m_rsPower, expectedRsPower);
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Sidelink interference test suite.
+ */
+class SidelinkInterferenceTestSuite : public TestSuite
+{
+  public:
+    SidelinkInterferenceTestSuite();
+};
+
+SidelinkInterferenceTestSuite::SidelinkInterferenceTestSuite()
+    : TestSuite("sidelink-interference", UNIT)
+{
+    Time rxDuration = MicroSeconds(1000);
+
+    // two signals received on distinct RBs, and interfering signals starting
+    // and ending during the reception, some at the same time, overlapping the
+    // RBs of one, both or none of the signals received, or only in part
+    std::vector<SlInterferenceTestSignal> signals = {
+        {0, 3, 2.0, MicroSeconds(0), rxDuration, true},
+        {5, 8, 1.0, MicroSeconds(0), rxDuration, true},
+        {0, 1, 0.8, MicroSeconds(100), MicroSeconds(800), false},
+        {2, 6, 0.5, MicroSeconds(200), MicroSeconds(300), false},
+        {3, 4, 0.25, MicroSeconds(300), MicroSeconds(200), false},
+        {8, 9, 0.3, MicroSeconds(600), MicroSeconds(600), false},
+        {9, 9, 0.7, MicroSeconds(700), MicroSeconds(100), false},
+    };
+    AddTestCase(new SidelinkInterferenceTestCase("Signals received on distinct RBs",
+                                                 signals,
+                                                 rxDuration),
+                TestCase::QUICK);
+
+    // two signals received on overlapping RBs, with an interfering signal
+    // starting with the reception
+    signals = {
+        {0, 4, 2.0, MicroSeconds(0), rxDuration, true},
+        {3, 7, 1.5, MicroSeconds(0), rxDuration, true},
+        {6, 9, 0.4, MicroSeconds(0), MicroSeconds(400), false},
+        {1, 2, 0.9, MicroSeconds(250), MicroSeconds(500), false},
+    };
+    AddTestCase(new SidelinkInterferenceTestCase("Signals received on overlapping RBs",
+                                                 signals,
+                                                 rxDuration),
+                TestCase::QUICK);
+}
+
+static SidelinkInterferenceTestSuite staticSidelinkInterferenceTestSuite;
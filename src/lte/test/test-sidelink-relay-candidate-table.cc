@@ -0,0 +1,135 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#include "ns3/lte-sl-relay-candidate-table.h"
+#include <ns3/log.h>
+#include <ns3/test.h>
+
+NS_LOG_COMPONENT_DEFINE("TestSidelinkRelayCandidateTable");
+
+using namespace ns3;
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Relay UE candidate table test case: the table must keep the Relay
+ * UEs with the strongest SD-RSRP up to its capacity, and return the strongest
+ * one, with the lowest ID among equal SD-RSRPs, as a linear scan would do.
+ */
+class SidelinkRelayCandidateTableTestCase : public TestCase
+{
+  public:
+    SidelinkRelayCandidateTableTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+SidelinkRelayCandidateTableTestCase::SidelinkRelayCandidateTableTestCase()
+    : TestCase("Relay UE candidate table")
+{
+}
+
+void
+SidelinkRelayCandidateTableTestCase::DoRun()
+{
+    LteSlRelayCandidateTable table(3);
+    NS_TEST_ASSERT_MSG_EQ(table.IsEmpty(), true, "New table should be empty");
+    NS_TEST_ASSERT_MSG_EQ(table.GetBestRelayId(), 0, "Empty table should have no best Relay UE");
+
+    NS_TEST_EXPECT_MSG_EQ(table.Update(10, -100), true, "Relay UE 10 should be added");
+    NS_TEST_EXPECT_MSG_EQ(table.Update(20, -90), true, "Relay UE 20 should be added");
+    NS_TEST_EXPECT_MSG_EQ(table.Update(30, -110), true, "Relay UE 30 should be added");
+    NS_TEST_ASSERT_MSG_EQ(table.GetSize(), 3, "Wrong table size");
+    // insertion order is kept as long as no Relay UE is removed
+    NS_TEST_EXPECT_MSG_EQ(table.GetRelayId(0), 10, "Wrong Relay UE at position 0");
+    NS_TEST_EXPECT_MSG_EQ(table.GetRelayId(1), 20, "Wrong Relay UE at position 1");
+    NS_TEST_EXPECT_MSG_EQ(table.GetRelayId(2), 30, "Wrong Relay UE at position 2");
+    NS_TEST_EXPECT_MSG_EQ(table.GetBestRelayId(), 20, "Wrong best Relay UE");
+
+    // the table is full: weaker Relay UEs are discarded, stronger ones replace the weakest
+    NS_TEST_EXPECT_MSG_EQ(table.Update(40, -120), false, "Relay UE 40 should be discarded");
+    NS_TEST_EXPECT_MSG_EQ(table.Update(50, -80), true, "Relay UE 50 should be added");
+    NS_TEST_ASSERT_MSG_EQ(table.GetSize(), 3, "The table should not exceed its capacity");
+    NS_TEST_EXPECT_MSG_EQ(table.Contains(30), false, "Relay UE 30 should be evicted");
+    NS_TEST_EXPECT_MSG_EQ(table.Contains(40), false, "Relay UE 40 should not be in the table");
+    NS_TEST_EXPECT_MSG_EQ(table.GetBestRelayId(), 50, "Wrong best Relay UE after eviction");
+
+    // updating an existing Relay UE changes its ranking, not its position
+    NS_TEST_EXPECT_MSG_EQ(table.Update(10, -80), true, "Relay UE 10 should be updated");
+    NS_TEST_EXPECT_MSG_EQ(table.GetSize(), 3, "Update should not add a Relay UE");
+    NS_TEST_EXPECT_MSG_EQ(table.GetRelayId(0), 10, "Update should not move the Relay UE");
+    NS_TEST_EXPECT_MSG_EQ_TOL(table.GetSdRsrp(0), -80, 1e-9, "Wrong SD-RSRP of Relay UE 10");
+    NS_TEST_EXPECT_MSG_EQ(table.GetBestRelayId(),
+                          10,
+                          "The lowest ID should be the best among equal SD-RSRPs");
+
+    // removal keeps the other Relay UEs reachable by position
+    NS_TEST_EXPECT_MSG_EQ(table.Remove(10), true, "Relay UE 10 should be removed");
+    NS_TEST_EXPECT_MSG_EQ(table.Remove(10), false, "Relay UE 10 should be removed only once");
+    NS_TEST_ASSERT_MSG_EQ(table.GetSize(), 2, "Wrong table size after removal");
+    for (uint32_t i = 0; i < table.GetSize(); i++)
+    {
+        uint64_t relayId = table.GetRelayId(i);
+        NS_TEST_EXPECT_MSG_EQ((relayId == 20 || relayId == 50), true, "Unexpected Relay UE");
+    }
+    NS_TEST_EXPECT_MSG_EQ(table.GetBestRelayId(), 50, "Wrong best Relay UE after removal");
+
+    table.Clear();
+    NS_TEST_EXPECT_MSG_EQ(table.IsEmpty(), true, "Cleared table should be empty");
+    NS_TEST_EXPECT_MSG_EQ(table.GetBestRelayId(), 0, "Cleared table should have no best Relay UE");
+    NS_TEST_EXPECT_MSG_EQ(table.GetCapacity(), 3, "Clear should keep the capacity");
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Relay UE candidate table test suite.
+ */
+class SidelinkRelayCandidateTableTestSuite : public TestSuite
+{
+  public:
+    SidelinkRelayCandidateTableTestSuite();
+};
+
+SidelinkRelayCandidateTableTestSuite::SidelinkRelayCandidateTableTestSuite()
+    : TestSuite("sidelink-relay-candidate-table", UNIT)
+{
+    AddTestCase(new SidelinkRelayCandidateTableTestCase(), TestCase::QUICK);
+}
+
+static SidelinkRelayCandidateTableTestSuite staticSidelinkRelayCandidateTableTestSuite;
@@ -0,0 +1,153 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#include "ns3/lte-sl-tft.h"
+#include <ns3/log.h>
+#include <ns3/test.h>
+
+NS_LOG_COMPONENT_DEFINE("TestSidelinkTftClassifier");
+
+using namespace ns3;
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Sidelink TFT classifier test case: the classifier must return the
+ * first TFT of its list matching the addresses, as a linear scan would do.
+ */
+class SidelinkTftClassifierTestCase : public TestCase
+{
+  public:
+    SidelinkTftClassifierTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+SidelinkTftClassifierTestCase::SidelinkTftClassifierTestCase()
+    : TestCase("Sidelink TFT classifier")
+{
+}
+
+void
+SidelinkTftClassifierTestCase::DoRun()
+{
+    Ipv4Address local("7.0.0.2");
+    Ipv6Address local6("7777:f00d::2");
+    auto group1 = Create<LteSlTft>(LteSlTft::BIDIRECTIONAL, Ipv4Address("225.0.0.1"), 1);
+    auto group2 = Create<LteSlTft>(LteSlTft::TRANSMIT, Ipv4Address("225.0.0.2"), 2);
+    auto group2bis = Create<LteSlTft>(LteSlTft::TRANSMIT, Ipv4Address("225.0.0.2"), 3);
+    auto range = Create<LteSlTft>(LteSlTft::TRANSMIT,
+                                  LteSlTft::REMOTE,
+                                  Ipv4Address("225.0.0.0"),
+                                  Ipv4Mask("255.255.255.0"),
+                                  4);
+    auto group6 = Create<LteSlTft>(LteSlTft::TRANSMIT, Ipv6Address("ff0e::1"), 5);
+
+    LteSlTftClassifier classifier;
+    NS_TEST_ASSERT_MSG_EQ(classifier.Classify(local, Ipv4Address("225.0.0.1")),
+                          nullptr,
+                          "Empty classifier should not match");
+    classifier.Add(group1);
+    classifier.Add(group2);
+    classifier.Add(group2bis);
+    classifier.Add(range);
+    classifier.Add(group6);
+
+    NS_TEST_EXPECT_MSG_EQ(classifier.Classify(local, Ipv4Address("225.0.0.1")),
+                          group1,
+                          "Wrong TFT for group 1");
+    NS_TEST_EXPECT_MSG_EQ(classifier.Classify(local, Ipv4Address("225.0.0.2")),
+                          group2,
+                          "The first TFT of the list should be returned");
+    NS_TEST_EXPECT_MSG_EQ(classifier.Classify(local, Ipv4Address("225.0.0.3")),
+                          range,
+                          "Address in range should match the range TFT");
+    NS_TEST_EXPECT_MSG_EQ(classifier.Classify(local, Ipv4Address("10.0.0.1")),
+                          nullptr,
+                          "Unknown address should not match");
+    NS_TEST_EXPECT_MSG_EQ(classifier.Classify(local6, Ipv6Address("ff0e::1")),
+                          group1,
+                          "IPv4 TFTs have no IPv6 prefix and match any IPv6 address");
+
+    // a range TFT placed before the host TFTs takes precedence
+    classifier.Remove(range);
+    classifier.Remove(group1);
+    classifier.Add(range);
+    classifier.Add(group1);
+    NS_TEST_EXPECT_MSG_EQ(classifier.Classify(local, Ipv4Address("225.0.0.1")),
+                          range,
+                          "Range TFT before the host TFT should be returned");
+    NS_TEST_EXPECT_MSG_EQ(classifier.Classify(local, Ipv4Address("225.0.0.2")),
+                          group2,
+                          "Host TFT before the range TFT should be returned");
+
+    std::list<Ptr<LteSlTft>> removed = classifier.RemoveGroup(2);
+    NS_TEST_EXPECT_MSG_EQ(removed.size(), 1, "Wrong number of TFTs removed for group 2");
+    NS_TEST_EXPECT_MSG_EQ(classifier.Classify(local, Ipv4Address("225.0.0.2")),
+                          group2bis,
+                          "Wrong TFT after removing group 2");
+    NS_TEST_EXPECT_MSG_EQ(classifier.Remove(group2), false, "Group 2 should be removed");
+
+    LteSlTftClassifier classifier6;
+    classifier6.Add(group6);
+    NS_TEST_EXPECT_MSG_EQ(classifier6.Classify(local6, Ipv6Address("ff0e::1")),
+                          group6,
+                          "Wrong TFT for IPv6 group");
+    NS_TEST_EXPECT_MSG_EQ(classifier6.Classify(local6, Ipv6Address("ff0e::2")),
+                          nullptr,
+                          "Unknown IPv6 address should not match");
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Sidelink TFT classifier test suite.
+ */
+class SidelinkTftClassifierTestSuite : public TestSuite
+{
+  public:
+    SidelinkTftClassifierTestSuite();
+};
+
+SidelinkTftClassifierTestSuite::SidelinkTftClassifierTestSuite()
+    : TestSuite("sidelink-tft-classifier", UNIT)
+{
+    AddTestCase(new SidelinkTftClassifierTestCase(), TestCase::QUICK);
+}
+
+static SidelinkTftClassifierTestSuite staticSidelinkTftClassifierTestSuite;
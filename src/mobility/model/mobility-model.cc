@@ -19,6 +19,7 @@
 
 #include "mobility-model.h"
 
+#include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
 
 #include <cmath>
@@ -56,6 +57,7 @@ MobilityModel::GetTypeId()
 }
 
 MobilityModel::MobilityModel()
+    : m_cachedPositionValid(false)
 {
 }
 
@@ -66,7 +68,17 @@ MobilityModel::~MobilityModel()
 Vector
 MobilityModel::GetPosition() const
 {
-    return DoGetPosition();
+    Time now = Simulator::Now();
+    if (m_cachedPositionValid && m_cachedPositionTime == now)
+    {
+        return m_cachedPosition;
+    }
+    // DoGetPosition () may notify a course change, so fill the cache after it
+    Vector position = DoGetPosition();
+    m_cachedPosition = position;
+    m_cachedPositionTime = now;
+    m_cachedPositionValid = true;
+    return position;
 }
 
 Vector
@@ -92,13 +104,15 @@ void
 MobilityModel::SetPosition(const Vector& position)
 {
     DoSetPosition(position);
+    // not all the models notify a course change when the position is set
+    InvalidatePositionCache();
 }
 
 double
 MobilityModel::GetDistanceFrom(Ptr<const MobilityModel> other) const
 {
-    Vector oPosition = other->DoGetPosition();
-    Vector position = DoGetPosition();
+    Vector oPosition = other->GetPosition();
+    Vector position = GetPosition();
     return CalculateDistance(position, oPosition);
 }
 
@@ -111,9 +125,16 @@ MobilityModel::GetRelativeSpeed(Ptr<const MobilityModel> other) const
 void
 MobilityModel::NotifyCourseChange() const
 {
+    InvalidatePositionCache();
     m_courseChangeTrace(this);
 }
 
+void
+MobilityModel::InvalidatePositionCache() const
+{
+    m_cachedPositionValid = false;
+}
+
 int64_t
 MobilityModel::AssignStreams(int64_t start)
 {
@@ -19,6 +19,7 @@
 #ifndef MOBILITY_MODEL_H
 #define MOBILITY_MODEL_H
 
+#include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/traced-callback.h"
 #include "ns3/vector.h"
@@ -48,6 +49,9 @@ class MobilityModel : public Object
     ~MobilityModel() override = 0;
 
     /**
+     * The position is computed at most once per simulation time: later calls
+     * at the same time return the cached value until the next course change.
+     *
      * \return the current position
      */
     Vector GetPosition() const;
@@ -104,6 +108,11 @@ class MobilityModel : public Object
      * position changes to notify course change listeners.
      */
     void NotifyCourseChange() const;
+    /**
+     * Must be invoked by subclasses when the position at the current time
+     * changes without a course change being notified.
+     */
+    void InvalidatePositionCache() const;
 
   private:
     /**
@@ -149,6 +158,10 @@ class MobilityModel : public Object
      * or position has occurred.
      */
     ns3::TracedCallback<Ptr<const MobilityModel>> m_courseChangeTrace;
+
+    mutable Vector m_cachedPosition;    //!< position returned by the last GetPosition ()
+    mutable Time m_cachedPositionTime;  //!< simulation time of m_cachedPosition
+    mutable bool m_cachedPositionValid; //!< whether m_cachedPosition may be returned
 };
 
 } // namespace ns3
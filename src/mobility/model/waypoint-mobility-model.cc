@@ -99,6 +99,8 @@ WaypointMobilityModel::AddWaypoint(const Waypoint& waypoint)
                         "Waypoints must be added in ascending time order");
         m_waypoints.push_back(waypoint);
     }
+    // the waypoint may move the node at the current time
+    InvalidatePositionCache();
 
     if (!m_lazyNotify)
     {
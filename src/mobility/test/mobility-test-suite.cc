@@ -23,8 +23,12 @@
  */
 
 #include "ns3/boolean.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/hierarchical-mobility-model.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/mobility-model.h"
+#include "ns3/random-walk-2d-mobility-model.h"
 #include "ns3/scheduler.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
@@ -472,6 +476,132 @@ WaypointMobilityModelViaHelper::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup mobility-test
+ *
+ * \brief Test that the positions cached by MobilityModel::GetPosition () match
+ * the ones computed by the models, including after a course change or a
+ * position change at the same simulation time
+ */
+class MobilityPositionCacheTestCase : public TestCase
+{
+  public:
+    MobilityPositionCacheTestCase();
+    ~MobilityPositionCacheTestCase() override;
+
+  private:
+    /**
+     * Check that the cached position matches the uncached one
+     * \param model the mobility model
+     * \return the position of the model
+     */
+    Vector CheckCachedPosition(Ptr<const MobilityModel> model);
+    /**
+     * Check the cached position against its expected value
+     * \param model the mobility model
+     * \param expectedPos the expected position
+     */
+    void TestPosition(Ptr<const MobilityModel> model, Vector expectedPos);
+    void DoRun() override;
+};
+
+MobilityPositionCacheTestCase::MobilityPositionCacheTestCase()
+    : TestCase("Test the position cache of the mobility models")
+{
+}
+
+MobilityPositionCacheTestCase::~MobilityPositionCacheTestCase()
+{
+}
+
+Vector
+MobilityPositionCacheTestCase::CheckCachedPosition(Ptr<const MobilityModel> model)
+{
+    Vector pos = model->GetPosition();
+    Vector cached = model->GetPosition();
+    // GetPositionWithReference () is not cached
+    Vector uncached = model->GetPositionWithReference(Vector());
+    NS_TEST_EXPECT_MSG_EQ(cached, pos, "Cached position differs from the first query");
+    NS_TEST_EXPECT_MSG_EQ(cached, uncached, "Cached position differs from the uncached one");
+    return cached;
+}
+
+void
+MobilityPositionCacheTestCase::TestPosition(Ptr<const MobilityModel> model, Vector expectedPos)
+{
+    Vector pos = CheckCachedPosition(model);
+    NS_TEST_EXPECT_MSG_EQ_TOL(CalculateDistance(pos, expectedPos),
+                              0.0,
+                              0.001,
+                              "Position not equal");
+}
+
+void
+MobilityPositionCacheTestCase::DoRun()
+{
+    using Self = MobilityPositionCacheTestCase;
+
+    // Course and position changes of a model at the time of a cached query
+    Ptr<ConstantVelocityMobilityModel> cv = CreateObject<ConstantVelocityMobilityModel>();
+    cv->SetVelocity(Vector(1.0, 0.0, 0.0));
+    Simulator::Schedule(Seconds(1.0), &Self::TestPosition, this, cv, Vector(1.0, 0.0, 0.0));
+    Simulator::Schedule(Seconds(1.0), &MobilityModel::SetPosition, cv, Vector(5.0, 5.0, 0.0));
+    Simulator::Schedule(Seconds(1.0), &Self::TestPosition, this, cv, Vector(5.0, 5.0, 0.0));
+    Simulator::Schedule(Seconds(1.0),
+                        &ConstantVelocityMobilityModel::SetVelocity,
+                        cv,
+                        Vector(0.0, 1.0, 0.0));
+    Simulator::Schedule(Seconds(1.0), &Self::TestPosition, this, cv, Vector(5.0, 5.0, 0.0));
+    Simulator::Schedule(Seconds(2.0), &Self::TestPosition, this, cv, Vector(5.0, 6.0, 0.0));
+
+    // Changes of the parent and of the child of a hierarchical model
+    Ptr<ConstantVelocityMobilityModel> parent = CreateObject<ConstantVelocityMobilityModel>();
+    parent->SetPosition(Vector(10.0, 0.0, 0.0));
+    parent->SetVelocity(Vector(1.0, 0.0, 0.0));
+    Ptr<ConstantPositionMobilityModel> child = CreateObject<ConstantPositionMobilityModel>();
+    child->SetPosition(Vector(0.0, 1.0, 0.0));
+    Ptr<HierarchicalMobilityModel> hier = CreateObject<HierarchicalMobilityModel>();
+    hier->SetParent(parent);
+    hier->SetChild(child);
+    Simulator::Schedule(Seconds(1.0), &Self::TestPosition, this, hier, Vector(11.0, 1.0, 0.0));
+    Simulator::Schedule(Seconds(1.0),
+                        &MobilityModel::SetPosition,
+                        parent,
+                        Vector(20.0, 0.0, 0.0));
+    Simulator::Schedule(Seconds(1.0), &Self::TestPosition, this, hier, Vector(20.0, 1.0, 0.0));
+    Simulator::Schedule(Seconds(1.0), &MobilityModel::SetPosition, child, Vector(0.0, 2.0, 0.0));
+    Simulator::Schedule(Seconds(1.0), &Self::TestPosition, this, hier, Vector(20.0, 2.0, 0.0));
+    // setting the position of the parent has stopped it
+    Simulator::Schedule(Seconds(2.0), &Self::TestPosition, this, hier, Vector(20.0, 2.0, 0.0));
+
+    // Waypoints added at the time of a cached query
+    Ptr<WaypointMobilityModel> wp = CreateObject<WaypointMobilityModel>();
+    Simulator::Schedule(Seconds(1.0), &Self::TestPosition, this, wp, Vector(0.0, 0.0, 0.0));
+    Simulator::Schedule(Seconds(1.0),
+                        &WaypointMobilityModel::AddWaypoint,
+                        wp,
+                        Waypoint(Seconds(1.0), Vector(3.0, 0.0, 0.0)));
+    Simulator::Schedule(Seconds(1.0),
+                        &WaypointMobilityModel::AddWaypoint,
+                        wp,
+                        Waypoint(Seconds(3.0), Vector(5.0, 0.0, 0.0)));
+    Simulator::Schedule(Seconds(1.0), &Self::TestPosition, this, wp, Vector(3.0, 0.0, 0.0));
+    Simulator::Schedule(Seconds(2.0), &Self::TestPosition, this, wp, Vector(4.0, 0.0, 0.0));
+
+    // A model which does not notify a course change when its position is set
+    Ptr<RandomWalk2dMobilityModel> rw = CreateObject<RandomWalk2dMobilityModel>();
+    rw->SetPosition(Vector(50.0, 50.0, 0.0));
+    rw->Initialize();
+    Simulator::Schedule(Seconds(1.0), &Self::CheckCachedPosition, this, rw);
+    Simulator::Schedule(Seconds(1.0), &MobilityModel::SetPosition, rw, Vector(70.0, 70.0, 0.0));
+    Simulator::Schedule(Seconds(1.0), &Self::TestPosition, this, rw, Vector(70.0, 70.0, 0.0));
+    Simulator::Schedule(Seconds(1.5), &Self::CheckCachedPosition, this, rw);
+
+    Simulator::Stop(Seconds(3.0));
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup mobility-test
  *
@@ -490,6 +620,7 @@ MobilityTestSuite::MobilityTestSuite()
     AddTestCase(new WaypointLazyNotifyTrue, TestCase::QUICK);
     AddTestCase(new WaypointInitialPositionIsWaypoint, TestCase::QUICK);
     AddTestCase(new WaypointMobilityModelViaHelper, TestCase::QUICK);
+    AddTestCase(new MobilityPositionCacheTestCase, TestCase::QUICK);
 }
 
 /**
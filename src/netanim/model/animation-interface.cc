@@ -77,6 +77,8 @@ AnimationInterface::AnimationInterface(const std::string fn)
     : m_f(nullptr),
       m_routingF(nullptr),
       m_mobilityPollInterval(Seconds(0.25)),
+      m_courseChangeDrivenMobility(false),
+      m_movingNodesScanned(false),
       m_outputFileName(fn),
       gAnimUid(0),
       m_writeCallback(nullptr),
@@ -321,6 +323,14 @@ AnimationInterface::SetMobilityPollInterval(Time t)
     m_mobilityPollInterval = t;
 }
 
+void
+AnimationInterface::EnableCourseChangeDrivenMobility(bool enable)
+{
+    m_courseChangeDrivenMobility = enable;
+    m_movingNodesScanned = false;
+    m_movingNodes.clear();
+}
+
 void
 AnimationInterface::SetConstantPosition(Ptr<Node> n, double x, double y, double z)
 {
@@ -448,9 +458,14 @@ AnimationInterface::GetNodeEnergyFraction(Ptr<const Node> node) const
 void
 AnimationInterface::MobilityCourseChangeTrace(Ptr<const MobilityModel> mobility)
 {
-    CHECK_STARTED_INTIMEWINDOW;
     Ptr<Node> n = mobility->GetObject<Node>();
     NS_ASSERT(n);
+    if (m_courseChangeDrivenMobility)
+    {
+        // track the moving nodes even outside of the time window
+        UpdateMovingNode(n->GetId(), mobility);
+    }
+    CHECK_STARTED_INTIMEWINDOW;
     Vector v;
     if (!mobility)
     {
@@ -496,10 +511,51 @@ AnimationInterface::MobilityAutoCheck()
     }
 }
 
+void
+AnimationInterface::UpdateMovingNode(uint32_t nodeId, Ptr<const MobilityModel> mobility)
+{
+    if (mobility->GetVelocity() == Vector())
+    {
+        m_movingNodes.erase(nodeId);
+    }
+    else
+    {
+        m_movingNodes[nodeId] = mobility;
+    }
+}
+
 std::vector<Ptr<Node>>
 AnimationInterface::GetMovedNodes()
 {
     std::vector<Ptr<Node>> movedNodes;
+    if (m_courseChangeDrivenMobility)
+    {
+        if (!m_movingNodesScanned)
+        {
+            // the course changes notified from now on keep the moving nodes up to date
+            m_movingNodesScanned = true;
+            for (auto i = NodeList::Begin(); i != NodeList::End(); ++i)
+            {
+                Ptr<MobilityModel> mobility = (*i)->GetObject<MobilityModel>();
+                if (mobility)
+                {
+                    UpdateMovingNode((*i)->GetId(), mobility);
+                }
+            }
+        }
+        for (const auto& movingNode : m_movingNodes)
+        {
+            Ptr<Node> n = NodeList::GetNode(movingNode.first);
+            Vector newLocation = movingNode.second->GetPosition();
+            if (NodeHasMoved(n, newLocation))
+            {
+                UpdatePosition(n, newLocation);
+                movedNodes.push_back(n);
+            }
+        }
+        return movedNodes;
+    }
+
     for (auto i = NodeList::Begin(); i != NodeList::End(); ++i)
     {
         Ptr<Node> n = *i;
@@ -2097,6 +2153,8 @@ AnimationInterface::SetOutputFile(const std::string& fn, bool routing)
         NS_FATAL_ERROR("Unable to open output file:" << fn);
         return; // Can't open output file
     }
+    // the elements are written one by one: buffer them to write the file in large blocks
+    std::setvbuf(f, nullptr, _IOFBF, TRACE_FILE_BUFFER_SIZE);
     if (routing)
     {
         m_routingF = f;
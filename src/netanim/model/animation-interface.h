@@ -49,6 +49,7 @@ namespace ns3
 {
 
 #define MAX_PKTS_PER_TRACE_FILE 100000
+#define TRACE_FILE_BUFFER_SIZE (1 << 20)
 #define PURGE_INTERVAL 5
 #define NETANIM_VERSION "netanim-3.109"
 #define CHECK_STARTED_INTIMEWINDOW                                                                 \
@@ -236,6 +237,21 @@ class AnimationInterface
      */
     void SetMobilityPollInterval(Time t);
 
+    /**
+     * \brief Poll the position of the moving nodes only
+     *
+     * By default, the position of all the nodes is polled at each mobility
+     * poll interval. With this option, only the nodes whose mobility model
+     * had a non-zero velocity at its last course change are polled, and the
+     * position of the other nodes is written when their mobility model
+     * notifies a course change. This option must not be used with mobility
+     * models which change their velocity without notifying a course change.
+     *
+     * \param enable true to poll the moving nodes only
+     *
+     */
+    void EnableCourseChangeDrivenMobility(bool enable = true);
+
     /**
      * \brief Set a callback function to listen to AnimationInterface write events
      *
@@ -619,6 +635,10 @@ class AnimationInterface
     FILE* m_f;                             ///< File handle for output (0 if none)
     FILE* m_routingF;                      ///< File handle for routing table output (0 if None);
     Time m_mobilityPollInterval;           ///< mobility poll interval
+    bool m_courseChangeDrivenMobility;     ///< poll the position of the moving nodes only
+    bool m_movingNodesScanned;             ///< moving nodes looked up in the node list
+    std::map<uint32_t, Ptr<const MobilityModel>>
+        m_movingNodes; ///< mobility model of the moving nodes, by node ID
     std::string m_outputFileName;          ///< output file name
     uint64_t gAnimUid;                     ///< Packet unique identifier used by AnimationInterface
     AnimWriteCallback m_writeCallback;     ///< write callback
@@ -1251,6 +1271,13 @@ class AnimationInterface
      * \returns the list of moved nodes
      */
     std::vector<Ptr<Node>> GetMovedNodes();
+    /**
+     * Add a node to the moving nodes if its mobility model has a non-zero
+     * velocity, or remove it otherwise
+     * \param nodeId the node ID
+     * \param mobility the mobility model of the node
+     */
+    void UpdateMovingNode(uint32_t nodeId, Ptr<const MobilityModel> mobility);
     /**
      * Mobility course change trace function
      * \param mob the mobility model
@@ -20,6 +20,7 @@
 #include "unistd.h"
 
 #include "ns3/basic-energy-source.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/core-module.h"
 #include "ns3/internet-module.h"
 #include "ns3/netanim-module.h"
@@ -70,6 +71,9 @@ class AbstractAnimationInterfaceTestCase : public TestCase
     /// Check logic function
     virtual void CheckLogic() = 0;
 
+    /// Configure the animation, once created
+    virtual void ConfigureAnimation();
+
     /// Check file existence
     virtual void CheckFileExistence();
 
@@ -94,6 +98,7 @@ AbstractAnimationInterfaceTestCase::DoRun()
     PrepareNetwork();
 
     m_anim = new AnimationInterface(m_traceFileName);
+    ConfigureAnimation();
 
     Simulator::Run();
     CheckLogic();
@@ -101,6 +106,11 @@ AbstractAnimationInterfaceTestCase::DoRun()
     Simulator::Destroy();
 }
 
+void
+AbstractAnimationInterfaceTestCase::ConfigureAnimation()
+{
+}
+
 void
 AbstractAnimationInterfaceTestCase::CheckFileExistence()
 {
@@ -239,6 +249,103 @@ AnimationRemainingEnergyTestCase::CheckLogic()
                               "Wrong remaining energy value was traced");
 }
 
+/**
+ * \ingroup netanim-test
+ *
+ * \brief Animation Course Change Driven Mobility Test Case: the position
+ * updates of a node moving for a while, among static nodes, must be the same
+ * whether all the nodes or only the moving ones are polled.
+ */
+class AnimationCourseChangeDrivenMobilityTestCase : public AbstractAnimationInterfaceTestCase
+{
+  public:
+    /**
+     * \brief Constructor.
+     * \param courseChangeDriven whether only the moving nodes are polled
+     */
+    AnimationCourseChangeDrivenMobilityTestCase(bool courseChangeDriven);
+
+  private:
+    void PrepareNetwork() override;
+
+    void ConfigureAnimation() override;
+
+    void CheckLogic() override;
+
+    /**
+     * Count the position updates written by the animation interface
+     * \param str the string written
+     */
+    static void CountPositionUpdates(const char* str);
+
+    static std::map<uint32_t, uint32_t> m_positionUpdates; ///< position updates by node ID
+    bool m_courseChangeDriven;                             ///< poll the moving nodes only
+};
+
+std::map<uint32_t, uint32_t> AnimationCourseChangeDrivenMobilityTestCase::m_positionUpdates;
+
+AnimationCourseChangeDrivenMobilityTestCase::AnimationCourseChangeDrivenMobilityTestCase(
+    bool courseChangeDriven)
+    : AbstractAnimationInterfaceTestCase(std::string("Verify position updates, ") +
+                                         (courseChangeDriven ? "moving nodes polled"
+                                                             : "all nodes polled")),
+      m_courseChangeDriven(courseChangeDriven)
+{
+}
+
+void
+AnimationCourseChangeDrivenMobilityTestCase::CountPositionUpdates(const char* str)
+{
+    std::string element(str);
+    if (element.find("<nu p=\"p\"") == std::string::npos)
+    {
+        return;
+    }
+    std::size_t id = element.find("id=\"");
+    if (id != std::string::npos)
+    {
+        m_positionUpdates[std::stoul(element.substr(id + 4))]++;
+    }
+}
+
+void
+AnimationCourseChangeDrivenMobilityTestCase::PrepareNetwork()
+{
+    m_positionUpdates.clear();
+    m_nodes.Create(3);
+    AnimationInterface::SetConstantPosition(m_nodes.Get(0), 0, 10);
+    AnimationInterface::SetConstantPosition(m_nodes.Get(1), 1, 10);
+    Ptr<ConstantVelocityMobilityModel> mobility = CreateObject<ConstantVelocityMobilityModel>();
+    mobility->SetPosition(Vector(0, 0, 0));
+    mobility->SetVelocity(Vector(10, 0, 0));
+    m_nodes.Get(2)->AggregateObject(mobility);
+
+    // the node moves during three mobility polls, then stops
+    Simulator::Schedule(Seconds(0.9),
+                        &ConstantVelocityMobilityModel::SetVelocity,
+                        mobility,
+                        Vector(0, 0, 0));
+    Simulator::Stop(Seconds(2));
+}
+
+void
+AnimationCourseChangeDrivenMobilityTestCase::ConfigureAnimation()
+{
+    m_anim->EnableCourseChangeDrivenMobility(m_courseChangeDriven);
+    m_anim->SetAnimWriteCallback(
+        &AnimationCourseChangeDrivenMobilityTestCase::CountPositionUpdates);
+}
+
+void
+AnimationCourseChangeDrivenMobilityTestCase::CheckLogic()
+{
+    NS_TEST_EXPECT_MSG_EQ(m_positionUpdates[0], 0, "Static node 0 should not be updated");
+    NS_TEST_EXPECT_MSG_EQ(m_positionUpdates[1], 0, "Static node 1 should not be updated");
+    NS_TEST_EXPECT_MSG_EQ(m_positionUpdates[2],
+                          4,
+                          "Moving node should be updated by three polls and its course change");
+}
+
 /**
  * \ingroup netanim-test
  *
@@ -252,5 +359,7 @@ static class AnimationInterfaceTestSuite : public TestSuite
     {
         AddTestCase(new AnimationInterfaceTestCase(), TestCase::QUICK);
         AddTestCase(new AnimationRemainingEnergyTestCase(), TestCase::QUICK);
+        AddTestCase(new AnimationCourseChangeDrivenMobilityTestCase(false), TestCase::QUICK);
+        AddTestCase(new AnimationCourseChangeDrivenMobilityTestCase(true), TestCase::QUICK);
     }
 } g_animationInterfaceTestSuite; ///< the test suite
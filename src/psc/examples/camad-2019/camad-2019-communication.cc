@@ -45,6 +45,10 @@
 #include "ns3/point-to-point-module.h"
 #include "ns3/psc-module.h"
 
+#ifndef __WIN32__
+#include "ns3/parameter-sweep.h"
+#endif
+
 #include <cfloat>
 #include <sstream>
 
@@ -88,9 +92,16 @@ UePacketTrace(Ptr<OutputStreamWrapper> stream,
  * - the sildelink communication period (slPeriod)
  * - the UE that is transmitting (txType)
  * - the time the traffic is active (appDurationTime)
+ *
+ * Several configurations and RNG runs can be run in parallel with the
+ * ParameterSweep arguments (except on Windows), e.g.,
+ *   ./ns3 run "camad-2019-communication --sweepFile=configs.txt --sweepRuns=20"
+ * where each line of configs.txt is a configuration name followed by its
+ * arguments, e.g.,
+ *   txType-Relay_slPeriod-40 --txType=Relay --slPeriod=40 --appDurationTime=10
  */
-int
-main(int argc, char* argv[])
+static int
+RunSimulation(int argc, char* argv[])
 {
     double simTime = 20.0; // Simulation time (in seconds) updated automatically based on number of
                            // nodes and traffic duration
@@ -655,3 +666,14 @@ main(int argc, char* argv[])
     Simulator::Destroy();
     return 0;
 }
+
+int
+main(int argc, char* argv[])
+{
+#ifndef __WIN32__
+    return ParameterSweep::Main(argc, argv, &RunSimulation);
+#else
+    // ParameterSweep is not available on Windows: run a single simulation
+    return RunSimulation(argc, argv);
+#endif
+}
@@ -515,7 +515,7 @@ LteSlUeControllerCamad2019::DoRecvRemoteUeReport(uint64_t localImsi,
 }
 
 uint64_t
-LteSlUeControllerCamad2019::DoRelayUeSelection(std::map<uint64_t, double> validRelays,
+LteSlUeControllerCamad2019::DoRelayUeSelection(const LteSlRelayCandidateTable& validRelays,
                                                uint32_t serviceCode,
                                                uint64_t currentRelayId)
 {
@@ -552,12 +552,10 @@ LteSlUeControllerCamad2019::DoRelayUeSelection(std::map<uint64_t, double> validR
 
         if (currentRelayId == 0)
         {
-            NS_LOG_INFO(validRelays.size() << " valid Relay UEs");
-            if (!validRelays.empty())
+            NS_LOG_INFO(validRelays.GetSize() << " valid Relay UEs");
+            if (!validRelays.IsEmpty())
             {
-                std::map<uint64_t, double>::iterator vaReIt;
-                vaReIt = validRelays.begin();
-                selectedRelayId = vaReIt->first;
+                selectedRelayId = validRelays.GetRelayId(0);
 
                 if (m_campaign == "Connection")
                 {
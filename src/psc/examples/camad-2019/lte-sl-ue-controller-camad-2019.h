@@ -158,7 +158,7 @@ class LteSlUeControllerCamad2019 : public LteSlUeController
                                         LteSlUeRrc::RelayRole role,
                                         LteSlO2oCommParams::UeO2ORejectReason reason);
     virtual void DoRecvRemoteUeReport(uint64_t localImsi, uint32_t peerUeId, uint64_t remoteImsi);
-    virtual uint64_t DoRelayUeSelection(std::map<uint64_t, double> validRelays,
+    virtual uint64_t DoRelayUeSelection(const LteSlRelayCandidateTable& validRelays,
                                         uint32_t serviceCode,
                                         uint64_t currentRelayId);
 
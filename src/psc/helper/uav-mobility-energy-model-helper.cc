@@ -116,6 +116,21 @@ UavMobilityEnergyModelHelper::Install(NodeContainer& nodes, EnergySourceContaine
     return results;
 }
 
+std::vector<double>
+UavMobilityEnergyModelHelper::GetRemainingEnergy(const NodeContainer& nodes)
+{
+    NS_LOG_FUNCTION_NOARGS();
+    std::vector<double> remainingEnergy;
+    remainingEnergy.reserve(nodes.GetN());
+    for (auto node = nodes.Begin(); node != nodes.End(); node++)
+    {
+        auto energySource = (*node)->GetObject<EnergySource>();
+        NS_ABORT_MSG_IF(!energySource, "No EnergySource installed on node " << (*node)->GetId());
+        remainingEnergy.push_back(energySource->GetRemainingEnergy());
+    }
+    return remainingEnergy;
+}
+
 void
 UavMobilityEnergyModelHelper::SetMobilityModel(std::string name,
                                                std::string n0,
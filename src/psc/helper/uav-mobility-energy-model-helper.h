@@ -43,6 +43,8 @@
 #include <ns3/ptr.h>
 #include <ns3/uav-mobility-energy-model.h>
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -175,6 +177,23 @@ class UavMobilityEnergyModelHelper
      */
     DeviceEnergyModelContainer Install(NodeContainer& nodes, EnergySourceContainer& sources) const;
 
+    /**
+     * \brief Get the remaining energy of the EnergySource of each node
+     *
+     * The energy sources are updated at the current time, in the order of
+     * the nodes, e.g., to sample the state of all the UAVs at once. With
+     * the periodic updates of the energy sources disabled, the update of a
+     * source only integrates the current drawn since its last update.
+     *
+     * If no EnergySource is installed on any given node, then this method
+     * will abort
+     *
+     * \param nodes The collection of nodes
+     *
+     * \return The remaining energy of each node, in Joules
+     */
+    static std::vector<double> GetRemainingEnergy(const NodeContainer& nodes);
+
     /**
      * \param name the name of the model to set
      * \param n0 the name of the attribute to set
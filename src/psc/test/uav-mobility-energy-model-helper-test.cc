@@ -51,6 +51,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 /**
  * \ingroup psc-tests
@@ -245,6 +246,99 @@ UavMobilityEnergyModelHelperTestCollections::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup uav-mobility-energy-model-helper-tests
+ * Test the remaining energy of a collection of UAVs, with the periodic
+ * updates of the energy sources disabled
+ */
+class UavMobilityEnergyModelHelperTestRemainingEnergy : public TestCase
+{
+  public:
+    UavMobilityEnergyModelHelperTestRemainingEnergy();
+    void DoRun() override;
+
+  private:
+    /**
+     * Record the time at which the energy source of a UAV is depleted
+     * \param index the index of the UAV
+     * \param model the energy model of the UAV
+     */
+    void EnergyDepleted(uint32_t index, Ptr<const UavMobilityEnergyModel> model);
+
+    std::vector<double> m_remainingEnergy; //!< remaining energy of each UAV at 5 s
+    std::vector<Time> m_depletionTime;     //!< depletion time of each UAV
+};
+
+UavMobilityEnergyModelHelperTestRemainingEnergy::UavMobilityEnergyModelHelperTestRemainingEnergy()
+    : TestCase("UAV Mobility Energy Model Helper Test Case - Remaining Energy")
+{
+}
+
+void
+UavMobilityEnergyModelHelperTestRemainingEnergy::EnergyDepleted(
+    uint32_t index,
+    Ptr<const UavMobilityEnergyModel> model)
+{
+    m_depletionTime[index] = Simulator::Now();
+}
+
+void
+UavMobilityEnergyModelHelperTestRemainingEnergy::DoRun()
+{
+    NodeContainer nodes;
+    nodes.Create(3);
+
+    // 630 W when hovering with the default hover current and supply voltage
+    UavMobilityEnergyModelHelper helper;
+    helper.SetEnergySource("ns3::BasicEnergySource",
+                           "BasicEnergySourceInitialEnergyJ",
+                           DoubleValue(6300),
+                           "PeriodicEnergyUpdateInterval",
+                           TimeValue(Seconds(0)));
+    helper.SetMobilityModel("ns3::ConstantVelocityMobilityModel");
+    auto models = helper.Install(nodes);
+
+    // the first two UAVs hover, the last one is on the ground
+    m_depletionTime.assign(nodes.GetN(), Seconds(0));
+    for (uint32_t i = 0; i < nodes.GetN(); i++)
+    {
+        auto mobility = nodes.Get(i)->GetObject<ConstantVelocityMobilityModel>();
+        mobility->SetPosition(Vector(0, 0, i < 2 ? 10 : 0));
+        models.Get(i)->TraceConnectWithoutContext(
+            "EnergyDepleted",
+            MakeCallback(&UavMobilityEnergyModelHelperTestRemainingEnergy::EnergyDepleted, this)
+                .Bind(i));
+    }
+    // the second UAV moves at 1 m/s from 2 s, drawing 660 W
+    Simulator::Schedule(Seconds(2),
+                        &ConstantVelocityMobilityModel::SetVelocity,
+                        nodes.Get(1)->GetObject<ConstantVelocityMobilityModel>(),
+                        Vector(1, 0, 0));
+    Simulator::Schedule(Seconds(5), [this, &nodes]() {
+        m_remainingEnergy = UavMobilityEnergyModelHelper::GetRemainingEnergy(nodes);
+    });
+
+    Simulator::Stop(Seconds(10));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(m_remainingEnergy.size(), 3, "One remaining energy per node expected");
+    NS_TEST_ASSERT_MSG_EQ_TOL(m_remainingEnergy[0], 3150, 1e-6, "Wrong energy when hovering");
+    NS_TEST_ASSERT_MSG_EQ_TOL(m_remainingEnergy[1], 3060, 1e-6, "Wrong energy when moving");
+    NS_TEST_ASSERT_MSG_EQ_TOL(m_remainingEnergy[2], 6300, 1e-6, "Wrong energy when stopped");
+
+    // depleted at the low battery threshold, i.e., with 630 J left
+    NS_TEST_ASSERT_MSG_EQ_TOL(m_depletionTime[0].GetSeconds(),
+                              9,
+                              1e-6,
+                              "Wrong depletion time when hovering");
+    NS_TEST_ASSERT_MSG_EQ_TOL(m_depletionTime[1].GetSeconds(),
+                              2 + 4410.0 / 660,
+                              1e-6,
+                              "Wrong depletion time when moving");
+    NS_TEST_ASSERT_MSG_EQ(m_depletionTime[2].IsZero(), true, "No depletion expected when stopped");
+}
+
 /**
  * \ingroup uav-mobility-energy-model-helper-tests
  */
@@ -260,6 +354,7 @@ UavMobilityEnergyModelHelperTestSuite::UavMobilityEnergyModelHelperTestSuite()
     AddTestCase(new UavMobilityEnergyModelHelperTestOneNode());
     AddTestCase(new UavMobilityEnergyModelHelperTestFullSetup());
     AddTestCase(new UavMobilityEnergyModelHelperTestCollections());
+    AddTestCase(new UavMobilityEnergyModelHelperTestRemainingEnergy());
 }
 
 /**
@@ -40,6 +40,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <optional>
 #include <utility>
 
 namespace ns3
@@ -238,6 +239,7 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
     m_txSigParamsTrace(txParamsTrace);
 
     Ptr<MobilityModel> txMobility = txParams->txPhy->GetMobility();
+    std::optional<Vector> txPosition; // position of the transmitter, if needed
     SpectrumModelUid_t txSpectrumModelUid = txParams->psd->GetSpectrumModelUid();
     NS_LOG_LOGIC("txSpectrumModelUid " << txSpectrumModelUid);
 
@@ -322,18 +324,29 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                     double rxAntennaGain = 0;
                     double propagationGainDb = 0;
                     double pathLossDb = 0;
+                    Ptr<AntennaModel> rxAntenna =
+                        DynamicCast<AntennaModel>((*rxPhyIterator)->GetAntenna());
+                    Vector rxPosition;
+                    if (rxParams->txAntenna || rxAntenna)
+                    {
+                        // query each position once for both antenna gains, and the
+                        // transmitter position once for all the receivers
+                        if (!txPosition)
+                        {
+                            txPosition = txMobility->GetPosition();
+                        }
+                        rxPosition = receiverMobility->GetPosition();
+                    }
                     if (rxParams->txAntenna)
                     {
-                        Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
+                        Angles txAngles(rxPosition, *txPosition);
                         txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
                         NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
                         pathLossDb -= txAntennaGain;
                     }
-                    Ptr<AntennaModel> rxAntenna =
-                        DynamicCast<AntennaModel>((*rxPhyIterator)->GetAntenna());
                     if (rxAntenna)
                     {
-                        Angles rxAngles(txMobility->GetPosition(), receiverMobility->GetPosition());
+                        Angles rxAngles(*txPosition, rxPosition);
                         rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
                         NS_LOG_LOGIC("rxAntennaGain = " << rxAntennaGain << " dB");
                         pathLossDb -= rxAntennaGain;
@@ -38,6 +38,7 @@
 #include <ns3/simulator.h>
 
 #include <algorithm>
+#include <optional>
 
 namespace ns3
 {
@@ -118,6 +119,7 @@ SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
     }
 
     Ptr<MobilityModel> senderMobility = txParams->txPhy->GetMobility();
+    std::optional<Vector> txPosition; // position of the sender, if needed
 
     for (auto rxPhyIterator = m_phyList.begin(); rxPhyIterator != m_phyList.end(); ++rxPhyIterator)
     {
@@ -154,18 +156,29 @@ SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                 double rxAntennaGain = 0;
                 double propagationGainDb = 0;
                 double pathLossDb = 0;
+                Ptr<AntennaModel> rxAntenna =
+                    DynamicCast<AntennaModel>((*rxPhyIterator)->GetAntenna());
+                Vector rxPosition;
+                if (rxParams->txAntenna || rxAntenna)
+                {
+                    // query each position once for both antenna gains, and the
+                    // transmitter position once for all the receivers
+                    if (!txPosition)
+                    {
+                        txPosition = senderMobility->GetPosition();
+                    }
+                    rxPosition = receiverMobility->GetPosition();
+                }
                 if (rxParams->txAntenna)
                 {
-                    Angles txAngles(receiverMobility->GetPosition(), senderMobility->GetPosition());
+                    Angles txAngles(rxPosition, *txPosition);
                     txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
                     NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
                     pathLossDb -= txAntennaGain;
                 }
-                Ptr<AntennaModel> rxAntenna =
-                    DynamicCast<AntennaModel>((*rxPhyIterator)->GetAntenna());
                 if (rxAntenna)
                 {
-                    Angles rxAngles(senderMobility->GetPosition(), receiverMobility->GetPosition());
+                    Angles rxAngles(*txPosition, rxPosition);
                     rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
                     NS_LOG_LOGIC("rxAntennaGain = " << rxAntennaGain << " dB");
                     pathLossDb -= rxAntennaGain;
@@ -1086,6 +1086,38 @@ ThreeGppChannelModel::ChannelMatrixNeedsUpdate(Ptr<const ThreeGppChannelParams>
     return channelParams->m_generatedTime > channelMatrix->m_generatedTime;
 }
 
+void
+ThreeGppChannelModel::PurgeExpiredChannels()
+{
+    NS_LOG_FUNCTION(this);
+
+    for (auto it = m_channelParamsMap.begin(); it != m_channelParamsMap.end();)
+    {
+        if (Simulator::Now() - it->second->m_generatedTime > m_updatePeriod)
+        {
+            it = m_channelParamsMap.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    for (auto it = m_channelMatrixMap.begin(); it != m_channelMatrixMap.end();)
+    {
+        if (Simulator::Now() - it->second->m_generatedTime > m_updatePeriod)
+        {
+            it = m_channelMatrixMap.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    m_lastPurgeTime = Simulator::Now();
+    NS_LOG_DEBUG("Channels after purge: " << m_channelParamsMap.size() << " params, "
+                                          << m_channelMatrixMap.size() << " matrices");
+}
+
 Ptr<const MatrixBasedChannelModel::ChannelMatrix>
 ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
                                  Ptr<const MobilityModel> bMob,
@@ -1094,6 +1126,13 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
 {
     NS_LOG_FUNCTION(this);
 
+    // Drop the channels of the pairs which were not used during the last update
+    // period, they would be regenerated anyway.
+    if (!m_updatePeriod.IsZero() && Simulator::Now() - m_lastPurgeTime > m_updatePeriod)
+    {
+        PurgeExpiredChannels();
+    }
+
     // Compute the channel params key. The key is reciprocal, i.e., key (a, b) = key (b, a)
     uint64_t channelParamsKey =
         GetKey(aMob->GetObject<Node>()->GetId(), bMob->GetObject<Node>()->GetId());
@@ -1982,18 +2021,55 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
         }
     }
 
+    // cache the location of the antenna elements
+    std::vector<Vector> uLocs(uSize);
+    for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+    {
+        uLocs[uIndex] = uAntenna->GetElementLocation(uIndex);
+    }
+    std::vector<Vector> sLocs(sSize);
+    for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+    {
+        sLocs[sIndex] = sAntenna->GetElementLocation(sIndex);
+    }
+
+    // phase rotations of the rays of a cluster at each receive and transmit element,
+    // they only depend on one of the two elements and are thus computed once per cluster
+    Complex2DVector rxPhases(uSize, table3gpp->m_raysPerCluster);
+    Complex2DVector txPhases(sSize, table3gpp->m_raysPerCluster);
+
     // The following for loops computes the channel coefficients
     // Keeps track of how many sub-clusters have been added up to now
     uint8_t numSubClustersAdded = 0;
     for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
     {
-        for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+        for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
+            for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+            {
+                // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
+                const Vector& uLoc = uLocs[uIndex];
+                double rxPhaseDiff =
+                    2 * M_PI *
+                    (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
+                     cosZoA[nIndex][mIndex] * uLoc.z);
+                rxPhases(uIndex, mIndex) = std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff));
+            }
+            for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+            {
+                const Vector& sLoc = sLocs[sIndex];
+                double txPhaseDiff =
+                    2 * M_PI *
+                    (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
+                     cosZoD[nIndex][mIndex] * sLoc.z);
+                txPhases(sIndex, mIndex) = std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+            }
+        }
 
+        for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+        {
             for (size_t sIndex = 0; sIndex < sSize; sIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
                 // Compute the N-2 weakest cluster, assuming 0 slant angle and a
                 // polarization slant angle configured in the array (7.5-22)
                 if (nIndex != channelParams->m_cluster1st && nIndex != channelParams->m_cluster2nd)
@@ -2001,22 +2077,10 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                     std::complex<double> rays(0, 0);
                     for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
                     {
-                        // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
-                        double rxPhaseDiff =
-                            2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
-
-                        double txPhaseDiff =
-                            2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
-
                         // NOTE Doppler is computed in the CalcBeamformingGain function and is
                         // simplified to only account for the center angle of each cluster.
-                        rays += raysPreComp(nIndex, mIndex) *
-                                std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                                std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+                        rays += raysPreComp(nIndex, mIndex) * rxPhases(uIndex, mIndex) *
+                                txPhases(sIndex, mIndex);
                     }
                     rays *=
                         sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
@@ -2032,20 +2096,9 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                     {
                         // ZML:Just remind me that the angle offsets for the 3 subclusters were not
                         // generated correctly.
-                        double rxPhaseDiff =
-                            2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
-
-                        double txPhaseDiff =
-                            2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
-
-                        std::complex<double> raySub =
-                            raysPreComp(nIndex, mIndex) *
-                            std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                            std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+                        std::complex<double> raySub = raysPreComp(nIndex, mIndex) *
+                                                      rxPhases(uIndex, mIndex) *
+                                                      txPhases(sIndex, mIndex);
 
                         switch (mIndex)
                         {
@@ -2106,34 +2159,35 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
         const double sinSAngleAz = sin(sAngle.GetAzimuth());
         const double cosSAngleAz = cos(sAngle.GetAzimuth());
 
+        // the field patterns of the elements only depend on the LOS angles
+        auto [rxFieldPatternPhi, rxFieldPatternTheta] =
+            uAntenna->GetElementFieldPattern(Angles(uAngle.GetAzimuth(), uAngle.GetInclination()));
+        auto [txFieldPatternPhi, txFieldPatternTheta] =
+            sAntenna->GetElementFieldPattern(Angles(sAngle.GetAzimuth(), sAngle.GetInclination()));
+        double kLinear = pow(10, channelParams->m_K_factor / 10.0);
+
         for (size_t uIndex = 0; uIndex < uSize; uIndex++)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
+            const Vector& uLoc = uLocs[uIndex];
             double rxPhaseDiff = 2 * M_PI *
                                  (sinUAngleIncl * cosUAngleAz * uLoc.x +
                                   sinUAngleIncl * sinUAngleAz * uLoc.y + cosUAngleIncl * uLoc.z);
 
             for (size_t sIndex = 0; sIndex < sSize; sIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
+                const Vector& sLoc = sLocs[sIndex];
                 std::complex<double> ray(0, 0);
                 double txPhaseDiff =
                     2 * M_PI *
                     (sinSAngleIncl * cosSAngleAz * sLoc.x + sinSAngleIncl * sinSAngleAz * sLoc.y +
                      cosSAngleIncl * sLoc.z);
 
-                auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna->GetElementFieldPattern(
-                    Angles(uAngle.GetAzimuth(), uAngle.GetInclination()));
-                auto [txFieldPatternPhi, txFieldPatternTheta] = sAntenna->GetElementFieldPattern(
-                    Angles(sAngle.GetAzimuth(), sAngle.GetInclination()));
-
                 ray = (rxFieldPatternTheta * txFieldPatternTheta -
                        rxFieldPatternPhi * txFieldPatternPhi) *
                       phaseDiffDueToDistance *
                       std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
                       std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
 
-                double kLinear = pow(10, channelParams->m_K_factor / 10.0);
                 // the LOS path should be attenuated if blockage is enabled.
                 hUsn(uIndex, sIndex, 0) =
                     sqrt(1.0 / (kLinear + 1)) * hUsn(uIndex, sIndex, 0) +
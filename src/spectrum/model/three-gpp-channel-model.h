@@ -335,6 +335,14 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
     bool ChannelMatrixNeedsUpdate(Ptr<const ThreeGppChannelParams> channelParams,
                                   Ptr<const ChannelMatrix> channelMatrix);
 
+    /**
+     * Remove the channel params and the channel matrices generated more than an
+     * update period ago. Since they would be regenerated at their next use anyway,
+     * this does not change the channel realizations, but bounds the memory to the
+     * pairs of nodes and antennas which were active during the last update period.
+     */
+    void PurgeExpiredChannels();
+
     std::unordered_map<uint64_t, Ptr<ChannelMatrix>>
         m_channelMatrixMap; //!< map containing the channel realizations per pair of
                             //!< PhasedAntennaArray instances, the key of this map is reciprocal
@@ -344,6 +352,7 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
                             //!< key of this map is reciprocal and uniquely identifies a pair of
                             //!< nodes
     Time m_updatePeriod;    //!< the channel update period
+    Time m_lastPurgeTime;   //!< the last time expired channels were purged
     double m_frequency;     //!< the operating frequency
     std::string m_scenario; //!< the 3GPP scenario
     Ptr<ChannelConditionModel> m_channelConditionModel; //!< the channel condition model
@@ -434,6 +434,84 @@ ThreeGppChannelMatrixUpdateTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup spectrum-tests
+ *
+ * Test case for the ThreeGppChannelModel class.
+ * It checks that the channels of the pairs of nodes which are not used
+ * anymore are removed after the update period, while the channels of the
+ * active pairs are kept.
+ */
+class ThreeGppChannelPurgeTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    ThreeGppChannelPurgeTest();
+
+  private:
+    /**
+     * Build the test scenario
+     */
+    void DoRun() override;
+};
+
+ThreeGppChannelPurgeTest::ThreeGppChannelPurgeTest()
+    : TestCase("Check if the unused channel realizations are removed after the update period")
+{
+}
+
+void
+ThreeGppChannelPurgeTest::DoRun()
+{
+    Ptr<ThreeGppChannelModel> channelModel = CreateObject<ThreeGppChannelModel>();
+    channelModel->SetAttribute("Frequency", DoubleValue(60.0e9));
+    channelModel->SetAttribute("Scenario", StringValue("UMa"));
+    channelModel->SetAttribute("ChannelConditionModel",
+                               PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    channelModel->SetAttribute("UpdatePeriod", TimeValue(MilliSeconds(100)));
+
+    NodeContainer nodes;
+    nodes.Create(3);
+    std::vector<Ptr<MobilityModel>> mobs;
+    std::vector<Ptr<PhasedArrayModel>> antennas;
+    for (uint32_t i = 0; i < nodes.GetN(); i++)
+    {
+        Ptr<MobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        mob->SetPosition(Vector(50.0 * i, 0.0, i == 0 ? 10.0 : 1.6));
+        nodes.Get(i)->AggregateObject(mob);
+        mobs.push_back(mob);
+        antennas.push_back(CreateObjectWithAttributes<UniformPlanarArray>(
+            "NumColumns",
+            UintegerValue(2),
+            "NumRows",
+            UintegerValue(2),
+            "AntennaElement",
+            PointerValue(CreateObject<IsotropicAntennaModel>())));
+    }
+
+    // generate the channels of both pairs
+    Simulator::Schedule(MilliSeconds(1), [&]() {
+        channelModel->GetChannel(mobs[0], mobs[1], antennas[0], antennas[1]);
+        channelModel->GetChannel(mobs[0], mobs[2], antennas[0], antennas[2]);
+    });
+
+    // only use the first pair after the update period
+    Simulator::Schedule(MilliSeconds(150), [&]() {
+        channelModel->GetChannel(mobs[0], mobs[1], antennas[0], antennas[1]);
+        NS_TEST_EXPECT_MSG_NE(channelModel->GetParams(mobs[0], mobs[1]),
+                              nullptr,
+                              "The channel of the active pair has been removed");
+        NS_TEST_EXPECT_MSG_EQ(channelModel->GetParams(mobs[0], mobs[2]),
+                              nullptr,
+                              "The channel of the inactive pair has not been removed");
+    });
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup spectrum-tests
  * \brief A structure that holds the parameters for the function
@@ -701,6 +779,7 @@ ThreeGppChannelTestSuite::ThreeGppChannelTestSuite()
 {
     AddTestCase(new ThreeGppChannelMatrixComputationTest, TestCase::QUICK);
     AddTestCase(new ThreeGppChannelMatrixUpdateTest, TestCase::QUICK);
+    AddTestCase(new ThreeGppChannelPurgeTest, TestCase::QUICK);
     AddTestCase(new ThreeGppSpectrumPropagationLossModelTest, TestCase::QUICK);
 }
 
@@ -0,0 +1,154 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the number of records per second that the batch
+// trace sinks write, with the text and the SQLite backends, both from the
+// simulation thread (synchronous) and from the writer thread (asynchronous).
+// The records look like the PHY reception statistics of the LTE module.
+//
+// For each configuration, two rates are reported: the rate seen by the
+// simulation, i.e., the time spent appending the records, and the overall
+// rate, which includes the time needed to write all of them.
+//
+// Usage example:
+//   ./ns3 run "batch-trace-sink-benchmark --records=1000000"
+
+#include "ns3/abort.h"
+#include "ns3/batch-trace-sink.h"
+#include "ns3/command-line.h"
+#include "ns3/sqlite-batch-trace-backend.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+using namespace ns3;
+
+/// Record written by the benchmark
+struct BenchmarkRecord
+{
+    int64_t time;        //!< time stamp in milliseconds
+    uint16_t cellId;     //!< cell ID
+    uint64_t imsi;       //!< IMSI
+    uint16_t rnti;       //!< RNTI
+    uint8_t layer;       //!< layer
+    uint8_t mcs;         //!< MCS
+    uint16_t size;       //!< transport block size
+    uint8_t rv;          //!< redundancy version
+    uint8_t ndi;         //!< new data indicator
+    uint8_t correctness; //!< whether the transport block was received
+    double sinr;         //!< SINR
+};
+
+/**
+ * Append records to a sink and print the insertion rates.
+ * \param name the name of the configuration
+ * \param sink the sink
+ * \param records the number of records
+ */
+static void
+Run(const std::string& name, BatchTraceSink<BenchmarkRecord>& sink, uint32_t records)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < records; i++)
+    {
+        sink.Append(BenchmarkRecord{i,
+                                    static_cast<uint16_t>(1 + i % 3),
+                                    1 + i % 100,
+                                    static_cast<uint16_t>(1 + i % 100),
+                                    0,
+                                    static_cast<uint8_t>(i % 29),
+                                    static_cast<uint16_t>(i % 10000),
+                                    static_cast<uint8_t>(i % 4),
+                                    static_cast<uint8_t>(i % 2),
+                                    1,
+                                    10.0 + i % 20});
+    }
+    std::chrono::duration<double> append = std::chrono::steady_clock::now() - start;
+    sink.Flush();
+    std::chrono::duration<double> total = std::chrono::steady_clock::now() - start;
+
+    std::cout << name << ": " << records / append.count() << " records/s seen by the simulation, "
+              << records / total.count() << " records/s written" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t records = 200000;
+    bool sqlite = SqliteTraceTable::IsSupported();
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("records", "Number of records written by each configuration", records);
+    cmd.AddValue("sqlite", "Whether the SQLite backend is measured", sqlite);
+    cmd.Parse(argc, argv);
+
+    const std::string textFilename = "batch-trace-sink-benchmark.txt";
+    const std::string dbFilename = "batch-trace-sink-benchmark.db";
+    for (bool async : {false, true})
+    {
+        std::string mode = async ? "asynchronous" : "synchronous";
+        {
+            auto sink = CreateTextBatchTraceSink<BenchmarkRecord>(
+                textFilename,
+                "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tcorrect\tsinr",
+                [](std::ostream& os, const BenchmarkRecord& r) {
+                    os << r.time << "\t" << r.cellId << "\t" << r.imsi << "\t" << r.rnti << "\t"
+                       << (uint32_t)r.layer << "\t" << (uint32_t)r.mcs << "\t" << r.size << "\t"
+                       << (uint32_t)r.rv << "\t" << (uint32_t)r.ndi << "\t"
+                       << (uint32_t)r.correctness << "\t" << r.sinr;
+                },
+                async);
+            NS_ABORT_MSG_IF(!sink, "Can't open file " << textFilename);
+            Run("Text, " + mode, *sink, records);
+        }
+        if (sqlite)
+        {
+            std::remove(dbFilename.c_str());
+            auto sink = CreateSqliteBatchTraceSink<BenchmarkRecord>(
+                dbFilename,
+                "Benchmark",
+                {"time INTEGER",
+                 "cellId INTEGER",
+                 "imsi INTEGER",
+                 "rnti INTEGER",
+                 "layer INTEGER",
+                 "mcs INTEGER",
+                 "size INTEGER",
+                 "rv INTEGER",
+                 "ndi INTEGER",
+                 "correct INTEGER",
+                 "sinr REAL"},
+                [](SqliteTraceTable& table, const BenchmarkRecord& r) {
+                    table.BindInteger(0, r.time);
+                    table.BindInteger(1, r.cellId);
+                    table.BindInteger(2, static_cast<int64_t>(r.imsi));
+                    table.BindInteger(3, r.rnti);
+                    table.BindInteger(4, r.layer);
+                    table.BindInteger(5, r.mcs);
+                    table.BindInteger(6, r.size);
+                    table.BindInteger(7, r.rv);
+                    table.BindInteger(8, r.ndi);
+                    table.BindInteger(9, r.correctness);
+                    table.BindDouble(10, r.sinr);
+                },
+                async);
+            Run("SQLite, " + mode, *sink, records);
+        }
+    }
+    std::remove(textFilename.c_str());
+    std::remove(dbFilename.c_str());
+    return 0;
+}
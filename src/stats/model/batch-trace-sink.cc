@@ -0,0 +1,294 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "batch-trace-sink.h"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#ifndef __WIN32__
+#include "ns3/parameter-sweep.h"
+#endif
+
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("BatchTraceSink");
+
+/**
+ * \ingroup stats
+ *
+ * \brief Thread running the tasks submitted by the asynchronous batch trace sinks
+ *
+ * The tasks are run in the order in which they are submitted.  The thread is
+ * started when the first asynchronous sink is created, and stopped when the last
+ * one is deleted.
+ */
+class BatchTraceWriter
+{
+  public:
+    BatchTraceWriter();
+    ~BatchTraceWriter();
+
+    /**
+     * \return the writer thread, which is created if there is none
+     */
+    static std::shared_ptr<BatchTraceWriter> Get();
+
+    /**
+     * Queue a task, waiting if too many tasks are already queued.
+     * \param task the task
+     */
+    void Submit(std::function<void()> task);
+
+    /**
+     * Wait until all the tasks queued so far have been run.
+     */
+    void Wait();
+
+  private:
+    /**
+     * Main loop of the thread.
+     */
+    void Run();
+
+    /// Maximum number of tasks waiting to be run
+    static constexpr std::size_t MAX_PENDING_TASKS = 64;
+
+    std::mutex m_mutex;                        //!< protects the members below
+    std::condition_variable m_cv;              //!< signals any change of the queue
+    std::deque<std::function<void()>> m_tasks; //!< queued tasks
+    uint64_t m_submitted;                      //!< number of tasks submitted so far
+    uint64_t m_completed;                      //!< number of tasks run so far
+    bool m_stop;                               //!< whether the thread must stop
+    std::thread m_thread;                      //!< the thread
+};
+
+BatchTraceWriter::BatchTraceWriter()
+    : m_submitted(0),
+      m_completed(0),
+      m_stop(false)
+{
+    NS_LOG_FUNCTION(this);
+    m_thread = std::thread(&BatchTraceWriter::Run, this);
+}
+
+BatchTraceWriter::~BatchTraceWriter()
+{
+    NS_LOG_FUNCTION(this);
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+}
+
+std::shared_ptr<BatchTraceWriter>
+BatchTraceWriter::Get()
+{
+    static std::mutex mutex;
+    static std::weak_ptr<BatchTraceWriter> instance;
+    std::unique_lock<std::mutex> lock(mutex);
+    std::shared_ptr<BatchTraceWriter> writer = instance.lock();
+    if (!writer)
+    {
+        writer = std::make_shared<BatchTraceWriter>();
+        instance = writer;
+    }
+    return writer;
+}
+
+void
+BatchTraceWriter::Submit(std::function<void()> task)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]() { return m_tasks.size() < MAX_PENDING_TASKS; });
+    m_tasks.push_back(std::move(task));
+    m_submitted++;
+    lock.unlock();
+    m_cv.notify_all();
+}
+
+void
+BatchTraceWriter::Wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    uint64_t submitted = m_submitted;
+    m_cv.wait(lock, [this, submitted]() { return m_completed >= submitted; });
+}
+
+void
+BatchTraceWriter::Run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_cv.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+        if (m_tasks.empty())
+        {
+            // stop only once all the tasks have been run
+            return;
+        }
+        std::function<void()> task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        lock.unlock();
+        m_cv.notify_all();
+        task();
+        lock.lock();
+        m_completed++;
+        m_cv.notify_all();
+    }
+}
+
+/**
+ * \ingroup stats
+ *
+ * \brief Set of the batch trace sinks alive, flushed when the simulator is destroyed
+ * and at the end of the program, or of the ParameterSweep replication
+ *
+ * The registry is never deleted: the sinks owned by static objects built before
+ * it, such as the statistics calculators of a static LteHelper, are deleted after
+ * the static objects built later, and still remove themselves from the registry.
+ */
+class BatchTraceSinkRegistry
+{
+  public:
+    BatchTraceSinkRegistry()
+    {
+        std::atexit(&BatchTraceSinkBase::FlushAll);
+#ifndef __WIN32__
+        // the replications of a sweep do not run the destructors of the static objects
+        ParameterSweep::AddExitHook(&BatchTraceSinkBase::FlushAll);
+#endif
+    }
+
+    /**
+     * \return the registry
+     */
+    static BatchTraceSinkRegistry& Get()
+    {
+        static BatchTraceSinkRegistry* registry = new BatchTraceSinkRegistry();
+        return *registry;
+    }
+
+    /**
+     * Add a sink.
+     * \param sink the sink
+     */
+    void Add(BatchTraceSinkBase* sink)
+    {
+        m_sinks.insert(sink);
+        if (!m_flushScheduled)
+        {
+            Simulator::ScheduleDestroy(&BatchTraceSinkRegistry::FlushAllOnDestroy);
+            m_flushScheduled = true;
+        }
+    }
+
+    /**
+     * Remove a sink.
+     * \param sink the sink
+     */
+    void Remove(BatchTraceSinkBase* sink)
+    {
+        m_sinks.erase(sink);
+    }
+
+    /**
+     * Flush all the sinks.
+     */
+    void FlushAll()
+    {
+        for (auto sink : m_sinks)
+        {
+            sink->Flush();
+        }
+    }
+
+  private:
+    /**
+     * Flush all the sinks when the simulator is destroyed.
+     */
+    static void FlushAllOnDestroy()
+    {
+        BatchTraceSinkRegistry& registry = Get();
+        registry.m_flushScheduled = false;
+        registry.FlushAll();
+    }
+
+    std::set<BatchTraceSinkBase*> m_sinks; //!< sinks alive
+    bool m_flushScheduled{false};          //!< whether FlushAllOnDestroy is scheduled
+};
+
+BatchTraceSinkBase::BatchTraceSinkBase(bool async)
+{
+    NS_LOG_FUNCTION(this << async);
+    if (async)
+    {
+        m_writer = BatchTraceWriter::Get();
+    }
+    BatchTraceSinkRegistry::Get().Add(this);
+}
+
+BatchTraceSinkBase::~BatchTraceSinkBase()
+{
+    NS_LOG_FUNCTION(this);
+    BatchTraceSinkRegistry::Get().Remove(this);
+}
+
+void
+BatchTraceSinkBase::FlushAll()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    BatchTraceSinkRegistry::Get().FlushAll();
+}
+
+bool
+BatchTraceSinkBase::IsAsync() const
+{
+    return bool(m_writer);
+}
+
+void
+BatchTraceSinkBase::Submit(std::function<void()> task)
+{
+    if (m_writer)
+    {
+        m_writer->Submit(std::move(task));
+    }
+    else
+    {
+        task();
+    }
+}
+
+void
+BatchTraceSinkBase::Wait()
+{
+    if (m_writer)
+    {
+        m_writer->Wait();
+    }
+}
+
+} // namespace ns3
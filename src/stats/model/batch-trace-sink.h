@@ -0,0 +1,346 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef BATCH_TRACE_SINK_H
+#define BATCH_TRACE_SINK_H
+
+#include "ns3/callback.h"
+
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ns3
+{
+
+class BatchTraceWriter;
+
+/**
+ * \ingroup stats
+ *
+ * \brief Output backend of a BatchTraceSink
+ *
+ * A backend writes batches of records of type T to its output.  When the
+ * sink is asynchronous, Write and Flush are called by the writer thread,
+ * hence they must not use the simulator, the logging or any state shared
+ * with the simulation.
+ */
+template <typename T>
+class BatchTraceBackend
+{
+  public:
+    virtual ~BatchTraceBackend() = default;
+
+    /**
+     * Write a batch of records.
+     * \param records the records
+     * \param count the number of records
+     */
+    virtual void Write(const T* records, std::size_t count) = 0;
+
+    /**
+     * Flush the records written so far to the output.
+     */
+    virtual void Flush()
+    {
+    }
+};
+
+/**
+ * \ingroup stats
+ *
+ * \brief Backend writing records as lines of text, e.g. tab-separated values
+ */
+template <typename T>
+class TextBatchTraceBackend : public BatchTraceBackend<T>
+{
+  public:
+    /// Function writing a record, without the end of line, to a stream
+    typedef std::function<void(std::ostream&, const T&)> Formatter;
+
+    /**
+     * Open the output file and write its header.
+     * \param filename the name of the output file
+     * \param header the first line of the file, without end of line; nothing
+     *        is written if it is empty
+     * \param formatter the function writing a record
+     */
+    TextBatchTraceBackend(const std::string& filename,
+                          const std::string& header,
+                          Formatter formatter)
+        : m_os(filename),
+          m_formatter(formatter)
+    {
+        if (!header.empty())
+        {
+            m_os << header << "\n";
+        }
+    }
+
+    /**
+     * \return true if the output file could be opened
+     */
+    bool IsOpen() const
+    {
+        return m_os.is_open();
+    }
+
+    void Write(const T* records, std::size_t count) override
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            m_formatter(m_os, records[i]);
+            m_os << "\n";
+        }
+    }
+
+    void Flush() override
+    {
+        m_os.flush();
+    }
+
+  private:
+    std::ofstream m_os;    //!< output file
+    Formatter m_formatter; //!< record formatter
+};
+
+/**
+ * \ingroup stats
+ *
+ * \brief Backend writing the raw bytes of the records
+ *
+ * The output file is a sequence of records in the memory layout of T (including
+ * padding) on the host running the simulation.
+ */
+template <typename T>
+class BinaryBatchTraceBackend : public BatchTraceBackend<T>
+{
+  public:
+    /**
+     * Open the output file.
+     * \param filename the name of the output file
+     */
+    BinaryBatchTraceBackend(const std::string& filename)
+        : m_os(filename, std::ios::binary)
+    {
+    }
+
+    /**
+     * \return true if the output file could be opened
+     */
+    bool IsOpen() const
+    {
+        return m_os.is_open();
+    }
+
+    void Write(const T* records, std::size_t count) override
+    {
+        m_os.write(reinterpret_cast<const char*>(records), count * sizeof(T));
+    }
+
+    void Flush() override
+    {
+        m_os.flush();
+    }
+
+  private:
+    std::ofstream m_os; //!< output file
+};
+
+/**
+ * \ingroup stats
+ *
+ * \brief Base class of the batch trace sinks, independent of the record type
+ *
+ * It hands the batches of records over to the writer thread, which is shared by
+ * all the asynchronous sinks.  The batches are written in the order in which
+ * they are submitted, and the number of batches waiting to be written is
+ * bounded: a sink submitting a batch while the writer thread lags behind waits
+ * for it.
+ *
+ * The sinks still alive are flushed when the simulator is destroyed and at the
+ * end of the program, or of the ParameterSweep replication, so that no record is
+ * lost if a sink is never deleted.
+ */
+class BatchTraceSinkBase
+{
+  public:
+    /**
+     * Constructor
+     * \param async whether the records are written by the writer thread
+     */
+    BatchTraceSinkBase(bool async);
+    virtual ~BatchTraceSinkBase();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    BatchTraceSinkBase(const BatchTraceSinkBase&) = delete;
+    BatchTraceSinkBase& operator=(const BatchTraceSinkBase&) = delete;
+
+    /**
+     * Write the records appended so far and wait until they are written.
+     */
+    virtual void Flush() = 0;
+
+    /**
+     * Flush all the sinks.
+     */
+    static void FlushAll();
+
+    /**
+     * \return true if the records are written by the writer thread
+     */
+    bool IsAsync() const;
+
+  protected:
+    /**
+     * Run a task writing a batch of records, on the writer thread if the sink is
+     * asynchronous, otherwise immediately.
+     * \param task the task
+     */
+    void Submit(std::function<void()> task);
+
+    /**
+     * Wait until all the tasks submitted so far have been run.
+     */
+    void Wait();
+
+  private:
+    std::shared_ptr<BatchTraceWriter> m_writer; //!< writer thread, null if synchronous
+};
+
+/**
+ * \ingroup stats
+ *
+ * \brief Trace sink buffering fixed-size records and writing them in batches
+ *
+ * A trace sink (e.g., a callback connected to a TracedCallback) appends a
+ * record to the sink, which is a plain copy into the current batch.  Full
+ * batches are written by the backend, on the writer thread when the sink is
+ * asynchronous, so that the simulation does not wait for the formatting of
+ * the records or for the file system.
+ *
+ * \tparam T the record type, which must be trivially copyable
+ */
+template <typename T>
+class BatchTraceSink : public BatchTraceSinkBase
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Records must be trivially copyable");
+
+  public:
+    /**
+     * Constructor
+     * \param backend the backend writing the records
+     * \param async whether the records are written by the writer thread
+     * \param batchSize the number of records of a batch
+     */
+    BatchTraceSink(std::unique_ptr<BatchTraceBackend<T>> backend,
+                   bool async = true,
+                   std::size_t batchSize = 1024)
+        : BatchTraceSinkBase(async),
+          m_backend(std::move(backend)),
+          m_batchSize(batchSize > 0 ? batchSize : 1)
+    {
+        m_records.reserve(m_batchSize);
+    }
+
+    ~BatchTraceSink() override
+    {
+        Flush();
+    }
+
+    /**
+     * Append a record.
+     * \param record the record
+     */
+    void Append(const T& record)
+    {
+        m_records.push_back(record);
+        if (m_records.size() >= m_batchSize)
+        {
+            SubmitBatch();
+        }
+    }
+
+    /**
+     * \return a callback appending its argument to this sink
+     */
+    Callback<void, const T&> MakeAppendCallback()
+    {
+        return MakeCallback(&BatchTraceSink<T>::Append, this);
+    }
+
+    void Flush() override
+    {
+        SubmitBatch();
+        BatchTraceBackend<T>* backend = m_backend.get();
+        Submit([backend]() { backend->Flush(); });
+        Wait();
+    }
+
+  private:
+    /**
+     * Hand the current batch over to the backend.
+     */
+    void SubmitBatch()
+    {
+        if (m_records.empty())
+        {
+            return;
+        }
+        auto batch = std::make_shared<std::vector<T>>();
+        batch->reserve(m_batchSize);
+        batch->swap(m_records);
+        BatchTraceBackend<T>* backend = m_backend.get();
+        Submit([backend, batch]() { backend->Write(batch->data(), batch->size()); });
+    }
+
+    std::unique_ptr<BatchTraceBackend<T>> m_backend; //!< backend writing the records
+    std::size_t m_batchSize;                         //!< number of records of a batch
+    std::vector<T> m_records;                        //!< current batch
+};
+
+/**
+ * \ingroup stats
+ *
+ * Create a sink writing records as lines of text.
+ *
+ * \param filename the name of the output file
+ * \param header the first line of the file, without end of line
+ * \param formatter the function writing a record
+ * \param async whether the records are written by the writer thread
+ * \return the sink, or nullptr if the output file cannot be opened
+ */
+template <typename T>
+std::unique_ptr<BatchTraceSink<T>>
+CreateTextBatchTraceSink(const std::string& filename,
+                         const std::string& header,
+                         typename TextBatchTraceBackend<T>::Formatter formatter,
+                         bool async = true)
+{
+    auto backend = std::make_unique<TextBatchTraceBackend<T>>(filename, header, formatter);
+    if (!backend->IsOpen())
+    {
+        return nullptr;
+    }
+    return std::make_unique<BatchTraceSink<T>>(std::move(backend), async);
+}
+
+} // namespace ns3
+
+#endif /* BATCH_TRACE_SINK_H */
@@ -0,0 +1,149 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sqlite-batch-trace-backend.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+#ifdef HAVE_SQLITE3
+#include "sqlite-output.h"
+#endif
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SqliteBatchTraceBackend");
+
+#ifdef HAVE_SQLITE3
+
+SqliteTraceTable::SqliteTraceTable(const std::string& filename,
+                                   const std::string& table,
+                                   const std::vector<std::string>& columns)
+    : m_db(new SQLiteOutput(filename)),
+      m_insert(nullptr)
+{
+    NS_LOG_FUNCTION(this << filename << table);
+    NS_ABORT_MSG_IF(columns.empty(), "Table " << table << " without columns");
+
+    std::string definitions;
+    std::string parameters;
+    for (const auto& column : columns)
+    {
+        definitions += (definitions.empty() ? "" : ", ") + column;
+        parameters += parameters.empty() ? "?" : ", ?";
+    }
+    m_db->SetJournalInMemory();
+    bool ok = m_db->SpinExec("CREATE TABLE IF NOT EXISTS " + table + " (" + definitions + ");");
+    NS_ABORT_MSG_UNLESS(ok, "Can't create table " << table << " in " << filename);
+    ok = m_db->SpinPrepare(&m_insert,
+                           "INSERT INTO " + table + " VALUES (" + parameters + ");");
+    NS_ABORT_MSG_UNLESS(ok, "Can't prepare the insertion into " << table << " in " << filename);
+}
+
+SqliteTraceTable::~SqliteTraceTable()
+{
+    NS_LOG_FUNCTION(this);
+    SQLiteOutput::SpinFinalize(m_insert);
+    m_db->Unref();
+}
+
+bool
+SqliteTraceTable::IsSupported()
+{
+    return true;
+}
+
+void
+SqliteTraceTable::Begin()
+{
+    m_db->SpinExec("BEGIN TRANSACTION;");
+}
+
+void
+SqliteTraceTable::BindDouble(int column, double value)
+{
+    m_db->Bind(m_insert, column + 1, value);
+}
+
+void
+SqliteTraceTable::BindInteger(int column, int64_t value)
+{
+    m_db->Bind(m_insert, column + 1, static_cast<long long>(value));
+}
+
+void
+SqliteTraceTable::Insert()
+{
+    SQLiteOutput::SpinStep(m_insert);
+    SQLiteOutput::SpinReset(m_insert);
+}
+
+void
+SqliteTraceTable::Commit()
+{
+    m_db->SpinExec("END TRANSACTION;");
+}
+
+#else /* HAVE_SQLITE3 */
+
+SqliteTraceTable::SqliteTraceTable(const std::string& filename,
+                                   const std::string& table,
+                                   const std::vector<std::string>& /* columns */)
+    : m_db(nullptr),
+      m_insert(nullptr)
+{
+    NS_FATAL_ERROR("Can't write table " << table << " in " << filename
+                                        << ": ns-3 has been built without SQLite support");
+}
+
+SqliteTraceTable::~SqliteTraceTable()
+{
+}
+
+bool
+SqliteTraceTable::IsSupported()
+{
+    return false;
+}
+
+void
+SqliteTraceTable::Begin()
+{
+}
+
+void
+SqliteTraceTable::BindDouble(int /* column */, double /* value */)
+{
+}
+
+void
+SqliteTraceTable::BindInteger(int /* column */, int64_t /* value */)
+{
+}
+
+void
+SqliteTraceTable::Insert()
+{
+}
+
+void
+SqliteTraceTable::Commit()
+{
+}
+
+#endif /* HAVE_SQLITE3 */
+
+} // namespace ns3
@@ -0,0 +1,179 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SQLITE_BATCH_TRACE_BACKEND_H
+#define SQLITE_BATCH_TRACE_BACKEND_H
+
+#include "batch-trace-sink.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct sqlite3_stmt;
+
+namespace ns3
+{
+
+class SQLiteOutput;
+
+/**
+ * \ingroup stats
+ *
+ * \brief Table of an SQLite database into which rows are inserted with a
+ * prepared statement
+ *
+ * The table is created if it does not exist yet; otherwise the rows are
+ * appended to the ones already in the table, so that the results of several
+ * simulations can be collected in the same database.  Rows are inserted
+ * between Begin and Commit, i.e., in a single transaction.
+ *
+ * The constructor and the destructor must be called by the simulation thread,
+ * while the other methods can be called by the writer thread of the batch
+ * trace sinks.
+ */
+class SqliteTraceTable
+{
+  public:
+    /**
+     * Open the database, create the table and prepare the insert statement.
+     * \param filename the name of the database file
+     * \param table the name of the table
+     * \param columns the definitions of the columns, e.g., "imsi INTEGER"
+     */
+    SqliteTraceTable(const std::string& filename,
+                     const std::string& table,
+                     const std::vector<std::string>& columns);
+    ~SqliteTraceTable();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    SqliteTraceTable(const SqliteTraceTable&) = delete;
+    SqliteTraceTable& operator=(const SqliteTraceTable&) = delete;
+
+    /**
+     * \return true if ns-3 has been built with SQLite support
+     */
+    static bool IsSupported();
+
+    /**
+     * Begin a transaction.
+     */
+    void Begin();
+
+    /**
+     * Bind a real value to a column of the next row.
+     * \param column the index of the column, starting from 0
+     * \param value the value
+     */
+    void BindDouble(int column, double value);
+
+    /**
+     * Bind an integer value to a column of the next row.
+     * \param column the index of the column, starting from 0
+     * \param value the value
+     */
+    void BindInteger(int column, int64_t value);
+
+    /**
+     * Insert the next row, whose columns have been bound.
+     */
+    void Insert();
+
+    /**
+     * Commit the transaction.
+     */
+    void Commit();
+
+  private:
+    SQLiteOutput* m_db;     //!< database, holding a reference
+    sqlite3_stmt* m_insert; //!< prepared insert statement
+};
+
+/**
+ * \ingroup stats
+ *
+ * \brief Backend inserting the records as rows of an SQLite table
+ *
+ * Each batch is inserted in a single transaction with a prepared statement,
+ * which is much faster than one statement per record.
+ */
+template <typename T>
+class SqliteBatchTraceBackend : public BatchTraceBackend<T>
+{
+  public:
+    /// Function binding the fields of a record to the columns of the table
+    typedef std::function<void(SqliteTraceTable&, const T&)> Binder;
+
+    /**
+     * Open the database and create the table.
+     * \param filename the name of the database file
+     * \param table the name of the table
+     * \param columns the definitions of the columns, e.g., "imsi INTEGER"
+     * \param binder the function binding the fields of a record
+     */
+    SqliteBatchTraceBackend(const std::string& filename,
+                            const std::string& table,
+                            const std::vector<std::string>& columns,
+                            Binder binder)
+        : m_table(filename, table, columns),
+          m_binder(binder)
+    {
+    }
+
+    void Write(const T* records, std::size_t count) override
+    {
+        m_table.Begin();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            m_binder(m_table, records[i]);
+            m_table.Insert();
+        }
+        m_table.Commit();
+    }
+
+  private:
+    SqliteTraceTable m_table; //!< output table
+    Binder m_binder;          //!< record binder
+};
+
+/**
+ * \ingroup stats
+ *
+ * Create a sink inserting records as rows of an SQLite table.
+ *
+ * \param filename the name of the database file
+ * \param table the name of the table
+ * \param columns the definitions of the columns, e.g., "imsi INTEGER"
+ * \param binder the function binding the fields of a record
+ * \param async whether the records are written by the writer thread
+ * \param batchSize the number of records inserted by each transaction
+ * \return the sink
+ */
+template <typename T>
+std::unique_ptr<BatchTraceSink<T>>
+CreateSqliteBatchTraceSink(const std::string& filename,
+                           const std::string& table,
+                           const std::vector<std::string>& columns,
+                           typename SqliteBatchTraceBackend<T>::Binder binder,
+                           bool async = true,
+                           std::size_t batchSize = 8192)
+{
+    auto backend = std::make_unique<SqliteBatchTraceBackend<T>>(filename, table, columns, binder);
+    return std::make_unique<BatchTraceSink<T>>(std::move(backend), async, batchSize);
+}
+
+} // namespace ns3
+
+#endif /* SQLITE_BATCH_TRACE_BACKEND_H */
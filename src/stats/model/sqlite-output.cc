@@ -47,7 +47,18 @@ void
 SQLiteOutput::SetJournalInMemory()
 {
     NS_LOG_FUNCTION(this);
-    SpinExec("PRAGMA journal_mode = MEMORY");
+    // the pragma returns the new journal mode as a row, so SpinExec would
+    // return before finalizing the statement, which would then keep the
+    // following transactions busy
+    sqlite3_stmt* stmt;
+    int rc = SpinPrepare(m_db, &stmt, "PRAGMA journal_mode = MEMORY;");
+    if (CheckError(m_db, rc, "PRAGMA journal_mode = MEMORY;", false))
+    {
+        return;
+    }
+    SpinStep(stmt);
+    rc = SpinFinalize(stmt);
+    CheckError(m_db, rc, "PRAGMA journal_mode = MEMORY;", false);
 }
 
 bool
@@ -0,0 +1,359 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/batch-trace-sink.h"
+#include "ns3/simulator.h"
+#include "ns3/sqlite-batch-trace-backend.h"
+#include "ns3/test.h"
+#include "ns3/traced-callback.h"
+
+#ifdef HAVE_SQLITE3
+#include "ns3/sqlite-output.h"
+#endif
+
+#include <fstream>
+#include <sstream>
+
+#ifndef __WIN32__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+using namespace ns3;
+
+/// Record written by the tests
+struct BatchTraceTestRecord
+{
+    int64_t time;   //!< time stamp
+    uint32_t value; //!< value
+};
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief Check that the records written by a text backend are complete and in order
+ */
+class BatchTraceSinkTextTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param async whether the sink is asynchronous
+     */
+    BatchTraceSinkTextTestCase(bool async);
+
+  private:
+    void DoRun() override;
+
+    bool m_async; //!< whether the sink is asynchronous
+};
+
+BatchTraceSinkTextTestCase::BatchTraceSinkTextTestCase(bool async)
+    : TestCase(std::string("Text batch trace sink, ") + (async ? "asynchronous" : "synchronous")),
+      m_async(async)
+{
+}
+
+void
+BatchTraceSinkTextTestCase::DoRun()
+{
+    const uint32_t n = 10000;
+    std::string filename = CreateTempDirFilename("batch-trace-sink.txt");
+    {
+        auto backend = std::make_unique<TextBatchTraceBackend<BatchTraceTestRecord>>(
+            filename,
+            "% time\tvalue",
+            [](std::ostream& os, const BatchTraceTestRecord& r) {
+                os << r.time << "\t" << r.value;
+            });
+        NS_TEST_ASSERT_MSG_EQ(backend->IsOpen(), true, "Cannot open " << filename);
+        BatchTraceSink<BatchTraceTestRecord> sink(std::move(backend), m_async, 100);
+        NS_TEST_ASSERT_MSG_EQ(sink.IsAsync(), m_async, "Wrong sink mode");
+
+        // records appended through a traced callback
+        TracedCallback<const BatchTraceTestRecord&> trace;
+        trace.ConnectWithoutContext(sink.MakeAppendCallback());
+        for (uint32_t i = 0; i < n; i++)
+        {
+            trace(BatchTraceTestRecord{-static_cast<int64_t>(i), i});
+        }
+
+        // the records must be in the file once flushed, also when the sink is still alive
+        sink.Flush();
+        std::ifstream is(filename);
+        std::string line;
+        std::getline(is, line);
+        NS_TEST_ASSERT_MSG_EQ(line, "% time\tvalue", "Wrong header");
+        uint32_t count = 0;
+        while (std::getline(is, line))
+        {
+            std::istringstream iss(line);
+            int64_t time;
+            uint32_t value;
+            iss >> time >> value;
+            NS_TEST_ASSERT_MSG_EQ(time, -static_cast<int64_t>(count), "Wrong time");
+            NS_TEST_ASSERT_MSG_EQ(value, count, "Wrong value");
+            count++;
+        }
+        NS_TEST_ASSERT_MSG_EQ(count, n, "Wrong number of records");
+
+        sink.Append(BatchTraceTestRecord{1, 2});
+    }
+
+    // the last record is written when the sink is deleted
+    std::ifstream is(filename);
+    std::string line;
+    std::string last;
+    while (std::getline(is, line))
+    {
+        last = line;
+    }
+    NS_TEST_ASSERT_MSG_EQ(last, "1\t2", "Wrong last record");
+}
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief Check the binary backend, and the flush of the sinks alive when the simulator is
+ * destroyed
+ */
+class BatchTraceSinkBinaryTestCase : public TestCase
+{
+  public:
+    BatchTraceSinkBinaryTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+BatchTraceSinkBinaryTestCase::BatchTraceSinkBinaryTestCase()
+    : TestCase("Binary batch trace sink")
+{
+}
+
+void
+BatchTraceSinkBinaryTestCase::DoRun()
+{
+    const uint32_t n = 2500;
+    std::string filename = CreateTempDirFilename("batch-trace-sink.bin");
+    auto backend = std::make_unique<BinaryBatchTraceBackend<BatchTraceTestRecord>>(filename);
+    NS_TEST_ASSERT_MSG_EQ(backend->IsOpen(), true, "Cannot open " << filename);
+    BatchTraceSink<BatchTraceTestRecord> sink(std::move(backend));
+    for (uint32_t i = 0; i < n; i++)
+    {
+        sink.Append(BatchTraceTestRecord{i, 2 * i});
+    }
+    Simulator::Destroy();
+
+    std::ifstream is(filename, std::ios::binary);
+    BatchTraceTestRecord record;
+    uint32_t count = 0;
+    while (is.read(reinterpret_cast<char*>(&record), sizeof(record)))
+    {
+        NS_TEST_ASSERT_MSG_EQ(record.time, count, "Wrong time");
+        NS_TEST_ASSERT_MSG_EQ(record.value, 2 * count, "Wrong value");
+        count++;
+    }
+    NS_TEST_ASSERT_MSG_EQ(count, n, "Wrong number of records");
+}
+
+#ifdef HAVE_SQLITE3
+/**
+ * \ingroup stats-tests
+ *
+ * \brief Check that the records inserted by an SQLite backend are complete and in order
+ */
+class BatchTraceSinkSqliteTestCase : public TestCase
+{
+  public:
+    BatchTraceSinkSqliteTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+BatchTraceSinkSqliteTestCase::BatchTraceSinkSqliteTestCase()
+    : TestCase("SQLite batch trace sink")
+{
+}
+
+void
+BatchTraceSinkSqliteTestCase::DoRun()
+{
+    const uint32_t n = 5000;
+    std::string filename = CreateTempDirFilename("batch-trace-sink.db");
+    auto sink = CreateSqliteBatchTraceSink<BatchTraceTestRecord>(
+        filename,
+        "BatchTraceTest",
+        {"time INTEGER", "value INTEGER"},
+        [](SqliteTraceTable& table, const BatchTraceTestRecord& r) {
+            table.BindInteger(0, r.time);
+            table.BindInteger(1, r.value);
+        },
+        true,
+        1000);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        sink->Append(BatchTraceTestRecord{-static_cast<int64_t>(i), i});
+    }
+    sink->Flush();
+
+    Ptr<SQLiteOutput> db = Create<SQLiteOutput>(filename);
+    sqlite3_stmt* stmt;
+    bool ok = db->WaitPrepare(&stmt, "SELECT time, value FROM BatchTraceTest ORDER BY rowid;");
+    NS_TEST_ASSERT_MSG_EQ(ok, true, "Cannot query " << filename);
+    uint32_t count = 0;
+    while (SQLiteOutput::SpinStep(stmt) == SQLITE_ROW)
+    {
+        NS_TEST_ASSERT_MSG_EQ(db->RetrieveColumn<int>(stmt, 0),
+                              -static_cast<int>(count),
+                              "Wrong time");
+        NS_TEST_ASSERT_MSG_EQ(db->RetrieveColumn<uint32_t>(stmt, 1), count, "Wrong value");
+        count++;
+    }
+    SQLiteOutput::SpinFinalize(stmt);
+    NS_TEST_ASSERT_MSG_EQ(count, n, "Wrong number of records");
+}
+#endif /* HAVE_SQLITE3 */
+
+#ifndef __WIN32__
+/**
+ * \ingroup stats-tests
+ *
+ * \brief Static object owning a sink, deleted at the end of the program after the
+ * static objects built while the program runs, such as the registry of the sinks
+ *
+ * It is defined after the test suite, so that it is deleted before the test suite,
+ * and ends the process once the sink is deleted: the test suite, whose test is
+ * running, must not be deleted.
+ */
+struct BatchTraceTestStaticOwner
+{
+    ~BatchTraceTestStaticOwner()
+    {
+        if (sink)
+        {
+            delete sink;
+            std::_Exit(0);
+        }
+    }
+
+    BatchTraceSink<BatchTraceTestRecord>* sink{nullptr}; //!< the sink
+};
+
+extern BatchTraceTestStaticOwner g_batchTraceTestStaticOwner;
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief Check that a sink deleted during the static teardown, after the static
+ * objects built later than it, is flushed and does not crash the program
+ *
+ * The program is forked, and the child process exits with the sink owned by
+ * g_batchTraceTestStaticOwner.
+ */
+class BatchTraceSinkTeardownTestCase : public TestCase
+{
+  public:
+    BatchTraceSinkTeardownTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+BatchTraceSinkTeardownTestCase::BatchTraceSinkTeardownTestCase()
+    : TestCase("Batch trace sink deleted during the static teardown")
+{
+}
+
+void
+BatchTraceSinkTeardownTestCase::DoRun()
+{
+    const uint32_t n = 1000;
+    std::string filename = CreateTempDirFilename("batch-trace-sink-teardown.bin");
+    pid_t pid = fork();
+    NS_TEST_ASSERT_MSG_NE(pid, -1, "Cannot fork");
+    if (pid == 0)
+    {
+        // the child is killed if it hangs in the teardown
+        alarm(10);
+#ifdef __GLIBC__
+        // overwrite the memory freed during the teardown, so that a use after free
+        // does not go unnoticed
+        mallopt(M_PERTURB, 0xa5);
+#endif
+        auto backend = std::make_unique<BinaryBatchTraceBackend<BatchTraceTestRecord>>(filename);
+        g_batchTraceTestStaticOwner.sink =
+            new BatchTraceSink<BatchTraceTestRecord>(std::move(backend), false, 2 * n);
+        for (uint32_t i = 0; i < n; i++)
+        {
+            g_batchTraceTestStaticOwner.sink->Append(BatchTraceTestRecord{i, i});
+        }
+        std::exit(0);
+    }
+
+    int status;
+    waitpid(pid, &status, 0);
+    NS_TEST_ASSERT_MSG_EQ(WIFEXITED(status) && WEXITSTATUS(status) == 0,
+                          true,
+                          "The child process did not exit cleanly, status " << status);
+
+    std::ifstream is(filename, std::ios::binary);
+    BatchTraceTestRecord record;
+    uint32_t count = 0;
+    while (is.read(reinterpret_cast<char*>(&record), sizeof(record)))
+    {
+        NS_TEST_ASSERT_MSG_EQ(record.value, count, "Wrong value");
+        count++;
+    }
+    NS_TEST_ASSERT_MSG_EQ(count, n, "Wrong number of records");
+}
+#endif /* __WIN32__ */
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief Batch trace sink TestSuite
+ */
+class BatchTraceSinkTestSuite : public TestSuite
+{
+  public:
+    BatchTraceSinkTestSuite();
+};
+
+BatchTraceSinkTestSuite::BatchTraceSinkTestSuite()
+    : TestSuite("batch-trace-sink", UNIT)
+{
+    AddTestCase(new BatchTraceSinkTextTestCase(false), TestCase::QUICK);
+    AddTestCase(new BatchTraceSinkTextTestCase(true), TestCase::QUICK);
+    AddTestCase(new BatchTraceSinkBinaryTestCase, TestCase::QUICK);
+#ifdef HAVE_SQLITE3
+    AddTestCase(new BatchTraceSinkSqliteTestCase, TestCase::QUICK);
+#endif
+#ifndef __WIN32__
+    AddTestCase(new BatchTraceSinkTeardownTestCase, TestCase::QUICK);
+#endif
+}
+
+static BatchTraceSinkTestSuite g_batchTraceSinkTestSuite; ///< the test suite
+
+#ifndef __WIN32__
+/// Owner of the sink deleted during the static teardown
+BatchTraceTestStaticOwner g_batchTraceTestStaticOwner;
+#endif
@@ -7,6 +7,7 @@
 #
 # See test.py for more information.
 cpp_examples = [
+    ("batch-trace-sink-benchmark --records=10000", "True", "False"),
     ("double-probe-example", "True", "True"),
     ("file-aggregator-example", "True", "True"),
     ("file-helper-example", "True", "True"),
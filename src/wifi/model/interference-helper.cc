@@ -140,40 +140,6 @@ operator<<(std::ostream& os, const Event& event)
     return os;
 }
 
-/****************************************************************
- *       Class which records SNIR change events for a
- *       short period of time.
- ****************************************************************/
-
-InterferenceHelper::NiChange::NiChange(double power, Ptr<Event> event)
-    : m_power(power),
-      m_event(event)
-{
-}
-
-InterferenceHelper::NiChange::~NiChange()
-{
-    m_event = nullptr;
-}
-
-double
-InterferenceHelper::NiChange::GetPower() const
-{
-    return m_power;
-}
-
-void
-InterferenceHelper::NiChange::AddPower(double power)
-{
-    m_power += power;
-}
-
-Ptr<Event>
-InterferenceHelper::NiChange::GetEvent() const
-{
-    return m_event;
-}
-
 /****************************************************************
  *       The actual InterferenceHelper
  ****************************************************************/
@@ -205,10 +171,7 @@ void
 InterferenceHelper::DoDispose()
 {
     NS_LOG_FUNCTION(this);
-    for (auto it : m_niChanges)
-    {
-        it.second.clear();
-    }
+    m_bandIndices.clear();
     m_niChanges.clear();
     m_firstPowers.clear();
     m_errorRateModel = nullptr;
@@ -242,27 +205,52 @@ InterferenceHelper::AddForeignSignal(Time duration, RxPowerWattPerChannelBand& r
 bool
 InterferenceHelper::HasBands() const
 {
-    return !m_niChanges.empty();
+    return !m_bandIndices.empty();
 }
 
 bool
 InterferenceHelper::HasBand(const WifiSpectrumBandInfo& band) const
 {
-    return (m_niChanges.count(band) > 0);
+    return (m_bandIndices.count(band) > 0);
+}
+
+std::size_t
+InterferenceHelper::GetBandIndex(const WifiSpectrumBandInfo& band) const
+{
+    auto it = m_bandIndices.find(band);
+    NS_ABORT_IF(it == m_bandIndices.end());
+    return it->second;
+}
+
+std::vector<std::pair<std::size_t, double>>
+InterferenceHelper::GetBandIndices(const RxPowerWattPerChannelBand& rxPower) const
+{
+    std::vector<std::pair<std::size_t, double>> indices;
+    indices.reserve(rxPower.size());
+    auto bandIt = m_bandIndices.cbegin();
+    for (const auto& [band, power] : rxPower)
+    {
+        while (bandIt != m_bandIndices.cend() && bandIt->first < band)
+        {
+            ++bandIt;
+        }
+        NS_ABORT_IF(bandIt == m_bandIndices.cend() || band < bandIt->first);
+        indices.emplace_back(bandIt->second, power);
+    }
+    return indices;
 }
 
 void
 InterferenceHelper::AddBand(const WifiSpectrumBandInfo& band)
 {
     NS_LOG_FUNCTION(this << band);
-    NS_ASSERT(m_niChanges.count(band) == 0);
-    NS_ASSERT(m_firstPowers.count(band) == 0);
-    NiChanges niChanges;
-    auto result = m_niChanges.insert({band, niChanges});
-    NS_ASSERT(result.second);
+    NS_ASSERT(!HasBand(band));
+    const auto bandIndex = m_niChanges.size();
+    m_bandIndices.emplace(band, bandIndex);
+    m_niChanges.emplace_back();
     // Always have a zero power noise event in the list
-    AddNiChangeEvent(Time(0), NiChange(0.0, nullptr), result.first);
-    m_firstPowers.insert({band, 0.0});
+    AddNiChangeEvent(Time(0), 0.0, nullptr, bandIndex);
+    m_firstPowers.push_back(0.0);
 }
 
 void
@@ -270,7 +258,8 @@ InterferenceHelper::UpdateBands(const std::vector<WifiSpectrumBandInfo>& bands,
                                 const FrequencyRange& freqRange)
 {
     NS_LOG_FUNCTION(this << freqRange);
-    for (auto it = m_niChanges.begin(); it != m_niChanges.end();)
+    bool erased = false;
+    for (auto it = m_bandIndices.begin(); it != m_bandIndices.end();)
     {
         if (!IsBandInFrequencyRange(it->first, freqRange))
         {
@@ -285,15 +274,31 @@ InterferenceHelper::UpdateBands(const std::vector<WifiSpectrumBandInfo>& bands,
         if (!found)
         {
             // band does not belong to the new bands, erase it
-            m_firstPowers.erase(it->first);
-            it->second.clear();
-            it = m_niChanges.erase(it);
+            m_niChanges[it->second] = NiChanges();
+            it = m_bandIndices.erase(it);
+            erased = true;
         }
         else
         {
             it++;
         }
     }
+    if (erased)
+    {
+        // renumber the remaining bands so that their indices are contiguous again
+        std::vector<NiChanges> niChanges;
+        std::vector<double> firstPowers;
+        niChanges.reserve(m_bandIndices.size());
+        firstPowers.reserve(m_bandIndices.size());
+        for (auto& [band, index] : m_bandIndices)
+        {
+            niChanges.push_back(std::move(m_niChanges[index]));
+            firstPowers.push_back(m_firstPowers[index]);
+            index = niChanges.size() - 1;
+        }
+        m_niChanges = std::move(niChanges);
+        m_firstPowers = std::move(firstPowers);
+    }
     for (const auto& band : bands)
     {
         if (!HasBand(band))
@@ -333,14 +338,14 @@ InterferenceHelper::GetEnergyDuration(double energyW, const WifiSpectrumBandInfo
 {
     NS_LOG_FUNCTION(this << energyW << band);
     Time now = Simulator::Now();
-    auto niIt = m_niChanges.find(band);
-    NS_ABORT_IF(niIt == m_niChanges.end());
-    auto i = GetPreviousPosition(now, niIt);
-    Time end = i->first;
-    for (; i != niIt->second.end(); ++i)
+    const auto bandIndex = GetBandIndex(band);
+    const auto& niChanges = m_niChanges[bandIndex];
+    auto i = GetPreviousPosition(now, bandIndex);
+    Time end = niChanges.times[i];
+    for (; i < niChanges.times.size(); ++i)
     {
-        double noiseInterferenceW = i->second.GetPower();
-        end = i->first;
+        double noiseInterferenceW = niChanges.powers[i];
+        end = niChanges.times[i];
         if (noiseInterferenceW < energyW)
         {
             break;
@@ -353,34 +358,35 @@ void
 InterferenceHelper::AppendEvent(Ptr<Event> event, bool isStartHePortionRxing)
 {
     NS_LOG_FUNCTION(this << event << isStartHePortionRxing);
-    for (const auto& [band, power] : event->GetRxPowerWPerBand())
+    for (const auto& [bandIndex, power] : GetBandIndices(event->GetRxPowerWPerBand()))
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
+        auto& niChanges = m_niChanges[bandIndex];
         double previousPowerStart = 0;
         double previousPowerEnd = 0;
-        auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), niIt);
-        previousPowerStart = previousPowerPosition->second.GetPower();
-        previousPowerEnd = GetPreviousPosition(event->GetEndTime(), niIt)->second.GetPower();
+        auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), bandIndex);
+        previousPowerStart = niChanges.powers[previousPowerPosition];
+        previousPowerEnd = niChanges.powers[GetPreviousPosition(event->GetEndTime(), bandIndex)];
         if (!m_rxing)
         {
-            m_firstPowers.find(band)->second = previousPowerStart;
+            m_firstPowers[bandIndex] = previousPowerStart;
             // Always leave the first zero power noise event in the list
-            niIt->second.erase(++(niIt->second.begin()), ++previousPowerPosition);
+            const auto count = static_cast<std::ptrdiff_t>(previousPowerPosition) + 1;
+            niChanges.times.erase(niChanges.times.begin() + 1, niChanges.times.begin() + count);
+            niChanges.powers.erase(niChanges.powers.begin() + 1, niChanges.powers.begin() + count);
+            niChanges.events.erase(niChanges.events.begin() + 1, niChanges.events.begin() + count);
         }
         else if (isStartHePortionRxing)
         {
             // When the first HE portion is received, we need to set m_firstPowerPerBand
             // so that it takes into account interferences that arrived between the start of the
             // HE TB PPDU transmission and the start of HE TB payload.
-            m_firstPowers.find(band)->second = previousPowerStart;
+            m_firstPowers[bandIndex] = previousPowerStart;
         }
-        auto first =
-            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
-        auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
+        auto first = AddNiChangeEvent(event->GetStartTime(), previousPowerStart, event, bandIndex);
+        auto last = AddNiChangeEvent(event->GetEndTime(), previousPowerEnd, event, bandIndex);
         for (auto i = first; i != last; ++i)
         {
-            i->second.AddPower(power);
+            niChanges.powers[i] += power;
         }
     }
 }
@@ -390,15 +396,14 @@ InterferenceHelper::UpdateEvent(Ptr<Event> event, const RxPowerWattPerChannelBan
 {
     NS_LOG_FUNCTION(this << event);
     // This is called for UL MU events, in order to scale power as long as UL MU PPDUs arrive
-    for (const auto& [band, power] : rxPower)
+    for (const auto& [bandIndex, power] : GetBandIndices(rxPower))
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
-        auto first = GetPreviousPosition(event->GetStartTime(), niIt);
-        auto last = GetPreviousPosition(event->GetEndTime(), niIt);
+        auto& niChanges = m_niChanges[bandIndex];
+        auto first = GetPreviousPosition(event->GetStartTime(), bandIndex);
+        auto last = GetPreviousPosition(event->GetEndTime(), bandIndex);
         for (auto i = first; i != last; ++i)
         {
-            i->second.AddPower(power);
+            niChanges.powers[i] += power;
         }
     }
     event->UpdateRxPowerW(rxPower);
@@ -438,49 +443,50 @@ InterferenceHelper::CalculateSnr(double signal,
 
 double
 InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
-                                                NiChangesPerBand& nis,
+                                                NiChangesRange& nis,
                                                 const WifiSpectrumBandInfo& band) const
 {
     NS_LOG_FUNCTION(this << band);
-    auto firstPower_it = m_firstPowers.find(band);
-    NS_ABORT_IF(firstPower_it == m_firstPowers.end());
-    double noiseInterferenceW = firstPower_it->second;
-    auto niIt = m_niChanges.find(band);
-    NS_ABORT_IF(niIt == m_niChanges.end());
-    auto it = niIt->second.find(event->GetStartTime());
+    const auto bandIndex = GetBandIndex(band);
+    double noiseInterferenceW = m_firstPowers[bandIndex];
+    const auto& niChanges = m_niChanges[bandIndex];
+    const auto& times = niChanges.times;
+    const auto size = times.size();
+    const auto start = static_cast<std::size_t>(
+        std::lower_bound(times.cbegin(), times.cend(), event->GetStartTime()) - times.cbegin());
+    NS_ABORT_IF(start == size || times[start] != event->GetStartTime());
     double muMimoPowerW = (event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_UL_MU)
-                              ? CalculateMuMimoPowerW(event, band)
+                              ? CalculateMuMimoPowerW(event, band, bandIndex)
                               : 0.0;
-    for (; it != niIt->second.end() && it->first < Simulator::Now(); ++it)
+    const double rxPowerW = event->GetRxPowerW(band);
+    for (auto i = start; i < size && times[i] < Simulator::Now(); ++i)
     {
-        if (IsSameMuMimoTransmission(event, it->second.GetEvent()) &&
-            (event != it->second.GetEvent()))
+        if (IsSameMuMimoTransmission(event, niChanges.events[i]) &&
+            (event != niChanges.events[i]))
         {
             // Do not calculate noiseInterferenceW if events belong to the same MU-MIMO transmission
             // unless this is the same event
             continue;
         }
-        noiseInterferenceW = it->second.GetPower() - event->GetRxPowerW(band) - muMimoPowerW;
+        noiseInterferenceW = niChanges.powers[i] - rxPowerW - muMimoPowerW;
         if (std::abs(noiseInterferenceW) < std::numeric_limits<double>::epsilon())
         {
             // fix some possible rounding issues with double values
             noiseInterferenceW = 0.0;
         }
     }
-    it = niIt->second.find(event->GetStartTime());
-    NS_ABORT_IF(it == niIt->second.end());
-    for (; it != niIt->second.end() && it->second.GetEvent() != event; ++it)
+    auto first = start;
+    while (first < size && niChanges.events[first] != event)
     {
-        ;
+        ++first;
     }
-    NiChanges ni;
-    ni.emplace(event->GetStartTime(), NiChange(0, event));
-    while (++it != niIt->second.end() && it->second.GetEvent() != event)
+    auto last = first + 1;
+    while (last < size && niChanges.events[last] != event)
     {
-        ni.insert(*it);
+        ++last;
     }
-    ni.emplace(event->GetEndTime(), NiChange(0, event));
-    nis.insert({band, ni});
+    NS_ABORT_IF(last >= size);
+    nis = {bandIndex, first, last};
     NS_ASSERT_MSG(noiseInterferenceW >= 0.0,
                   "CalculateNoiseInterferenceW returns negative value " << noiseInterferenceW);
     return noiseInterferenceW;
@@ -488,35 +494,31 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
 
 double
 InterferenceHelper::CalculateMuMimoPowerW(Ptr<const Event> event,
-                                          const WifiSpectrumBandInfo& band) const
+                                          const WifiSpectrumBandInfo& band,
+                                          std::size_t bandIndex) const
 {
-    auto niIt = m_niChanges.find(band);
-    NS_ASSERT(niIt != m_niChanges.end());
-    auto it = niIt->second.begin();
-    ++it;
+    const auto& niChanges = m_niChanges[bandIndex];
     double muMimoPowerW = 0.0;
-    for (; it != niIt->second.end() && it->first < Simulator::Now(); ++it)
+    for (std::size_t i = 1; i < niChanges.times.size() && niChanges.times[i] < Simulator::Now();
+         ++i)
     {
-        if (IsSameMuMimoTransmission(event, it->second.GetEvent()))
+        const auto& otherEvent = niChanges.events[i];
+        if (IsSameMuMimoTransmission(event, otherEvent))
         {
-            auto hePpdu = DynamicCast<HePpdu>(it->second.GetEvent()->GetPpdu()->Copy());
+            auto hePpdu = DynamicCast<HePpdu>(otherEvent->GetPpdu()->Copy());
             NS_ASSERT(hePpdu);
             HePpdu::TxPsdFlag psdFlag = hePpdu->GetTxPsdFlag();
             if (psdFlag == HePpdu::PSD_HE_PORTION)
             {
                 const auto staId =
                     event->GetPpdu()->GetTxVector().GetHeMuUserInfoMap().cbegin()->first;
-                const auto otherStaId = it->second.GetEvent()
-                                            ->GetPpdu()
-                                            ->GetTxVector()
-                                            .GetHeMuUserInfoMap()
-                                            .cbegin()
-                                            ->first;
+                const auto otherStaId =
+                    otherEvent->GetPpdu()->GetTxVector().GetHeMuUserInfoMap().cbegin()->first;
                 if (staId == otherStaId)
                 {
                     break;
                 }
-                muMimoPowerW += it->second.GetEvent()->GetRxPowerW(band);
+                muMimoPowerW += otherEvent->GetRxPowerW(band);
             }
         }
     }
@@ -569,38 +571,37 @@ InterferenceHelper::CalculatePayloadChunkSuccessRate(double snir,
 double
 InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
                                         uint16_t channelWidth,
-                                        NiChangesPerBand* nis,
+                                        const NiChangesRange& nis,
                                         const WifiSpectrumBandInfo& band,
                                         uint16_t staId,
                                         std::pair<Time, Time> window) const
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << window.first << window.second);
     double psr = 1.0; /* Packet Success Rate */
-    const auto& niIt = nis->find(band)->second;
-    auto j = niIt.cbegin();
-    Time previous = j->first;
+    const auto& niChanges = m_niChanges[nis.band];
+    auto j = nis.first;
+    Time previous = niChanges.times[j];
     double muMimoPowerW = 0.0;
     WifiMode payloadMode = event->GetPpdu()->GetTxVector().GetMode(staId);
-    Time phyPayloadStart = j->first;
+    Time phyPayloadStart = niChanges.times[j];
     if (event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_UL_MU &&
         event->GetPpdu()->GetType() !=
-            WIFI_PPDU_TYPE_DL_MU) // j->first corresponds to the start of the MU payload
+            WIFI_PPDU_TYPE_DL_MU) // the first NI change corresponds to the start of the MU payload
     {
-        phyPayloadStart = j->first + WifiPhy::CalculatePhyPreambleAndHeaderDuration(
-                                         event->GetPpdu()->GetTxVector());
+        phyPayloadStart = niChanges.times[j] + WifiPhy::CalculatePhyPreambleAndHeaderDuration(
+                                                   event->GetPpdu()->GetTxVector());
     }
     else
     {
-        muMimoPowerW = CalculateMuMimoPowerW(event, band);
+        muMimoPowerW = CalculateMuMimoPowerW(event, band, nis.band);
     }
     Time windowStart = phyPayloadStart + window.first;
     Time windowEnd = phyPayloadStart + window.second;
-    NS_ABORT_IF(m_firstPowers.count(band) == 0);
-    double noiseInterferenceW = m_firstPowers.at(band);
+    double noiseInterferenceW = m_firstPowers[nis.band];
     double powerW = event->GetRxPowerW(band);
-    while (++j != niIt.cend())
+    while (++j <= nis.last)
     {
-        Time current = j->first;
+        Time current = niChanges.times[j];
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
         double snr = CalculateSnr(powerW,
@@ -628,15 +629,15 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
                 "previous is before windowed payload and current is in the windowed payload: mode="
                 << payloadMode << ", psr=" << psr);
         }
-        noiseInterferenceW = j->second.GetPower() - powerW;
-        if (IsSameMuMimoTransmission(event, j->second.GetEvent()))
+        noiseInterferenceW = niChanges.powers[j] - powerW;
+        if (IsSameMuMimoTransmission(event, niChanges.events[j]))
         {
-            muMimoPowerW += j->second.GetEvent()->GetRxPowerW(band);
+            muMimoPowerW += niChanges.events[j]->GetRxPowerW(band);
             NS_LOG_DEBUG(
                 "PPDU belongs to same MU-MIMO transmission: muMimoPowerW=" << muMimoPowerW);
         }
         noiseInterferenceW -= muMimoPowerW;
-        previous = j->first;
+        previous = current;
         if (previous > windowEnd)
         {
             NS_LOG_DEBUG("Stop: new previous=" << previous
@@ -651,15 +652,15 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
 double
 InterferenceHelper::CalculatePhyHeaderSectionPsr(
     Ptr<const Event> event,
-    NiChangesPerBand* nis,
+    const NiChangesRange& nis,
     uint16_t channelWidth,
     const WifiSpectrumBandInfo& band,
     PhyEntity::PhyHeaderSections phyHeaderSections) const
 {
     NS_LOG_FUNCTION(this << band);
     double psr = 1.0; /* Packet Success Rate */
-    auto niIt = nis->find(band)->second;
-    auto j = niIt.begin();
+    const auto& niChanges = m_niChanges[nis.band];
+    auto j = nis.first;
 
     NS_ASSERT(!phyHeaderSections.empty());
     Time stopLastSection = Seconds(0);
@@ -668,13 +669,12 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
         stopLastSection = Max(stopLastSection, section.second.first.second);
     }
 
-    Time previous = j->first;
-    NS_ABORT_IF(m_firstPowers.count(band) == 0);
-    double noiseInterferenceW = m_firstPowers.at(band);
+    Time previous = niChanges.times[j];
+    double noiseInterferenceW = m_firstPowers[nis.band];
     double powerW = event->GetRxPowerW(band);
-    while (++j != niIt.end())
+    while (++j <= nis.last)
     {
-        Time current = j->first;
+        Time current = niChanges.times[j];
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
         double snr = CalculateSnr(powerW, noiseInterferenceW, channelWidth, 1);
@@ -700,8 +700,8 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
                 }
             }
         }
-        noiseInterferenceW = j->second.GetPower() - powerW;
-        previous = j->first;
+        noiseInterferenceW = niChanges.powers[j] - powerW;
+        previous = current;
         if (previous > stopLastSection)
         {
             NS_LOG_DEBUG("Stop: new previous=" << previous << " after stop of last section="
@@ -714,19 +714,19 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
 
 double
 InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
-                                          NiChangesPerBand* nis,
+                                          const NiChangesRange& nis,
                                           uint16_t channelWidth,
                                           const WifiSpectrumBandInfo& band,
                                           WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    auto niIt = nis->find(band)->second;
+    const Time start = m_niChanges[nis.band].times[nis.first];
     auto phyEntity =
         WifiPhy::GetStaticPhyEntity(event->GetPpdu()->GetTxVector().GetModulationClass());
 
     PhyEntity::PhyHeaderSections sections;
     for (const auto& section :
-         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(), niIt.begin()->first))
+         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(), start))
     {
         if (section.first == header)
         {
@@ -751,7 +751,7 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << relativeMpduStartStop.first
                          << relativeMpduStartStop.second);
-    NiChangesPerBand ni;
+    NiChangesRange ni;
     double noiseInterferenceW = CalculateNoiseInterferenceW(event, ni, band);
     double snr = CalculateSnr(event->GetRxPowerW(band),
                               noiseInterferenceW,
@@ -761,7 +761,7 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
     /* calculate the SNIR at the start of the MPDU (located through windowing) and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    double per = CalculatePayloadPer(event, channelWidth, &ni, band, staId, relativeMpduStartStop);
+    double per = CalculatePayloadPer(event, channelWidth, ni, band, staId, relativeMpduStartStop);
 
     return PhyEntity::SnrPer(snr, per);
 }
@@ -772,7 +772,7 @@ InterferenceHelper::CalculateSnr(Ptr<Event> event,
                                  uint8_t nss,
                                  const WifiSpectrumBandInfo& band) const
 {
-    NiChangesPerBand ni;
+    NiChangesRange ni;
     double noiseInterferenceW = CalculateNoiseInterferenceW(event, ni, band);
     double snr = CalculateSnr(event->GetRxPowerW(band), noiseInterferenceW, channelWidth, nss);
     return snr;
@@ -785,38 +785,46 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
                                              WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    NiChangesPerBand ni;
+    NiChangesRange ni;
     double noiseInterferenceW = CalculateNoiseInterferenceW(event, ni, band);
     double snr = CalculateSnr(event->GetRxPowerW(band), noiseInterferenceW, channelWidth, 1);
 
     /* calculate the SNIR at the start of the PHY header and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    double per = CalculatePhyHeaderPer(event, &ni, channelWidth, band, header);
+    double per = CalculatePhyHeaderPer(event, ni, channelWidth, band, header);
 
     return PhyEntity::SnrPer(snr, per);
 }
 
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::GetNextPosition(Time moment, NiChangesPerBand::iterator niIt)
+std::size_t
+InterferenceHelper::GetNextPosition(Time moment, std::size_t bandIndex) const
 {
-    return niIt->second.upper_bound(moment);
+    const auto& times = m_niChanges[bandIndex].times;
+    return std::upper_bound(times.cbegin(), times.cend(), moment) - times.cbegin();
 }
 
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt)
+std::size_t
+InterferenceHelper::GetPreviousPosition(Time moment, std::size_t bandIndex) const
 {
-    auto it = GetNextPosition(moment, niIt);
     // This is safe since there is always an NiChange at time 0,
     // before moment.
-    --it;
-    return it;
+    return GetNextPosition(moment, bandIndex) - 1;
 }
 
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerBand::iterator niIt)
+std::size_t
+InterferenceHelper::AddNiChangeEvent(Time moment,
+                                     double power,
+                                     Ptr<Event> event,
+                                     std::size_t bandIndex)
 {
-    return niIt->second.insert(GetNextPosition(moment, niIt), std::make_pair(moment, change));
+    auto& niChanges = m_niChanges[bandIndex];
+    const auto position = GetNextPosition(moment, bandIndex);
+    const auto offset = static_cast<std::ptrdiff_t>(position);
+    niChanges.times.insert(niChanges.times.begin() + offset, moment);
+    niChanges.powers.insert(niChanges.powers.begin() + offset, power);
+    niChanges.events.insert(niChanges.events.begin() + offset, event);
+    return position;
 }
 
 void
@@ -832,16 +840,16 @@ InterferenceHelper::NotifyRxEnd(Time endTime, const FrequencyRange& freqRange)
     NS_LOG_FUNCTION(this << endTime << freqRange);
     m_rxing = false;
     // Update m_firstPowers for frame capture
-    for (auto niIt = m_niChanges.begin(); niIt != m_niChanges.end(); ++niIt)
+    for (const auto& [band, bandIndex] : m_bandIndices)
     {
-        if (!IsBandInFrequencyRange(niIt->first, freqRange))
+        if (!IsBandInFrequencyRange(band, freqRange))
         {
             continue;
         }
-        NS_ASSERT(niIt->second.size() > 1);
-        auto it = GetPreviousPosition(endTime, niIt);
-        it--;
-        m_firstPowers.find(niIt->first)->second = it->second.GetPower();
+        NS_ASSERT(m_niChanges[bandIndex].times.size() > 1);
+        auto i = GetPreviousPosition(endTime, bandIndex);
+        NS_ASSERT(i > 0);
+        m_firstPowers[bandIndex] = m_niChanges[bandIndex].powers[i - 1];
     }
 }
 
@@ -349,57 +349,32 @@ class InterferenceHelper : public Object
 
   private:
     /**
-     * Noise and Interference (thus Ni) event.
+     * Noise and Interference (thus Ni) changes of a given band. Changes are stored as a
+     * structure of arrays sorted by time: the i-th change occurs at times[i], is caused by
+     * events[i] and results in a total power of powers[i] watts.
      */
-    class NiChange
+    struct NiChanges
     {
-      public:
-        /**
-         * Create a NiChange at the given time and the amount of NI change.
-         *
-         * \param power the power in watts
-         * \param event causes this NI change
-         */
-        NiChange(double power, Ptr<Event> event);
-        ~NiChange();
-        /**
-         * Return the power
-         *
-         * \return the power in watts
-         */
-        double GetPower() const;
-        /**
-         * Add a given amount of power.
-         *
-         * \param power the power to be added to the existing value in watts
-         */
-        void AddPower(double power);
-        /**
-         * Return the event causes the corresponding NI change
-         *
-         * \return the event
-         */
-        Ptr<Event> GetEvent() const;
-
-      private:
-        double m_power;     ///< power in watts
-        Ptr<Event> m_event; ///< event
+        std::vector<Time> times;        ///< time of each NI change
+        std::vector<double> powers;     ///< total power (W) after each NI change
+        std::vector<Ptr<Event>> events; ///< event causing each NI change
     };
 
     /**
-     * typedef for a multimap of NiChange
+     * Range of NI changes of a band that spans a given event, i.e. from the NI change
+     * corresponding to the start of the event to the NI change corresponding to its end.
      */
-    using NiChanges = std::multimap<Time, NiChange>;
-
-    /**
-     * Map of NiChanges per band
-     */
-    using NiChangesPerBand = std::map<WifiSpectrumBandInfo, NiChanges>;
+    struct NiChangesRange
+    {
+        std::size_t band;  ///< index of the band
+        std::size_t first; ///< index of the NI change at the start of the event
+        std::size_t last;  ///< index of the NI change at the end of the event
+    };
 
     /**
-     * Map of first power per band
+     * Map of band indices
      */
-    using FirstPowerPerBand = std::map<WifiSpectrumBandInfo, double>;
+    using BandIndices = std::map<WifiSpectrumBandInfo, std::size_t>;
 
     /**
      * Check whether a given band is tracked by this interference helper.
@@ -409,6 +384,14 @@ class InterferenceHelper : public Object
      */
     bool HasBand(const WifiSpectrumBandInfo& band) const;
 
+    /**
+     * Get the index of a band tracked by this interference helper.
+     *
+     * \param band the band
+     * \return the index of the band
+     */
+    std::size_t GetBandIndex(const WifiSpectrumBandInfo& band) const;
+
     /**
      * Check whether a given band belongs to a given frequency range.
      *
@@ -432,13 +415,13 @@ class InterferenceHelper : public Object
      * Calculate noise and interference power in W.
      *
      * \param event the event
-     * \param nis the NiChanges
+     * \param nis the range of NiChanges spanning the event (filled by this function)
      * \param band the band
      *
      * \return noise and interference power
      */
     double CalculateNoiseInterferenceW(Ptr<Event> event,
-                                       NiChangesPerBand& nis,
+                                       NiChangesRange& nis,
                                        const WifiSpectrumBandInfo& band) const;
 
     /**
@@ -447,11 +430,14 @@ class InterferenceHelper : public Object
      *
      * \param event the event
      * \param band the band
+     * \param bandIndex the index of the band
      *
      * \return the power of all other events preceding the event that belong to the same MU-MIMO
      * transmission
      */
-    double CalculateMuMimoPowerW(Ptr<const Event> event, const WifiSpectrumBandInfo& band) const;
+    double CalculateMuMimoPowerW(Ptr<const Event> event,
+                                 const WifiSpectrumBandInfo& band,
+                                 std::size_t bandIndex) const;
 
     /**
      * Calculate the error rate of the given PHY payload only in the provided time
@@ -460,7 +446,7 @@ class InterferenceHelper : public Object
      *
      * \param event the event
      * \param channelWidth the channel width used to transmit the PSDU (in MHz)
-     * \param nis the NiChanges
+     * \param nis the range of NiChanges spanning the event
      * \param band identify the band used by the PSDU
      * \param staId the station ID of the PSDU (only used for MU)
      * \param window time window (pair of start and end times) of PHY payload to focus on
@@ -469,7 +455,7 @@ class InterferenceHelper : public Object
      */
     double CalculatePayloadPer(Ptr<const Event> event,
                                uint16_t channelWidth,
-                               NiChangesPerBand* nis,
+                               const NiChangesRange& nis,
                                const WifiSpectrumBandInfo& band,
                                uint16_t staId,
                                std::pair<Time, Time> window) const;
@@ -478,7 +464,7 @@ class InterferenceHelper : public Object
      * can be divided into multiple chunks (e.g. due to interference from other transmissions).
      *
      * \param event the event
-     * \param nis the NiChanges
+     * \param nis the range of NiChanges spanning the event
      * \param channelWidth the channel width (in MHz) for header measurement
      * \param band the band
      * \param header the PHY header to consider
@@ -486,7 +472,7 @@ class InterferenceHelper : public Object
      * \return the error rate of the HT PHY header
      */
     double CalculatePhyHeaderPer(Ptr<const Event> event,
-                                 NiChangesPerBand* nis,
+                                 const NiChangesRange& nis,
                                  uint16_t channelWidth,
                                  const WifiSpectrumBandInfo& band,
                                  WifiPpduField header) const;
@@ -494,7 +480,7 @@ class InterferenceHelper : public Object
      * Calculate the success rate of the PHY header sections for the provided event.
      *
      * \param event the event
-     * \param nis the NiChanges
+     * \param nis the range of NiChanges spanning the event
      * \param channelWidth the channel width (in MHz) for header measurement
      * \param band the band
      * \param phyHeaderSections the map of PHY header sections (\see PhyEntity::PhyHeaderSections)
@@ -502,47 +488,60 @@ class InterferenceHelper : public Object
      * \return the success rate of the PHY header sections
      */
     double CalculatePhyHeaderSectionPsr(Ptr<const Event> event,
-                                        NiChangesPerBand* nis,
+                                        const NiChangesRange& nis,
                                         uint16_t channelWidth,
                                         const WifiSpectrumBandInfo& band,
                                         PhyEntity::PhyHeaderSections phyHeaderSections) const;
 
     double m_noiseFigure;                 //!< noise figure (linear)
     Ptr<ErrorRateModel> m_errorRateModel; //!< error rate model
-    uint8_t m_numRxAntennas;         //!< the number of RX antennas in the corresponding receiver
-    NiChangesPerBand m_niChanges;    //!< NI Changes for each band
-    FirstPowerPerBand m_firstPowers; //!< first power of each band in watts
-    bool m_rxing;                    //!< flag whether it is in receiving state
+    uint8_t m_numRxAntennas;            //!< the number of RX antennas in the corresponding receiver
+    BandIndices m_bandIndices;          //!< index of each band
+    std::vector<NiChanges> m_niChanges; //!< NI Changes for each band, indexed by band index
+    std::vector<double> m_firstPowers;  //!< first power (W) of each band, indexed by band index
+    bool m_rxing;                       //!< flag whether it is in receiving state
 
     /**
-     * Returns an iterator to the first NiChange that is later than moment
+     * Returns the index of the first NiChange that is later than moment
      *
      * \param moment time to check from
-     * \param niIt iterator of the band to check
-     * \returns an iterator to the list of NiChanges
+     * \param bandIndex index of the band to check
+     * \returns the index of the NiChange
      */
-    NiChanges::iterator GetNextPosition(Time moment, NiChangesPerBand::iterator niIt);
+    std::size_t GetNextPosition(Time moment, std::size_t bandIndex) const;
     /**
-     * Returns an iterator to the last NiChange that is before than moment
+     * Returns the index of the last NiChange that is before than moment
      *
      * \param moment time to check from
-     * \param niIt iterator of the band to check
-     * \returns an iterator to the list of NiChanges
+     * \param bandIndex index of the band to check
+     * \returns the index of the NiChange
      */
-    NiChanges::iterator GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt);
+    std::size_t GetPreviousPosition(Time moment, std::size_t bandIndex) const;
 
     /**
      * Add NiChange to the list at the appropriate position and
-     * return the iterator of the new event.
+     * return the index of the new event.
      *
-     * \param moment time to check from
-     * \param change the NiChange to add
-     * \param niIt iterator of the band to check
-     * \returns the iterator of the new event
+     * \param moment time of the NI change
+     * \param power the power in watts
+     * \param event the event causing this NI change
+     * \param bandIndex index of the band to update
+     * \returns the index of the new NI change
+     */
+    std::size_t AddNiChangeEvent(Time moment,
+                                 double power,
+                                 Ptr<Event> event,
+                                 std::size_t bandIndex);
+
+    /**
+     * Look up the index of every band for which a received power is given. Both maps
+     * are sorted by band, hence this is done in a single pass over the tracked bands.
+     *
+     * \param rxPower the received power (W) per band
+     * \return the (band index, power) pairs, in the order of the bands in rxPower
      */
-    NiChanges::iterator AddNiChangeEvent(Time moment,
-                                         NiChange change,
-                                         NiChangesPerBand::iterator niIt);
+    std::vector<std::pair<std::size_t, double>> GetBandIndices(
+        const RxPowerWattPerChannelBand& rxPower) const;
 
     /**
      * Return whether another event is a MU-MIMO event that belongs to the same transmission and to
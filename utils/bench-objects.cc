@@ -0,0 +1,160 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the construction of objects with
+// attributes through CreateObject and ObjectFactory, e.g. to measure the
+// setup time of scenarios creating many objects.
+// Sample usage:  ./ns3 run 'bench-objects --n=1000000'
+
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/config.h"
+#include "ns3/double.h"
+#include "ns3/nstime.h"
+#include "ns3/object-factory.h"
+#include "ns3/object.h"
+#include "ns3/string.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/uinteger.h"
+
+#include <iostream>
+
+using namespace ns3;
+
+/// Base object with a few attributes of common types
+class BenchBase : public Object
+{
+  public:
+    /**
+     * Register this type.
+     * \return The TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::BenchBase")
+                                .SetParent<Object>()
+                                .SetGroupName("Core")
+                                .AddAttribute("Enabled",
+                                              "A boolean attribute.",
+                                              BooleanValue(true),
+                                              MakeBooleanAccessor(&BenchBase::m_enabled),
+                                              MakeBooleanChecker())
+                                .AddAttribute("Count",
+                                              "An integer attribute.",
+                                              UintegerValue(8),
+                                              MakeUintegerAccessor(&BenchBase::m_count),
+                                              MakeUintegerChecker<uint32_t>())
+                                .AddAttribute("Delay",
+                                              "A time attribute.",
+                                              TimeValue(MilliSeconds(1)),
+                                              MakeTimeAccessor(&BenchBase::m_delay),
+                                              MakeTimeChecker());
+        return tid;
+    }
+
+  private:
+    bool m_enabled;   //!< boolean attribute
+    uint32_t m_count; //!< integer attribute
+    Time m_delay;     //!< time attribute
+};
+
+/// Derived object, adding attributes to the ones of its parent
+class BenchDerived : public BenchBase
+{
+  public:
+    /**
+     * Register this type.
+     * \return The TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::BenchDerived")
+                                .SetParent<BenchBase>()
+                                .SetGroupName("Core")
+                                .AddConstructor<BenchDerived>()
+                                .AddAttribute("Gain",
+                                              "A double attribute.",
+                                              DoubleValue(0.5),
+                                              MakeDoubleAccessor(&BenchDerived::m_gain),
+                                              MakeDoubleChecker<double>())
+                                .AddAttribute("Name",
+                                              "A string attribute.",
+                                              StringValue("bench"),
+                                              MakeStringAccessor(&BenchDerived::m_name),
+                                              MakeStringChecker())
+                                .AddAttribute("Size",
+                                              "Another integer attribute.",
+                                              UintegerValue(1500),
+                                              MakeUintegerAccessor(&BenchDerived::m_size),
+                                              MakeUintegerChecker<uint32_t>());
+        return tid;
+    }
+
+  private:
+    double m_gain;      //!< double attribute
+    std::string m_name; //!< string attribute
+    uint32_t m_size;    //!< integer attribute
+};
+
+NS_OBJECT_ENSURE_REGISTERED(BenchDerived);
+
+/**
+ * Run a benchmark and print its results.
+ * \param name the benchmark name
+ * \param n the number of objects to create
+ * \param create the function creating one object
+ */
+template <typename F>
+static void
+Bench(const std::string& name, uint32_t n, F create)
+{
+    SystemWallClockMs clock;
+    clock.Start();
+    for (uint32_t i = 0; i < n; i++)
+    {
+        create();
+    }
+    uint64_t ms = clock.End();
+    std::cout << name << ": " << n << " objects in " << ms << " ms";
+    if (ms > 0)
+    {
+        std::cout << " (" << (n * 1000.0 / ms) << " objects/s)";
+    }
+    std::cout << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t n = 100000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("n", "Number of objects to create in each benchmark", n);
+    cmd.Parse(argc, argv);
+
+    Bench("CreateObject", n, []() { CreateObject<BenchDerived>(); });
+
+    ObjectFactory factory;
+    factory.SetTypeId("ns3::BenchDerived");
+    factory.Set("Count", UintegerValue(16));
+    factory.Set("Name", StringValue("factory"));
+    Bench("ObjectFactory", n, [&factory]() { factory.Create<BenchDerived>(); });
+
+    // a new default value invalidates the cached construction plans
+    Config::SetDefault("ns3::BenchDerived::Gain", DoubleValue(0.25));
+    Bench("CreateObject after SetDefault", n, []() { CreateObject<BenchDerived>(); });
+
+    return 0;
+}